@@ -0,0 +1,529 @@
+/*
+ * File:   ecu_dtmf.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:30 PM
+ */
+
+#include "ecu_dtmf.h"
+
+#define DTMF_QUEUE_INDEX_MASK             (DTMF_CFG_EVENT_QUEUE_SIZE - 1U)
+#define DTMF_NO_DIGIT                     0x00U
+
+/* Row tones first, then column tones */
+static const sint16 dtmf_digit_coefficients[DTMF_MAX_TONES] = {
+    DTMF_GOERTZEL_COEFF(697),  DTMF_GOERTZEL_COEFF(770),  DTMF_GOERTZEL_COEFF(852),  DTMF_GOERTZEL_COEFF(941),
+    DTMF_GOERTZEL_COEFF(1209), DTMF_GOERTZEL_COEFF(1336), DTMF_GOERTZEL_COEFF(1477), DTMF_GOERTZEL_COEFF(1633)
+};
+
+static const uint8 dtmf_digit_map[4][4] = {
+    {'1', '2', '3', 'A'},
+    {'4', '5', '6', 'B'},
+    {'7', '8', '9', 'C'},
+    {'*', '0', '#', 'D'}
+};
+
+/* Filter bank */
+static const sint16 *dtmf_coefficients = dtmf_digit_coefficients;
+static uint8 dtmf_tone_count = DTMF_MAX_TONES;
+static uint8 dtmf_tone_mode = ZERO_INIT;
+static sint32 dtmf_s1[DTMF_MAX_TONES];
+static sint32 dtmf_s2[DTMF_MAX_TONES];
+static uint32 dtmf_energy = ZERO_INIT;
+static sint32 dtmf_sum = ZERO_INIT;
+static sint32 dtmf_offset = 128;
+static uint8 dtmf_sample_count = ZERO_INIT;
+
+/* Last complete block, owned by DTMF_Process() while dtmf_block_ready is set */
+static sint32 dtmf_block_s1[DTMF_MAX_TONES];
+static sint32 dtmf_block_s2[DTMF_MAX_TONES];
+static uint32 dtmf_block_energy = ZERO_INIT;
+static sint32 dtmf_block_sum = ZERO_INIT;
+static volatile uint8 dtmf_block_ready = ZERO_INIT;
+/* Mean of the last processed block, the offset of the blocks started after it */
+static sint32 dtmf_next_offset = 128;
+
+/* Detection state */
+static uint8 dtmf_candidate = DTMF_NO_DIGIT;
+static uint8 dtmf_reported = DTMF_NO_DIGIT;
+static uint8 dtmf_tones_on = ZERO_INIT;
+
+/* Events posted by DTMF_Process() for the application */
+static dtmf_event_t dtmf_queue[DTMF_CFG_EVENT_QUEUE_SIZE];
+static volatile uint8 dtmf_queue_head = ZERO_INIT;
+static volatile uint8 dtmf_queue_tail = ZERO_INIT;
+
+static sint32 dtmf_mul_q14(sint16 coeff, sint32 state);
+static void dtmf_reset_state(void);
+static void dtmf_lock(void);
+static void dtmf_unlock(void);
+static void dtmf_block_end(void);
+static void dtmf_detect_digit(const uint32 *_power, uint32 energy);
+static void dtmf_detect_tones(const uint32 *_power, uint32 energy);
+static void dtmf_post_event(dtmf_event_type_t type, uint8 value);
+static void dtmf_clear_bank(void);
+
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/* Detector fed by the ADC interrupt, NULL while the samples come from the application */
+static const dtmf_t *dtmf_active = NULL;
+
+static void DTMF_Scan_ISR(void);
+
+/**
+ * @brief Initializes the ADC and the CCP2 trigger and starts the detection.
+ * @param _dtmf Pointer to the detector configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType DTMF_Init(dtmf_t *_dtmf)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    adc_scan_cfg_t l_scan;
+
+    if(NULL == _dtmf)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        (void)DTMF_Reset();
+        dtmf_active = _dtmf;
+
+        /* Results are read from the scan frames, the per conversion handler isn't used */
+        _dtmf->detector_adc.ADC_InterruptHandler = NULL;
+        _dtmf->detector_adc.adc_channel = _dtmf->input_channel;
+        _dtmf->detector_adc.result_format = ADC_RESULT_RIGHT;
+        ret = ADC_Init(&(_dtmf->detector_adc));
+
+        if(E_OK == ret)
+        {
+            /* One channel, one sample per special event */
+            l_scan.ADC_ScanCompleteHandler = DTMF_Scan_ISR;
+            l_scan.channels = &(_dtmf->input_channel);
+            l_scan.oversampling = NULL;
+            l_scan.channel_count = 1;
+            l_scan.scan_mode = ADC_SCAN_TRIGGERED;
+            ret = ADC_Scan_Start(&(_dtmf->detector_adc), &l_scan);
+        }
+        else { /* Nothing */ }
+
+        if(E_OK == ret)
+        {
+            _dtmf->sample_ccp.ccp_inst = CCP2_INST;
+            _dtmf->sample_ccp.ccp_mode = CCP_COMPARE_MODE_SELECTED;
+            _dtmf->sample_ccp.ccp_mode_variant = CCP_COMPARE_MODE_GEN_EVENT;
+            _dtmf->sample_ccp.special_event_frequency = DTMF_CFG_SAMPLE_RATE;
+            _dtmf->sample_ccp.special_event_timer_prescaler = DTMF_CFG_TIMER_PRESCALER;
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _dtmf->sample_ccp.CCP2_InterruptHandler = NULL;
+#endif
+            ret = CCP_Init(&(_dtmf->sample_ccp));
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Scan complete handler, one sample is available.
+ */
+static void DTMF_Scan_ISR(void)
+{
+    adc_result_t l_sample = ZERO_INIT;
+
+    if(E_OK == ADC_Scan_Read_Frame(&(dtmf_active->detector_adc), &l_sample, NULL))
+    {
+        (void)DTMF_Sample_Event(l_sample);
+    }
+    else { /* Nothing */ }
+}
+#endif
+
+/**
+ * @brief Runs the Goertzel filter bank on one sample.
+ * @param sample The 10-bit conversion result.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType DTMF_Sample_Event(adc_result_t sample)
+{
+    sint32 l_sample = (sint32)(sample >> 2);
+    sint32 l_s0 = ZERO_INIT;
+    uint8 l_magnitude = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    /* 8-bit samples keep the filter states below 2^24 and the powers inside 32 bits */
+    dtmf_sum += l_sample;
+    l_sample -= dtmf_offset;
+    l_magnitude = (uint8)((l_sample < 0) ? -l_sample : l_sample);
+    dtmf_energy += (uint16)((uint16)l_magnitude * l_magnitude);
+
+    /* s0 = x + coeff.s1 - s2 */
+    for(l_index = 0; l_index < dtmf_tone_count; l_index++)
+    {
+        l_s0 = l_sample + dtmf_mul_q14(dtmf_coefficients[l_index], dtmf_s1[l_index]) - dtmf_s2[l_index];
+        dtmf_s2[l_index] = dtmf_s1[l_index];
+        dtmf_s1[l_index] = l_s0;
+    }
+
+    dtmf_sample_count++;
+    if(dtmf_sample_count >= DTMF_CFG_BLOCK_SIZE)
+    {
+        dtmf_block_end();
+    }
+    else { /* Nothing */ }
+
+    return E_OK;
+}
+
+/**
+ * @brief Runs the detection on the last complete block.
+ * @return Status of the function:
+ *         - E_OK: A block was processed
+ *         - E_NOT_OK: No block is waiting
+ */
+Std_ReturnType DTMF_Process(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_power[DTMF_MAX_TONES];
+    sint32 l_offset = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if(dtmf_block_ready)
+    {
+        /* |X(k)|^2 = s1^2 + s2^2 - coeff.s1.s2 */
+        for(l_index = 0; l_index < dtmf_tone_count; l_index++)
+        {
+            l_power[l_index] = (uint32)((dtmf_block_s1[l_index] * dtmf_block_s1[l_index]) +
+                               (dtmf_block_s2[l_index] * dtmf_block_s2[l_index]) -
+                               (dtmf_mul_q14(dtmf_coefficients[l_index], dtmf_block_s1[l_index]) * dtmf_block_s2[l_index]));
+        }
+
+        if(dtmf_tone_mode)
+        {
+            dtmf_detect_tones(l_power, dtmf_block_energy);
+        }
+        else
+        {
+            dtmf_detect_digit(l_power, dtmf_block_energy);
+        }
+
+        /* Taken by the interrupt at the next block end, 4 bytes it mustn't read half written */
+        l_offset = dtmf_block_sum / (sint32)DTMF_CFG_BLOCK_SIZE;
+        dtmf_lock();
+        dtmf_next_offset = l_offset;
+        dtmf_unlock();
+
+        dtmf_block_ready = ZERO_INIT;
+        ret = E_OK;
+    }
+    else { /* Nothing */ }
+
+    return ret;
+}
+
+/**
+ * @brief Gets the oldest detector event.
+ * @param _event Pointer to the event.
+ * @return Status of the function:
+ *         - E_OK: An event was read
+ *         - E_NOT_OK: The queue is empty
+ */
+Std_ReturnType DTMF_Read_Event(dtmf_event_t *_event)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_tail = dtmf_queue_tail;
+
+    if(NULL == _event)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(l_tail == dtmf_queue_head)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_event = dtmf_queue[l_tail];
+        /* Release the slot only after the copy, the interrupt may refill it right after */
+        dtmf_queue_tail = (uint8)((l_tail + 1U) & DTMF_QUEUE_INDEX_MASK);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Selects the tones detected instead of the DTMF digits.
+ * @param coefficients Goertzel coefficients built with DTMF_GOERTZEL_COEFF(), NULL goes back
+ *                     to the DTMF digits.
+ * @param tone_count 1 .. DTMF_MAX_TONES.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType DTMF_Set_Tones(const sint16 *coefficients, uint8 tone_count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL != coefficients) && ((ZERO_INIT == tone_count) || (DTMF_MAX_TONES < tone_count)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Table and count change together, the sample interrupt never sees a mixed pair */
+        dtmf_lock();
+        if(NULL == coefficients)
+        {
+            dtmf_tone_mode = ZERO_INIT;
+            dtmf_tone_count = DTMF_MAX_TONES;
+            dtmf_coefficients = dtmf_digit_coefficients;
+        }
+        else
+        {
+            dtmf_tone_mode = 1;
+            dtmf_tone_count = tone_count;
+            dtmf_coefficients = coefficients;
+        }
+        dtmf_reset_state();
+        dtmf_unlock();
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Clears the filter bank, the detection state and the event queue.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType DTMF_Reset(void)
+{
+    dtmf_lock();
+    dtmf_reset_state();
+    dtmf_unlock();
+
+    return E_OK;
+}
+
+static void dtmf_reset_state(void)
+{
+    dtmf_clear_bank();
+    dtmf_offset = 128;
+    dtmf_next_offset = 128;
+    dtmf_block_ready = ZERO_INIT;
+    dtmf_candidate = DTMF_NO_DIGIT;
+    dtmf_reported = DTMF_NO_DIGIT;
+    dtmf_tones_on = ZERO_INIT;
+    dtmf_queue_tail = dtmf_queue_head;
+}
+
+/* Keeps DTMF_Sample_Event() out while the bank changes, when the ADC interrupt feeds it */
+static void dtmf_lock(void)
+{
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+    if(NULL != dtmf_active)
+    {
+        ADC_InterruptDisable();
+    }
+    else { /* Nothing */ }
+#endif
+}
+
+static void dtmf_unlock(void)
+{
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+    if(NULL != dtmf_active)
+    {
+        ADC_InterruptEnable();
+    }
+    else { /* Nothing */ }
+#endif
+}
+
+/**
+ * @brief coeff.state / 2^14 from 8x8 bit products, the PIC18 hardware multiplier.
+ * @note  |state| < 2^24 : state = high.2^16 + low, coeff.high.2^16 / 2^14 is exact so
+ *        the result is coeff.high.4 + coeff.low / 2^14. Rounded toward 0.
+ */
+static sint32 dtmf_mul_q14(sint16 coeff, sint32 state)
+{
+    uint16 l_coeff = (uint16)((coeff < 0) ? -(sint32)coeff : (sint32)coeff);
+    uint32 l_state = (uint32)((state < 0) ? -state : state);
+    uint8 l_c0 = (uint8)l_coeff;
+    uint8 l_c1 = (uint8)(l_coeff >> 8);
+    uint8 l_s0 = (uint8)l_state;
+    uint8 l_s1 = (uint8)(l_state >> 8);
+    uint8 l_s2 = (uint8)(l_state >> 16);
+    uint32 l_low = ZERO_INIT;
+    uint32 l_high = ZERO_INIT;
+    sint32 l_result = ZERO_INIT;
+
+    /* coeff x low 16 bits of the state, four products */
+    l_low = (uint32)((uint16)l_c0 * l_s0) +
+            ((uint32)((uint16)l_c0 * l_s1) << 8) + ((uint32)((uint16)l_c1 * l_s0) << 8) +
+            ((uint32)((uint16)l_c1 * l_s1) << 16);
+    /* coeff x high 8 bits, two products */
+    l_high = (uint32)((uint16)l_c0 * l_s2) + ((uint32)((uint16)l_c1 * l_s2) << 8);
+
+    l_result = (sint32)((l_high << (16U - DTMF_COEFF_Q_BITS)) + (l_low >> DTMF_COEFF_Q_BITS));
+    if((coeff < 0) != (state < 0))
+    {
+        l_result = -l_result;
+    }
+    else { /* Nothing */ }
+    return l_result;
+}
+
+/**
+ * @brief Hands the block over to DTMF_Process() and restarts the bank.
+ * @note  Copies only, the powers and the detection run out of the interrupt.
+ */
+static void dtmf_block_end(void)
+{
+    uint8 l_index = ZERO_INIT;
+
+    if(ZERO_INIT == dtmf_block_ready)
+    {
+        for(l_index = 0; l_index < dtmf_tone_count; l_index++)
+        {
+            dtmf_block_s1[l_index] = dtmf_s1[l_index];
+            dtmf_block_s2[l_index] = dtmf_s2[l_index];
+        }
+        dtmf_block_energy = dtmf_energy;
+        dtmf_block_sum = dtmf_sum;
+        dtmf_block_ready = 1;
+    }
+    else { /* Nothing */ }
+
+    dtmf_offset = dtmf_next_offset;
+    dtmf_clear_bank();
+}
+
+static void dtmf_detect_digit(const uint32 *_power, uint32 energy)
+{
+    uint8 l_row = ZERO_INIT;
+    uint8 l_col = 4U;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_digit = DTMF_NO_DIGIT;
+    uint8 l_valid = 1U;
+
+    for(l_index = 1; l_index < 4U; l_index++)
+    {
+        if(_power[l_index] > _power[l_row])
+        {
+            l_row = l_index;
+        }
+        else { /* Nothing */ }
+        if(_power[l_index + 4U] > _power[l_col])
+        {
+            l_col = (uint8)(l_index + 4U);
+        }
+        else { /* Nothing */ }
+    }
+
+    /* Both tones loud enough and close in level (twist) */
+    if((_power[l_row] < DTMF_CFG_MIN_POWER) || (_power[l_col] < DTMF_CFG_MIN_POWER) ||
+       ((_power[l_row] / DTMF_CFG_TWIST_RATIO) > _power[l_col]) ||
+       ((_power[l_col] / DTMF_CFG_TWIST_RATIO) > _power[l_row]))
+    {
+        l_valid = ZERO_INIT;
+    }
+    else { /* Nothing */ }
+
+    /* A single tone in each group */
+    for(l_index = 0; l_index < DTMF_MAX_TONES; l_index++)
+    {
+        if((l_index != l_row) && (l_index != l_col) &&
+           ((_power[l_index] * DTMF_CFG_PEAK_RATIO) > ((l_index < 4U) ? _power[l_row] : _power[l_col])))
+        {
+            l_valid = ZERO_INIT;
+        }
+        else { /* Nothing */ }
+    }
+
+    /* The two tones carry most of the signal energy : P = E.N / 2 for a pure sine, 1/4 of it at least */
+    if((_power[l_row] + _power[l_col]) < ((energy >> 3) * DTMF_CFG_BLOCK_SIZE))
+    {
+        l_valid = ZERO_INIT;
+    }
+    else { /* Nothing */ }
+
+    if(l_valid)
+    {
+        l_digit = dtmf_digit_map[l_row][l_col - 4U];
+    }
+    else { /* Nothing */ }
+
+    /* Same digit in two blocks in a row, reported once until the key is released */
+    if((DTMF_NO_DIGIT != l_digit) && (l_digit == dtmf_candidate) && (l_digit != dtmf_reported))
+    {
+        dtmf_post_event(DTMF_EVENT_DIGIT, l_digit);
+        dtmf_reported = l_digit;
+    }
+    else if(DTMF_NO_DIGIT == l_digit)
+    {
+        dtmf_reported = DTMF_NO_DIGIT;
+    }
+    else { /* Nothing */ }
+    dtmf_candidate = l_digit;
+}
+
+static void dtmf_detect_tones(const uint32 *_power, uint32 energy)
+{
+    uint8 l_index = ZERO_INIT;
+    uint8 l_mask = ZERO_INIT;
+    uint32 l_min_power = (energy >> 3) * DTMF_CFG_BLOCK_SIZE;
+
+    for(l_index = 0; l_index < dtmf_tone_count; l_index++)
+    {
+        l_mask = (uint8)(1U << l_index);
+        if((_power[l_index] >= DTMF_CFG_MIN_POWER) && (_power[l_index] >= l_min_power))
+        {
+            if(0U == (dtmf_tones_on & l_mask))
+            {
+                dtmf_tones_on |= l_mask;
+                dtmf_post_event(DTMF_EVENT_TONE_ON, l_index);
+            }
+            else { /* Nothing */ }
+        }
+        else if(dtmf_tones_on & l_mask)
+        {
+            dtmf_tones_on &= (uint8)~l_mask;
+            dtmf_post_event(DTMF_EVENT_TONE_OFF, l_index);
+        }
+        else { /* Nothing */ }
+    }
+}
+
+static void dtmf_post_event(dtmf_event_type_t type, uint8 value)
+{
+    uint8 l_next_head = (uint8)((dtmf_queue_head + 1U) & DTMF_QUEUE_INDEX_MASK);
+
+    /* A full queue drops the new event */
+    if(l_next_head != dtmf_queue_tail)
+    {
+        dtmf_queue[dtmf_queue_head].type = type;
+        dtmf_queue[dtmf_queue_head].value = value;
+        dtmf_queue_head = l_next_head;
+    }
+    else { /* Nothing */ }
+}
+
+static void dtmf_clear_bank(void)
+{
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = 0; l_index < DTMF_MAX_TONES; l_index++)
+    {
+        dtmf_s1[l_index] = ZERO_INIT;
+        dtmf_s2[l_index] = ZERO_INIT;
+    }
+    dtmf_energy = ZERO_INIT;
+    dtmf_sum = ZERO_INIT;
+    dtmf_sample_count = ZERO_INIT;
+}
@@ -0,0 +1,181 @@
+/*
+ * File:   ecu_dtmf.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:30 PM
+ */
+
+#ifndef ECU_DTMF_H
+#define	ECU_DTMF_H
+
+/* Section : Includes */
+#include "ecu_dtmf_cfg.h"
+
+/* Section: Macro Declarations */
+
+/* Goertzel filters in the bank, 4 row and 4 column tones in DTMF mode */
+#define DTMF_MAX_TONES                    8U
+
+/* Fraction bits of the Goertzel coefficients */
+#define DTMF_COEFF_Q_BITS                 14U
+
+/* Instruction cycles per sample in the ADC interrupt : the filter bank and the scan step */
+#define DTMF_SAMPLE_CYCLES                750UL
+
+#if (DTMF_CFG_EVENT_QUEUE_SIZE & (DTMF_CFG_EVENT_QUEUE_SIZE - 1U)) != 0U
+#error "DTMF : DTMF_CFG_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+#if (_XTAL_FREQ / 4UL / DTMF_CFG_SAMPLE_RATE) < DTMF_SAMPLE_CYCLES
+#error "DTMF : the instruction clock is too slow for DTMF_CFG_SAMPLE_RATE, 8 kHz needs 32 MHz (8 MHz crystal with the PLL)"
+#endif
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Goertzel bin of a frequency, rounded to the nearest */
+#define DTMF_BIN(_FREQ_) \
+            ((((2UL * DTMF_CFG_BLOCK_SIZE * (uint32)(_FREQ_)) / DTMF_CFG_SAMPLE_RATE) + 1UL) / 2UL)
+
+/* cos(x) for 0 <= x <= pi, Taylor series to x^16, evaluated by the compiler */
+#define DTMF_COS_(_X_) \
+            (1.0 - ((_X_) * (_X_) / 2.0) * (1.0 - ((_X_) * (_X_) / 12.0) * (1.0 - ((_X_) * (_X_) / 30.0) * \
+            (1.0 - ((_X_) * (_X_) / 56.0) * (1.0 - ((_X_) * (_X_) / 90.0) * (1.0 - ((_X_) * (_X_) / 132.0) * \
+            (1.0 - ((_X_) * (_X_) / 182.0) * (1.0 - ((_X_) * (_X_) / 240.0)))))))))
+
+/* Angle of a bin in radians */
+#define DTMF_BIN_ANGLE_(_FREQ_) \
+            (6.283185307179586 * (double)DTMF_BIN(_FREQ_) / (double)DTMF_CFG_BLOCK_SIZE)
+
+/**
+ * @brief Goertzel coefficient 2.cos(2.pi.k / N) of a frequency, in Q14
+ * @note  A constant expression, usable to build the tone table of DTMF_Set_Tones() with
+ *        no floating point code at run time. Frequencies from DTMF_CFG_SAMPLE_RATE /
+ *        DTMF_CFG_BLOCK_SIZE (bin 1, 2.0 doesn't fit Q14 in 16 bits) to DTMF_CFG_SAMPLE_RATE / 2.
+ */
+#define DTMF_GOERTZEL_COEFF(_FREQ_) \
+            ((sint16)((2.0 * DTMF_COS_(DTMF_BIN_ANGLE_(_FREQ_)) * (double)(1UL << DTMF_COEFF_Q_BITS)) + \
+                      ((DTMF_COS_(DTMF_BIN_ANGLE_(_FREQ_)) >= 0.0) ? 0.5 : -0.5)))
+
+/* Section: Data Type Declarations */
+
+/**
+ * @enum dtmf_event_type_t
+ * @brief Type of a detector event
+ */
+typedef enum
+{
+    DTMF_EVENT_DIGIT = 0,           /* DTMF mode : digit pressed, value is '0'..'9', '*', '#', 'A'..'D' */
+    DTMF_EVENT_TONE_ON,             /* Tone mode : value is the tone index */
+    DTMF_EVENT_TONE_OFF
+} dtmf_event_type_t;
+
+/**
+ * @struct dtmf_event_t
+ * @brief Detector event
+ */
+typedef struct
+{
+    dtmf_event_type_t type;
+    uint8 value;
+} dtmf_event_t;
+
+/**
+ * @struct dtmf_t
+ * @brief DTMF / tone detector input
+ * @note  The input is biased at mid-scale. detector_adc : only voltage_reference (and manual
+ *        timing if wanted) are used, DTMF_Init() sets the rest. sample_ccp : only
+ *        ccp_capture_timer is used, CCP2 runs the special event trigger.
+ */
+typedef struct
+{
+    adc_conf_t detector_adc;        /* ADC converting the input */
+    ccp_t sample_ccp;               /* CCP2 special event, paces the conversions */
+    adc_channel_select_t input_channel;
+} dtmf_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Runs the Goertzel filter bank on one sample.
+ * @details One multiply-accumulate per filter, the Q14 coefficient times the 32-bit state
+ *          is built from six 8x8 bit hardware multiplications. Every DTMF_CFG_BLOCK_SIZE
+ *          samples the filter states are copied for DTMF_Process() and the bank restarts.
+ *          Called from the ADC interrupt, it can be fed with recorded or synthesized samples
+ *          as well.
+ * @param sample The 10-bit conversion result.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType DTMF_Sample_Event(adc_result_t sample);
+
+/**
+ * @brief Runs the detection on the last complete block.
+ * @details Computes the tone powers of the block and posts the events, about 4000
+ *          instruction cycles once per block, out of the ADC interrupt. Call it from the main
+ *          loop at least once per block (25.6 ms with the default configuration), a block
+ *          still waiting when the next one ends is dropped.
+ *          DTMF mode : a digit is reported when the same digit is found in two blocks in a row,
+ *          once per key press.
+ *          Tone mode : an event is reported when a tone appears or disappears.
+ * @return Status of the function:
+ *         - E_OK: A block was processed
+ *         - E_NOT_OK: No block is waiting
+ */
+Std_ReturnType DTMF_Process(void);
+
+/**
+ * @brief Gets the oldest detector event.
+ * @note  The events are posted by DTMF_Process().
+ * @param _event Pointer to the event.
+ * @return Status of the function:
+ *         - E_OK: An event was read
+ *         - E_NOT_OK: The queue is empty
+ */
+Std_ReturnType DTMF_Read_Event(dtmf_event_t *_event);
+
+/**
+ * @brief Selects the tones detected instead of the DTMF digits.
+ * @details Each tone is reported on its own with DTMF_EVENT_TONE_ON / OFF events.
+ * @note  The table is used from the ADC interrupt, DTMF_Init() detectors switch with the
+ *        ADC interrupt disabled.
+ * @param coefficients Goertzel coefficients built with DTMF_GOERTZEL_COEFF(), NULL goes back
+ *                     to the DTMF digits.
+ * @param tone_count 1 .. DTMF_MAX_TONES.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType DTMF_Set_Tones(const sint16 *coefficients, uint8 tone_count);
+
+/**
+ * @brief Clears the filter bank, the detection state and the event queue.
+ * @note  Runs with the ADC interrupt disabled once DTMF_Init() has started the detector.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType DTMF_Reset(void);
+
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/**
+ * @brief Initializes the ADC and the CCP2 trigger and starts the detection.
+ * @details CCP2 starts a conversion at DTMF_CFG_SAMPLE_RATE and every result is fed to
+ *          DTMF_Sample_Event() from the ADC interrupt, DTMF_Process() runs the detection.
+ *          Counted per sample : 8 filters of 6 MULWF and about 75 instruction cycles each,
+ *          30 for the sample and the energy, about 630 cycles, plus the ADC interrupt and the
+ *          scan step (about 120 cycles), DTMF_SAMPLE_CYCLES. The block end copy adds about
+ *          200 cycles once per block. At 8 kHz a sample has 1000 instruction cycles with a
+ *          32 MHz clock (8 MHz crystal with the PLL), 250 at 8 MHz which stops the build.
+ *          Only one detector can run, and it can't share CCP2 with another special event user.
+ * @pre   Timer1/Timer3 (as selected by sample_ccp.ccp_capture_timer) is running in timer mode
+ *        with the DTMF_CFG_TIMER_PRESCALER pre-scaler.
+ * @param _dtmf Pointer to the detector configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType DTMF_Init(dtmf_t *_dtmf);
+#endif
+
+#endif	/* ECU_DTMF_H */
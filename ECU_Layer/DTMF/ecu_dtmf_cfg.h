@@ -0,0 +1,44 @@
+/*
+ * File:   ecu_dtmf_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:30 PM
+ */
+
+#ifndef ECU_DTMF_CFG_H
+#define	ECU_DTMF_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/ADC/hal_adc.h"
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+
+/* Section: Macro Declarations */
+
+/* Sampling rate of the input in Hz */
+#define DTMF_CFG_SAMPLE_RATE              8000UL
+
+/* Samples per Goertzel block, 205 at 8 kHz is the usual DTMF block (25.6 ms) */
+#define DTMF_CFG_BLOCK_SIZE               205U
+
+/* Minimum power of a tone, 8-bit samples : a full scale sine reaches about (N * 128 / 2)^2 */
+#define DTMF_CFG_MIN_POWER                200000UL
+
+/* The other tones of a group must be this many times weaker than the detected one (about 8 dB) */
+#define DTMF_CFG_PEAK_RATIO               6UL
+
+/* Highest power ratio between the row and the column tone (about 8 dB) */
+#define DTMF_CFG_TWIST_RATIO              6UL
+
+/* Events waiting for the application, must be a power of 2 */
+#define DTMF_CFG_EVENT_QUEUE_SIZE         8U
+
+/* Timer1/Timer3 pre-scaler of the CCP2 special event time base */
+#define DTMF_CFG_TIMER_PRESCALER          CCP_TIMER13_PRESCALER_DIV_BY_1
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_DTMF_CFG_H */
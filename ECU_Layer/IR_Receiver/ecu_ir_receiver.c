@@ -0,0 +1,486 @@
+/*
+ * File:   ecu_ir_receiver.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 1:40 PM
+ */
+
+#include "ecu_ir_receiver.h"
+
+/* Decoder states, named after the level expected to end on the next edge */
+#define IR_STATE_IDLE                     0x00U
+#define IR_STATE_LEADER_MARK              0x01U
+#define IR_STATE_NEC_LEADER_SPACE         0x02U
+#define IR_STATE_NEC_BIT_MARK             0x03U
+#define IR_STATE_NEC_BIT_SPACE            0x04U
+#define IR_STATE_RC5_MID1                 0x05U
+#define IR_STATE_RC5_START1               0x06U
+#define IR_STATE_RC5_MID0                 0x07U
+#define IR_STATE_RC5_START0               0x08U
+
+/* Protocol nominal timings in microseconds */
+#define IR_NEC_LEADER_MARK_US             9000UL
+#define IR_NEC_LEADER_SPACE_US            4500UL
+#define IR_NEC_REPEAT_SPACE_US            2250UL
+#define IR_NEC_BIT_MARK_US                562UL
+#define IR_NEC_ZERO_SPACE_US              562UL
+#define IR_NEC_ONE_SPACE_US               1687UL
+#define IR_NEC_FRAME_BITS                 32U
+
+#define IR_RC5_HALF_BIT_US                889UL
+#define IR_RC5_FULL_BIT_US                1778UL
+#define IR_RC5_FRAME_BITS                 14U
+
+/* Checks a duration in ticks against a nominal time with the configured tolerance */
+#define IR_DURATION_IS(_TICKS_, _US_) \
+            (((_TICKS_) >= IR_US_TO_TICKS(((_US_) * (100UL - IR_CFG_TOLERANCE_PERCENT)) / 100UL)) && \
+             ((_TICKS_) <= IR_US_TO_TICKS(((_US_) * (100UL + IR_CFG_TOLERANCE_PERCENT)) / 100UL)))
+
+#define IR_QUEUE_INDEX_MASK               (IR_CFG_QUEUE_SIZE - 1U)
+
+static volatile uint8 ir_state = IR_STATE_IDLE;
+static uint16 ir_last_timestamp = ZERO_INIT;
+/* Capture time base overflows since the last edge, saturates at 2 */
+static volatile uint8 ir_timer_overflows = ZERO_INIT;
+static uint32 ir_frame_data = ZERO_INIT;
+static uint8 ir_frame_bits = ZERO_INIT;
+
+/* Last frames, used for the NEC repeat code and the RC5 toggle bit */
+static ir_command_t ir_nec_last_command;
+static uint8 ir_nec_last_valid = ZERO_INIT;
+static uint8 ir_rc5_last_toggle = 0xFFU;
+
+/* Single producer (edge decoder) single consumer (application) queue */
+static ir_command_t ir_queue[IR_CFG_QUEUE_SIZE];
+static volatile uint8 ir_queue_head = ZERO_INIT;
+static volatile uint8 ir_queue_tail = ZERO_INIT;
+
+static void IR_Queue_Push(const ir_command_t *_command);
+static void IR_NEC_Frame_Complete(void);
+static void IR_RC5_Bit_Received(uint8 bit_value);
+
+/**
+ * @brief Decodes one edge of the receiver output.
+ * @param timestamp Capture time of the edge.
+ * @param level Pin level after the edge.
+ * @return Status of the function:
+ *         - E_OK: The edge was accepted by the decoder
+ *         - E_NOT_OK: Timing error, the decoder restarted
+ */
+Std_ReturnType IR_Receiver_Edge_Event(uint16 timestamp, uint8 level)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_duration = (uint16)(timestamp - ir_last_timestamp);
+    /* Level which just ended on this edge */
+    uint8 l_mark_ended = (IR_MARK_LEVEL != level) ? 1U : 0U;
+
+    /* Past one full wrap of the time base the 16-bit difference aliases to a short duration,
+       a half received frame this old is dropped and the edge starts from idle */
+    if((1U < ir_timer_overflows) || ((1U == ir_timer_overflows) && (timestamp >= ir_last_timestamp)))
+    {
+        ir_state = IR_STATE_IDLE;
+    }
+    else { /* Nothing */ }
+    ir_timer_overflows = ZERO_INIT;
+    ir_last_timestamp = timestamp;
+
+    switch(ir_state)
+    {
+        case IR_STATE_IDLE :
+            /* A frame always starts with a mark, the idle duration isn't measured */
+            if(ZERO_INIT == l_mark_ended)
+            {
+                ir_state = IR_STATE_LEADER_MARK;
+            }
+            else { /* Nothing */ }
+            break;
+
+        case IR_STATE_LEADER_MARK :
+            if(ZERO_INIT == l_mark_ended)
+            {
+                ret = E_NOT_OK;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_NEC_LEADER_MARK_US))
+            {
+                ir_state = IR_STATE_NEC_LEADER_SPACE;
+            }
+            /* RC5 : the first mark is the second half of S1, extended by the first half of S2 when S2 is 0 */
+            else if(IR_DURATION_IS(l_duration, IR_RC5_HALF_BIT_US))
+            {
+                ir_frame_data = 1U;
+                ir_frame_bits = 1U;
+                ir_state = IR_STATE_RC5_START1;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_RC5_FULL_BIT_US))
+            {
+                ir_frame_data = 1U;
+                ir_frame_bits = 1U;
+                ir_state = IR_STATE_RC5_MID0;
+                IR_RC5_Bit_Received(0U);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_NEC_LEADER_SPACE :
+            if(ZERO_INIT != l_mark_ended)
+            {
+                ret = E_NOT_OK;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_NEC_LEADER_SPACE_US))
+            {
+                ir_frame_data = ZERO_INIT;
+                ir_frame_bits = ZERO_INIT;
+                ir_state = IR_STATE_NEC_BIT_MARK;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_NEC_REPEAT_SPACE_US))
+            {
+                /* Repeat code, the key is still held */
+                if(ir_nec_last_valid)
+                {
+                    ir_nec_last_command.repeat = 1U;
+                    IR_Queue_Push(&ir_nec_last_command);
+                }
+                else { /* Nothing */ }
+                ir_state = IR_STATE_IDLE;
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_NEC_BIT_MARK :
+            if((ZERO_INIT != l_mark_ended) && IR_DURATION_IS(l_duration, IR_NEC_BIT_MARK_US))
+            {
+                ir_state = IR_STATE_NEC_BIT_SPACE;
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_NEC_BIT_SPACE :
+            /* Pulse distance coding, LSB first */
+            if(ZERO_INIT != l_mark_ended)
+            {
+                ret = E_NOT_OK;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_NEC_ZERO_SPACE_US))
+            {
+                ir_frame_data >>= 1;
+            }
+            else if(IR_DURATION_IS(l_duration, IR_NEC_ONE_SPACE_US))
+            {
+                ir_frame_data = (ir_frame_data >> 1) | 0x80000000UL;
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+
+            if(E_OK == ret)
+            {
+                ir_frame_bits++;
+                if(IR_NEC_FRAME_BITS == ir_frame_bits)
+                {
+                    /* The stop bit mark which just started is not needed */
+                    IR_NEC_Frame_Complete();
+                    ir_state = IR_STATE_IDLE;
+                }
+                else
+                {
+                    ir_state = IR_STATE_NEC_BIT_MARK;
+                }
+            }
+            else { /* Nothing */ }
+            break;
+
+        /* RC5 Manchester decoding, the edge in the middle of each bit carries its value */
+        case IR_STATE_RC5_MID1 :
+            if((ZERO_INIT != l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_HALF_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_START1;
+            }
+            else if((ZERO_INIT != l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_FULL_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_MID0;
+                IR_RC5_Bit_Received(0U);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_RC5_START1 :
+            if((ZERO_INIT == l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_HALF_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_MID1;
+                IR_RC5_Bit_Received(1U);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_RC5_MID0 :
+            if((ZERO_INIT == l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_HALF_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_START0;
+            }
+            else if((ZERO_INIT == l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_FULL_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_MID1;
+                IR_RC5_Bit_Received(1U);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        case IR_STATE_RC5_START0 :
+            if((ZERO_INIT != l_mark_ended) && IR_DURATION_IS(l_duration, IR_RC5_HALF_BIT_US))
+            {
+                ir_state = IR_STATE_RC5_MID0;
+                IR_RC5_Bit_Received(0U);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+            break;
+
+        default :
+            ret = E_NOT_OK;
+            break;
+    }
+
+    if(E_NOT_OK == ret)
+    {
+        /* Restart, a mark starting now may be the leader of the next frame */
+        ir_state = (ZERO_INIT == l_mark_ended) ? IR_STATE_LEADER_MARK : IR_STATE_IDLE;
+    }
+    else { /* Nothing */ }
+
+    return ret;
+}
+
+/**
+ * @brief Counts the capture time base overflows, drops a frame idle for a full wrap.
+ */
+void IR_Receiver_Timer_Overflow(void)
+{
+    if(1U >= ir_timer_overflows)
+    {
+        ir_timer_overflows++;
+    }
+    else { /* Nothing */ }
+
+    if(1U < ir_timer_overflows)
+    {
+        /* Gap timeout, a frame never pauses that long */
+        ir_state = IR_STATE_IDLE;
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Gets the oldest decoded command.
+ * @param _command Pointer to the decoded command.
+ * @return Status of the function:
+ *         - E_OK: A command was read
+ *         - E_NOT_OK: The queue is empty
+ */
+Std_ReturnType IR_Receiver_Read(ir_command_t *_command)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_tail = ir_queue_tail;
+
+    if(NULL == _command)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(l_tail == ir_queue_head)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_command = ir_queue[l_tail];
+        /* Release the slot only after the copy, the decoder may refill it right after */
+        ir_queue_tail = (uint8)((l_tail + 1U) & IR_QUEUE_INDEX_MASK);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Clears the decoder state and the command queue.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType IR_Receiver_Reset(void)
+{
+    ir_state = IR_STATE_IDLE;
+    ir_timer_overflows = ZERO_INIT;
+    ir_frame_data = ZERO_INIT;
+    ir_frame_bits = ZERO_INIT;
+    ir_nec_last_valid = ZERO_INIT;
+    ir_rc5_last_toggle = 0xFFU;
+    ir_queue_tail = ir_queue_head;
+
+    return E_OK;
+}
+
+static void IR_Queue_Push(const ir_command_t *_command)
+{
+    uint8 l_next_head = (uint8)((ir_queue_head + 1U) & IR_QUEUE_INDEX_MASK);
+
+    /* Queue full : the new command is dropped, the application is late anyway */
+    if(l_next_head != ir_queue_tail)
+    {
+        ir_queue[ir_queue_head] = *_command;
+        ir_queue_head = l_next_head;
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Checks the NEC frame : address, inverted address, command, inverted command.
+ */
+static void IR_NEC_Frame_Complete(void)
+{
+    uint8 l_address = (uint8)(ir_frame_data);
+    uint8 l_address_inverted = (uint8)(ir_frame_data >> 8);
+    uint8 l_command = (uint8)(ir_frame_data >> 16);
+    uint8 l_command_inverted = (uint8)(ir_frame_data >> 24);
+
+    if(0xFFU == (uint8)(l_command ^ l_command_inverted))
+    {
+        ir_nec_last_command.protocol = IR_PROTOCOL_NEC;
+        /* Extended NEC uses the inverted address byte as the address high byte */
+        if(0xFFU == (uint8)(l_address ^ l_address_inverted))
+        {
+            ir_nec_last_command.address = l_address;
+        }
+        else
+        {
+            ir_nec_last_command.address = (uint16)(ir_frame_data & 0xFFFFUL);
+        }
+        ir_nec_last_command.command = l_command;
+        ir_nec_last_command.repeat = ZERO_INIT;
+        ir_nec_last_valid = 1U;
+        IR_Queue_Push(&ir_nec_last_command);
+    }
+    else
+    {
+        ir_nec_last_valid = ZERO_INIT;
+    }
+}
+
+/**
+ * @brief Stores one RC5 bit, MSB first : S1, S2, toggle, 5 address bits, 6 command bits.
+ */
+static void IR_RC5_Bit_Received(uint8 bit_value)
+{
+    ir_command_t l_command;
+    uint8 l_toggle = ZERO_INIT;
+    uint16 l_frame = ZERO_INIT;
+
+    ir_frame_data = (ir_frame_data << 1) | bit_value;
+    ir_frame_bits++;
+
+    if(IR_RC5_FRAME_BITS == ir_frame_bits)
+    {
+        l_frame = (uint16)ir_frame_data;
+        l_toggle = (uint8)((l_frame >> 11) & 0x01U);
+
+        l_command.protocol = IR_PROTOCOL_RC5;
+        l_command.address = (uint16)((l_frame >> 6) & 0x1FU);
+        /* S2 is the inverted 7th command bit (RC5 extended) */
+        l_command.command = (uint8)((l_frame & 0x3FU) | ((l_frame & 0x1000U) ? 0x00U : 0x40U));
+        l_command.repeat = (l_toggle == ir_rc5_last_toggle) ? 1U : 0U;
+        ir_rc5_last_toggle = l_toggle;
+        IR_Queue_Push(&l_command);
+
+        ir_state = IR_STATE_IDLE;
+    }
+    else { /* Nothing */ }
+}
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+
+static const ir_receiver_t *ir_active = NULL;
+static uint8 ir_capture_edge = CCP_CAPTURE_MODE_1_FALLING_EDGE;
+
+static void IR_Capture_ISR(void);
+
+/**
+ * @brief Starts capturing the receiver edges.
+ * @param _ir Pointer to the IR receiver configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType IR_Receiver_Init(ir_receiver_t *_ir)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _ir)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        IR_Receiver_Reset();
+
+        /* The line is idle (space), the first edge to catch starts a mark */
+        ir_capture_edge = (0U == IR_MARK_LEVEL) ? CCP_CAPTURE_MODE_1_FALLING_EDGE : CCP_CAPTURE_MODE_1_RISING_EDGE;
+        _ir->ir_ccp.ccp_mode = CCP_CAPTURE_MODE_SELECTED;
+        _ir->ir_ccp.ccp_mode_variant = ir_capture_edge;
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        _ir->ir_ccp.CCP1_InterruptHandler = (CCP1_INST == _ir->ir_ccp.ccp_inst) ? IR_Capture_ISR : NULL;
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        _ir->ir_ccp.CCP2_InterruptHandler = (CCP2_INST == _ir->ir_ccp.ccp_inst) ? IR_Capture_ISR : NULL;
+#endif
+        ir_active = _ir;
+        ret = CCP_Init(&(_ir->ir_ccp));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Capture handler, timestamps the edge and arms the opposite one.
+ */
+static void IR_Capture_ISR(void)
+{
+    uint16 l_timestamp = ZERO_INIT;
+    uint8 l_level = ZERO_INIT;
+
+    CCP_Capture_Mode_Read_Value(&(ir_active->ir_ccp), &l_timestamp);
+
+    if(CCP_CAPTURE_MODE_1_FALLING_EDGE == ir_capture_edge)
+    {
+        l_level = 0U;
+        ir_capture_edge = CCP_CAPTURE_MODE_1_RISING_EDGE;
+    }
+    else
+    {
+        l_level = 1U;
+        ir_capture_edge = CCP_CAPTURE_MODE_1_FALLING_EDGE;
+    }
+    CCP_Capture_Mode_Set_Edge(&(ir_active->ir_ccp), ir_capture_edge);
+
+    IR_Receiver_Edge_Event(l_timestamp, l_level);
+}
+#endif
@@ -0,0 +1,136 @@
+/*
+ * File:   ecu_ir_receiver.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 1:40 PM
+ */
+
+#ifndef ECU_IR_RECEIVER_H
+#define	ECU_IR_RECEIVER_H
+
+/* Section : Includes */
+#include "ecu_ir_receiver_cfg.h"
+
+/* Section: Macro Declarations */
+
+/* Pin level while the IR carrier is received (mark) */
+#if IR_CFG_ACTIVE_LOW
+#define IR_MARK_LEVEL                     0U
+#else
+#define IR_MARK_LEVEL                     1U
+#endif
+
+#if (IR_CFG_QUEUE_SIZE & (IR_CFG_QUEUE_SIZE - 1U)) != 0U
+#error "IR receiver : IR_CFG_QUEUE_SIZE must be a power of 2"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/**
+ * @brief Converts microseconds to capture time base ticks
+ * @note  (_XTAL_FREQ / 4000) / pre-scaler is the number of ticks per millisecond
+ */
+#define IR_US_TO_TICKS(_US_) \
+            ((uint16)(((uint32)(_US_) * ((_XTAL_FREQ / 4000UL) / IR_CFG_TIMER_PRESCALER)) / 1000UL))
+
+/* Section: Data Type Declarations */
+
+/**
+ * @enum ir_protocol_t
+ * @brief Protocol of a decoded IR command
+ */
+typedef enum
+{
+    IR_PROTOCOL_NEC = 0,
+    IR_PROTOCOL_RC5
+} ir_protocol_t;
+
+/**
+ * @struct ir_command_t
+ * @brief Decoded IR command
+ * @note  NEC : 8-bit address, or 16-bit for the extended NEC address.
+ *        RC5 : 5-bit address, 7-bit command (field bit included).
+ *        repeat is set for the NEC repeat code and for RC5 frames with an unchanged toggle bit.
+ */
+typedef struct
+{
+    ir_protocol_t protocol;
+    uint16 address;
+    uint8 command;
+    uint8 repeat;
+} ir_command_t;
+
+/**
+ * @struct ir_receiver_t
+ * @brief IR receiver configurations
+ * @note  ir_ccp : only ccp_inst and ccp_capture_timer are used, mode, variant and the
+ *        interrupt handler are set by IR_Receiver_Init().
+ */
+typedef struct
+{
+    ccp_t ir_ccp;                   /* Capture channel connected to the receiver output */
+} ir_receiver_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Decodes one edge of the receiver output.
+ * @details The NEC and RC5 state machine only works on the time between the edges,
+ *          it is called by the capture interrupt and can be fed with recorded
+ *          edge traces (timestamps in capture ticks) to replay a remote.
+ *          Decoded commands are pushed to the queue read by IR_Receiver_Read().
+ * @param timestamp Capture time of the edge, a single 16-bit wrap around is handled,
+ *        longer gaps are detected with IR_Receiver_Timer_Overflow().
+ * @param level Pin level after the edge.
+ * @return Status of the function:
+ *         - E_OK: The edge was accepted by the decoder
+ *         - E_NOT_OK: Timing error, the decoder restarted
+ */
+Std_ReturnType IR_Receiver_Edge_Event(uint16 timestamp, uint8 level);
+
+/**
+ * @brief Notifies the decoder of a capture time base overflow.
+ * @details Edge durations are 16-bit timestamp differences, after more than one full
+ *          wrap (65.5 ms at 1 tick = 1 us) they alias to a short, possibly valid, duration.
+ *          A half received frame is dropped on the second overflow without an edge, and
+ *          the next edge is measured from idle. Without these calls a single wrap is
+ *          still handled but a long gap can alias.
+ * @note  Matches the Timer1/Timer3 interrupt handler type, the capture timer must run
+ *        free (no preload) so an overflow is a 65536 ticks period.
+ */
+void IR_Receiver_Timer_Overflow(void);
+
+/**
+ * @brief Gets the oldest decoded command.
+ * @param _command Pointer to the decoded command.
+ * @return Status of the function:
+ *         - E_OK: A command was read
+ *         - E_NOT_OK: The queue is empty
+ */
+Std_ReturnType IR_Receiver_Read(ir_command_t *_command);
+
+/**
+ * @brief Clears the decoder state and the command queue.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType IR_Receiver_Reset(void);
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+/**
+ * @brief Starts capturing the receiver edges.
+ * @details Each capture interrupt reads the timestamp, switches to the opposite edge and
+ *          runs IR_Receiver_Edge_Event(), the application never waits on the IR line.
+ * @pre   Timer1/Timer3 (as selected by ir_ccp.ccp_capture_timer) is running in timer mode
+ *        with the IR_CFG_TIMER_PRESCALER pre-scaler, no preload, and its interrupt handler
+ *        calls IR_Receiver_Timer_Overflow().
+ * @param _ir Pointer to the IR receiver configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType IR_Receiver_Init(ir_receiver_t *_ir);
+#endif
+
+#endif	/* ECU_IR_RECEIVER_H */
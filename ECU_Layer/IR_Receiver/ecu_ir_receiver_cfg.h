@@ -0,0 +1,34 @@
+/*
+ * File:   ecu_ir_receiver_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 1:40 PM
+ */
+
+#ifndef ECU_IR_RECEIVER_CFG_H
+#define	ECU_IR_RECEIVER_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+
+/* Section: Macro Declarations */
+
+/* Decoded commands waiting for the application, must be a power of 2 */
+#define IR_CFG_QUEUE_SIZE                 8U
+
+/* Timer1/Timer3 pre-scaler of the capture time base, 1 tick = 1 us with an 8 MHz oscillator */
+#define IR_CFG_TIMER_PRESCALER            CCP_TIMER13_PRESCALER_DIV_BY_2
+
+/* 1 : demodulating receiver (TSOP like) pulling the pin low while the carrier is present */
+#define IR_CFG_ACTIVE_LOW                 1U
+
+/* Accepted timing error, in percent of the nominal duration */
+#define IR_CFG_TOLERANCE_PERCENT          25UL
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_IR_RECEIVER_CFG_H */
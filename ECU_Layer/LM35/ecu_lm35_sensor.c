@@ -7,6 +7,15 @@
 
 #include"ecu_lm35_sensor.h"
 
+/* 10 mV per Celsius : millivolts and 0.1 Celsius are the same number */
+static const adc_convert_t lm35_deci_celsius_convert = {
+    .convert_type = ADC_CONVERT_LINEAR,
+    .offset = 0,
+    .gain = ADC_CONVERT_MV_GAIN,
+    .table = NULL,
+    .table_size = 0
+};
+
 /**
  * @brief Initializes the LM35 sensor and associated ADC.
  * @param sensor Pointer to the LM35 sensor structure.
@@ -30,6 +39,7 @@ Std_ReturnType LM35_Init(LM35_Sensor_t *sensor)
         
         // Initialize the temperature variable to 0
         sensor->temperature = 0.0; 
+        sensor->temperature_deci_celsius = 0;
         
         ret =  E_OK;
     }
@@ -63,8 +73,9 @@ Std_ReturnType LM35_GetTemperatureCelsius(LM35_Sensor_t *sensor)
         adc_result_t conversion_result;
         Std_ReturnType ret = ADC_GetConversion_Blocking(&(sensor->adc_config), sensor->channel, &conversion_result);
         
-        sensor->temperature = (conversion_result * 4.88f);
-        sensor->temperature /= 10;
+        // Integer conversion, the float reading is only derived for the existing callers
+        ret = LM35_ConvertDeciCelsius(conversion_result, &(sensor->temperature_deci_celsius));
+        sensor->temperature = (float)sensor->temperature_deci_celsius / 10;
 #endif
         
         ret =  E_OK;
@@ -99,4 +110,28 @@ Std_ReturnType LM35_GetTemperatureFahrenheit(LM35_Sensor_t *sensor)
     }
     
     return ret; 
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Converts an LM35 conversion result to tenths of a degree Celsius.
+ * @param conversion_result The 10-bit conversion result of the LM35 channel.
+ * @param temperature Pointer to the temperature in 0.1 Celsius.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType LM35_ConvertDeciCelsius(adc_result_t conversion_result, sint32 *temperature)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if (NULL == temperature) 
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = ADC_Convert(&lm35_deci_celsius_convert, conversion_result, temperature);
+    }
+    
+    return ret;
+}
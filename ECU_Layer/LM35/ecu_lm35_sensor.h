@@ -20,10 +20,12 @@
 /**
  * @struct LM35_Sensor_t
  * @brief Structure to hold LM35 sensor data
+ * @note  temperature is kept for the existing callers, new code uses temperature_deci_celsius.
  */
 typedef struct 
 {
-    float temperature;              // Variable to store temperature reading
+    float temperature;              // Variable to store temperature reading (deprecated)
+    sint32 temperature_deci_celsius; // Last reading in 0.1 Celsius, integer
     adc_channel_select_t channel;   // ADC channel connected to the LM35 sensor
     adc_conf_t adc_config;          // ADC configuration 
 } LM35_Sensor_t;
@@ -42,6 +44,10 @@ Std_ReturnType LM35_Init(LM35_Sensor_t *sensor);
 
 /**
  * @brief Gets the latest temperature reading from the LM35 sensor in Celsius.
+ * @details The blocking conversion goes through LM35_ConvertDeciCelsius() and updates
+ *          temperature_deci_celsius, temperature is derived from it.
+ * @deprecated The float temperature pulls in the floating point library, use
+ *             temperature_deci_celsius or LM35_ConvertDeciCelsius().
  * @param sensor Pointer to the LM35 sensor structure.
  * @return Status of the function:
  *         - E_OK: Success
@@ -51,6 +57,8 @@ Std_ReturnType LM35_GetTemperatureCelsius(LM35_Sensor_t *sensor);
 
 /**
  * @brief Gets the latest temperature reading from the LM35 sensor in Fahrenheit.
+ * @details temperature_deci_celsius stays in Celsius.
+ * @deprecated Float only, use temperature_deci_celsius or LM35_ConvertDeciCelsius().
  * @param sensor Pointer to the LM35 sensor structure.
  * @return Status of the function:
  *         - E_OK: Success
@@ -58,5 +66,17 @@ Std_ReturnType LM35_GetTemperatureCelsius(LM35_Sensor_t *sensor);
  */
 Std_ReturnType LM35_GetTemperatureFahrenheit(LM35_Sensor_t *sensor);
 
+/**
+ * @brief Converts an LM35 conversion result to tenths of a degree Celsius.
+ * @details Integer only path for results taken from the ADC scan frames, the LM35 gives
+ *          10 mV per Celsius so the input millivolts are the temperature in 0.1 Celsius.
+ * @param conversion_result The 10-bit conversion result of the LM35 channel.
+ * @param temperature Pointer to the temperature in 0.1 Celsius.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType LM35_ConvertDeciCelsius(adc_result_t conversion_result, sint32 *temperature);
+
 #endif	/* ECU_LM35_SENSOR_H */
 
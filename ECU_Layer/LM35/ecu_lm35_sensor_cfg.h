@@ -10,6 +10,7 @@
 
 /* Section : Includes */
 #include "../../MCAL_Layer/ADC/hal_adc.h"
+#include "../../MCAL_Layer/ADC/hal_adc_convert.h"
 /* Section: Macro Declarations */
 
 /* Section: Macro Functions Declarations */
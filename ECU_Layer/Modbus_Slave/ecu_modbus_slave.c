@@ -0,0 +1,1008 @@
+/*
+ * File:   ecu_modbus_slave.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 1:10 AM
+ */
+
+#include "ecu_modbus_slave.h"
+#include "../../MCAL_Layer/mcal_shared_read.h"
+
+/* Frame states */
+#define MODBUS_STATE_IDLE                     0x00U
+#define MODBUS_STATE_RECEIVING                0x01U
+#define MODBUS_STATE_RESPONDING               0x02U   /* Request executed, response being sent */
+#define MODBUS_STATE_DRAINING                 0x03U   /* Last characters shifting out, driver still enabled */
+
+/* Register walk operations */
+#define MODBUS_WALK_CHECK_READ                0x00U
+#define MODBUS_WALK_READ                      0x01U
+#define MODBUS_WALK_CHECK_WRITE               0x02U
+#define MODBUS_WALK_WRITE                     0x03U
+
+/* Address, function code and CRC */
+#define MODBUS_MIN_FRAME                      4U
+/* Address, function, start, quantity and CRC of functions 3, 4 and 6 */
+#define MODBUS_FIXED_REQUEST_LENGTH           8U
+/* Address, function, start, quantity, byte count and CRC of function 16 */
+#define MODBUS_WRITE_MULTIPLE_HEADER          9U
+/* Address, function, byte count and CRC of a read response */
+#define MODBUS_READ_RESPONSE_HEADER           5U
+
+/* Quantity limits of the specification, and of the frame buffer */
+#define MODBUS_MAX_READ_QUANTITY              (((MODBUS_CFG_MAX_FRAME - MODBUS_READ_RESPONSE_HEADER) / 2U) < 125U ? \
+                                               ((MODBUS_CFG_MAX_FRAME - MODBUS_READ_RESPONSE_HEADER) / 2U) : 125U)
+#define MODBUS_MAX_WRITE_QUANTITY             (((MODBUS_CFG_MAX_FRAME - MODBUS_WRITE_MULTIPLE_HEADER) / 2U) < 123U ? \
+                                               ((MODBUS_CFG_MAX_FRAME - MODBUS_WRITE_MULTIPLE_HEADER) / 2U) : 123U)
+
+#define MODBUS_EEPROM_QUEUE_MASK              (MODBUS_CFG_EEPROM_QUEUE_SIZE - 1U)
+
+/* Timer0 counts up to the overflow, the interval is loaded as its complement */
+#define MODBUS_T0_INTERVAL(_TICKS_)           ((uint16)(0U - (_TICKS_)))
+
+/* CRC-16/MODBUS (polynomial 0xA001 reflected) of one byte */
+static const uint16 modbus_crc_table[256] = {
+    0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U,
+    0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U,
+    0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U,
+    0x0A00U, 0xCAC1U, 0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U,
+    0xD801U, 0x18C0U, 0x1980U, 0xD941U, 0x1B00U, 0xDBC1U, 0xDA81U, 0x1A40U,
+    0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U, 0x1DC0U, 0x1C80U, 0xDC41U,
+    0x1400U, 0xD4C1U, 0xD581U, 0x1540U, 0xD701U, 0x17C0U, 0x1680U, 0xD641U,
+    0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U, 0x1040U,
+    0xF001U, 0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U,
+    0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U, 0x3480U, 0xF441U,
+    0x3C00U, 0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U,
+    0xFA01U, 0x3AC0U, 0x3B80U, 0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U,
+    0x2800U, 0xE8C1U, 0xE981U, 0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U,
+    0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U, 0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U,
+    0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U, 0xE7C1U, 0xE681U, 0x2640U,
+    0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U, 0x2080U, 0xE041U,
+    0xA001U, 0x60C0U, 0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U, 0x6240U,
+    0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U, 0xA441U,
+    0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U,
+    0xAA01U, 0x6AC0U, 0x6B80U, 0xAB41U, 0x6900U, 0xA9C1U, 0xA881U, 0x6840U,
+    0x7800U, 0xB8C1U, 0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U,
+    0xBE01U, 0x7EC0U, 0x7F80U, 0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U,
+    0xB401U, 0x74C0U, 0x7580U, 0xB541U, 0x7700U, 0xB7C1U, 0xB681U, 0x7640U,
+    0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U, 0x71C0U, 0x7080U, 0xB041U,
+    0x5000U, 0x90C1U, 0x9181U, 0x5140U, 0x9301U, 0x53C0U, 0x5280U, 0x9241U,
+    0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U, 0x5440U,
+    0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U,
+    0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U, 0x59C0U, 0x5880U, 0x9841U,
+    0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U,
+    0x4E00U, 0x8EC1U, 0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U,
+    0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U,
+    0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U
+};
+
+static const modbus_slave_t *modbus_active = NULL;
+static volatile uint8 modbus_state = MODBUS_STATE_IDLE;
+
+/* Silent intervals in Timer0 ticks, from the achieved baud rate */
+static uint16 modbus_t35_ticks = ZERO_INIT;
+static uint16 modbus_gap_ticks = ZERO_INIT;
+static uint16 modbus_char_ticks = ZERO_INIT;
+
+/* Request, the CRC over the frame and its CRC leaves 0 */
+static uint8 modbus_rx_buffer[MODBUS_CFG_MAX_FRAME];
+static uint16 modbus_rx_count = ZERO_INIT;
+static uint16 modbus_rx_crc = ZERO_INIT;
+static uint8 modbus_rx_error = ZERO_INIT;
+
+/* Response, sent while it is built */
+static uint8 modbus_tx_buffer[MODBUS_CFG_MAX_FRAME];
+static volatile uint16 modbus_tx_length = ZERO_INIT;
+static uint16 modbus_tx_sent = ZERO_INIT;
+static uint16 modbus_tx_crc = ZERO_INIT;
+static volatile uint8 modbus_tx_building = ZERO_INIT;
+static uint8 modbus_tx_answer = ZERO_INIT;
+
+/* The response is pumped from the Timer0 and the transmit interrupts, one at a time */
+static volatile uint8 modbus_pumping = ZERO_INIT;
+static volatile uint8 modbus_pump_request = ZERO_INIT;
+
+/* EEPROM writes, queued by the request, committed by Modbus_Slave_Process() */
+static uint16 modbus_eeprom_queue_address[MODBUS_CFG_EEPROM_QUEUE_SIZE];
+static uint16 modbus_eeprom_queue_value[MODBUS_CFG_EEPROM_QUEUE_SIZE];
+static volatile uint8 modbus_eeprom_head = ZERO_INIT;
+static volatile uint8 modbus_eeprom_tail = ZERO_INIT;
+/* Byte of the tail entry being committed, 0 high, 1 low, and a write running on it */
+static uint8 modbus_eeprom_byte = ZERO_INIT;
+static uint8 modbus_eeprom_writing = ZERO_INIT;
+/* Set while Modbus_Slave_Process() uses the EEPROM registers, the requests stay out of them */
+static volatile uint8 modbus_eeprom_committing = ZERO_INIT;
+
+static volatile modbus_statistics_t modbus_statistics;
+
+static uint16 modbus_crc_update(uint16 _crc, uint8 _data);
+static void modbus_execute(void);
+static uint8 modbus_read_registers(modbus_table_t _table);
+static uint8 modbus_write_single(void);
+static uint8 modbus_write_multiple(void);
+static uint8 modbus_walk(modbus_table_t _table, uint16 _address, uint16 _quantity, uint8 _operation, const uint8 *_values);
+static const modbus_register_block_t *modbus_find_block(modbus_table_t _table, uint16 _address);
+static uint16 modbus_register_read(const modbus_register_block_t *_block, uint16 _offset);
+static void modbus_register_write(const modbus_register_block_t *_block, uint16 _offset, uint16 _value);
+static uint8 modbus_eeprom_free(void);
+static void modbus_tx_put(uint8 _data);
+static void modbus_tx_put_word(uint16 _data);
+static void modbus_tx_end(void);
+static void modbus_service(void);
+static void modbus_pump(void);
+static void modbus_driver_enable(logic_t _logic);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+#if TIMER0_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+static void Modbus_Rx_ISR(void);
+static void Modbus_Timer0_ISR(void);
+
+/**
+ * @brief Initializes the EUSART and Timer0 and starts answering requests.
+ * @param _slave Pointer to the slave configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure, or the interval doesn't fit in Timer0 at this baud rate
+ */
+Std_ReturnType Modbus_Slave_Init(modbus_slave_t *_slave)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_baudrate = ZERO_INIT;
+    sint32 l_error_ppm = ZERO_INIT;
+    uint32 l_t35_ticks = ZERO_INIT;
+    uint32 l_gap_us = ZERO_INIT;
+
+    if(NULL == _slave)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        modbus_active = NULL;
+
+        _slave->modbus_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+        _slave->modbus_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+        _slave->modbus_usart.usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_TX_DISABLE;
+        _slave->modbus_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+        _slave->modbus_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+        _slave->modbus_usart.usart_rx_cfg.usart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE;
+        _slave->modbus_usart.usart_rx_cfg.usart_rx_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+        /* Transmit buffer drained : queue the next response bytes */
+        _slave->modbus_usart.EUSART_TxDefaultInterruptHandler = modbus_service;
+        _slave->modbus_usart.EUSART_RxDefaultInterruptHandler = Modbus_Rx_ISR;
+        /* A broken character breaks the frame CRC, nothing more to do */
+        _slave->modbus_usart.EUSART_FramingErrorHandler = NULL;
+        _slave->modbus_usart.EUSART_OverrunErrorHandler = NULL;
+
+        _slave->frame_timer.TMR0_InterruptHandler = Modbus_Timer0_ISR;
+        _slave->frame_timer.prescaler_enable = TIMER0_PRESCALER_ENABLE_CFG;
+        _slave->frame_timer.prescaler_value = MODBUS_TIMER0_PRESCALER_SELECT;
+        _slave->frame_timer.timer0_mode = TIMER0_TIMER_MODE;
+        _slave->frame_timer.timer0_register_size = TIMER0_16BIT_REGISTER_MODE;
+        _slave->frame_timer.timer0_preload_value = ZERO_INIT;
+
+        ret = Modbus_Slave_Select(_slave);
+        if(E_OK == ret)
+        {
+            ret = EUSART_ASYNC_Init(&(_slave->modbus_usart));
+        }
+        else { /* Nothing */ }
+
+        if(E_OK == ret)
+        {
+            /* The intervals follow the rate the EUSART really runs at */
+            (void)EUSART_Get_Baud_Rate(&l_baudrate, &l_error_ppm);
+            if(l_baudrate > MODBUS_FIXED_TIMING_BAUDRATE)
+            {
+                l_t35_ticks = MODBUS_T0_US_TO_TICKS(MODBUS_FIXED_T35_US);
+                l_gap_us = MODBUS_FIXED_T15_US;
+            }
+            else
+            {
+                l_t35_ticks = MODBUS_T0_US_TO_TICKS(MODBUS_CHARS_TO_US(35U, l_baudrate));
+                l_gap_us = MODBUS_CHARS_TO_US(15U, l_baudrate);
+            }
+            /* The gaps are measured between the ends of the characters, one character later */
+            l_gap_us += MODBUS_CHARS_TO_US(10U, l_baudrate);
+
+            if((ZERO_INIT == l_baudrate) || (65000UL < l_t35_ticks))
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                modbus_t35_ticks = (uint16)l_t35_ticks;
+                modbus_gap_ticks = (uint16)MODBUS_T0_US_TO_TICKS(l_gap_us);
+                modbus_char_ticks = (uint16)MODBUS_T0_US_TO_TICKS(MODBUS_CHARS_TO_US(10U, l_baudrate));
+                ret = Timer0_Init(&(_slave->frame_timer));
+            }
+        }
+        else { /* Nothing */ }
+
+        if(E_OK != ret)
+        {
+            modbus_active = NULL;
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief EUSART receive handler, checks the character gaps and restarts the 3.5 character interval.
+ */
+static void Modbus_Rx_ISR(void)
+{
+    uint8 l_data = ZERO_INIT;
+    uint16 l_timer = ZERO_INIT;
+
+    while(E_OK == EUSART_ASYNC_ReadByteNonBlocking(&l_data))
+    {
+        if(MODBUS_STATE_RECEIVING == modbus_state)
+        {
+            (void)Timer0_Read_Value(&(modbus_active->frame_timer), &l_timer);
+            if((uint16)(l_timer - MODBUS_T0_INTERVAL(modbus_t35_ticks)) > modbus_gap_ticks)
+            {
+                modbus_rx_error = 1;
+            }
+            else { /* Nothing */ }
+        }
+        else { /* First character of a frame */ }
+
+        if(E_OK == Modbus_Slave_Rx_Byte(l_data))
+        {
+            (void)Timer0_Write_Value(&(modbus_active->frame_timer), MODBUS_T0_INTERVAL(modbus_t35_ticks));
+        }
+        else { /* Nothing */ }
+    }
+}
+
+/**
+ * @brief Timer0 handler : end of the frame, or end of the response.
+ */
+static void Modbus_Timer0_ISR(void)
+{
+    uint8 l_idle = ZERO_INIT;
+
+    switch(modbus_state)
+    {
+        case MODBUS_STATE_RECEIVING :
+            /* 3.5 characters of silence */
+            (void)Modbus_Slave_Frame_End();
+            break;
+
+        case MODBUS_STATE_DRAINING :
+            /* Release the bus once the stop bit of the last character is out */
+            (void)EUSART_ASYNC_TX_Idle(&l_idle);
+            if(l_idle)
+            {
+                modbus_driver_enable(GPIO_LOW);
+                modbus_state = MODBUS_STATE_IDLE;
+            }
+            else
+            {
+                (void)Timer0_Write_Value(&(modbus_active->frame_timer), MODBUS_T0_INTERVAL(modbus_char_ticks));
+            }
+            break;
+
+        default :
+            /* Free running overflow while idle */
+            break;
+    }
+}
+#endif
+#endif
+
+/**
+ * @brief Selects the slave answered by Modbus_Slave_Rx_Byte() / Modbus_Slave_Frame_End().
+ * @param _slave Pointer to the slave configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid configurations
+ */
+Std_ReturnType Modbus_Slave_Select(const modbus_slave_t *_slave)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    pin_config_t l_de_pin;
+
+    if((NULL == _slave) || (NULL == _slave->blocks) || (ZERO_INIT == _slave->block_count) ||
+       (MODBUS_BROADCAST_ADDRESS == _slave->slave_address) || (247U < _slave->slave_address))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        modbus_active = NULL;
+        modbus_state = MODBUS_STATE_IDLE;
+        modbus_tx_building = ZERO_INIT;
+        modbus_pumping = ZERO_INIT;
+        modbus_pump_request = ZERO_INIT;
+        /* Acknowledged EEPROM writes stay queued, they are still committed */
+        modbus_statistics.bus_messages = ZERO_INIT;
+        modbus_statistics.crc_errors = ZERO_INIT;
+        modbus_statistics.exceptions = ZERO_INIT;
+        modbus_statistics.slave_messages = ZERO_INIT;
+        ret = E_OK;
+
+        if(_slave->de_pin_used)
+        {
+            /* Receiving until the first response */
+            l_de_pin = _slave->de_pin;
+            l_de_pin.DIRECTION = GPIO_DIRECTION_OUTPUT;
+            l_de_pin.LOGIC = GPIO_LOW;
+            ret = gpio_pin_intialize(&l_de_pin);
+        }
+        else { /* Nothing */ }
+
+        if(E_OK == ret)
+        {
+            modbus_active = _slave;
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Adds one received byte to the current request.
+ * @param _data Received byte.
+ * @return Status of the function:
+ *         - E_OK: Byte stored
+ *         - E_NOT_OK: Ignored, the frame is too long or no slave is selected
+ */
+Std_ReturnType Modbus_Slave_Rx_Byte(uint8 _data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL == modbus_active) || (MODBUS_STATE_RESPONDING == modbus_state) ||
+       (MODBUS_STATE_DRAINING == modbus_state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(MODBUS_STATE_IDLE == modbus_state)
+        {
+            modbus_rx_count = ZERO_INIT;
+            modbus_rx_crc = 0xFFFFU;
+            modbus_rx_error = ZERO_INIT;
+            modbus_state = MODBUS_STATE_RECEIVING;
+        }
+        else { /* Nothing */ }
+
+        if(modbus_rx_count < MODBUS_CFG_MAX_FRAME)
+        {
+            modbus_rx_buffer[modbus_rx_count] = _data;
+            modbus_rx_count++;
+            modbus_rx_crc = modbus_crc_update(modbus_rx_crc, _data);
+        }
+        else
+        {
+            modbus_rx_error = 1;
+        }
+        /* Still part of the frame, the silent interval restarts */
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Ends the current request, executes it and starts the response.
+ * @return Status of the function:
+ *         - E_OK: A valid request to this slave was executed (exceptions included)
+ *         - E_NOT_OK: No frame, CRC or length error, or another slave address
+ */
+Std_ReturnType Modbus_Slave_Frame_End(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_address = ZERO_INIT;
+
+    if((NULL == modbus_active) || (MODBUS_STATE_RECEIVING != modbus_state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Characters are ignored until the response is out, the request is parsed in place */
+        modbus_state = MODBUS_STATE_RESPONDING;
+        modbus_tx_answer = ZERO_INIT;
+
+        if((modbus_rx_error) || (MODBUS_MIN_FRAME > modbus_rx_count) || (ZERO_INIT != modbus_rx_crc))
+        {
+            modbus_statistics.crc_errors++;
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            modbus_statistics.bus_messages++;
+            l_address = modbus_rx_buffer[0];
+            if((modbus_active->slave_address == l_address) || (MODBUS_BROADCAST_ADDRESS == l_address))
+            {
+                modbus_statistics.slave_messages++;
+                modbus_tx_answer = (uint8)(MODBUS_BROADCAST_ADDRESS != l_address);
+                modbus_execute();
+                ret = E_OK;
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+        }
+
+        if(ZERO_INIT == modbus_tx_answer)
+        {
+            modbus_state = MODBUS_STATE_IDLE;
+        }
+        else { /* Back to idle once the response is out */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Commits the EEPROM register writes.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Modbus_Slave_Process(void)
+{
+    uint8 l_tail = modbus_eeprom_tail;
+    uint16 l_address = ZERO_INIT;
+    uint8 l_value = ZERO_INIT;
+    uint8 l_stored = ZERO_INIT;
+    uint8 l_done = 1;
+
+    /* Set before the first register access, an interrupted request then answers busy */
+    modbus_eeprom_committing = 1;
+
+    if(modbus_eeprom_writing)
+    {
+        (void)Data_EEPROM_Write_Done(&l_done);
+        if(l_done)
+        {
+            modbus_eeprom_writing = ZERO_INIT;
+            modbus_eeprom_byte++;
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+
+    while((ZERO_INIT == modbus_eeprom_writing) && (l_tail != modbus_eeprom_head))
+    {
+        if(2U <= modbus_eeprom_byte)
+        {
+            /* Released once stored, until then the reads take the queued value */
+            modbus_eeprom_byte = ZERO_INIT;
+            l_tail = (uint8)((l_tail + 1U) & MODBUS_EEPROM_QUEUE_MASK);
+            modbus_eeprom_tail = l_tail;
+        }
+        else
+        {
+            l_address = (uint16)(modbus_eeprom_queue_address[l_tail] + modbus_eeprom_byte);
+            l_value = (ZERO_INIT == modbus_eeprom_byte) ? (uint8)(modbus_eeprom_queue_value[l_tail] >> 8) :
+                                                          (uint8)modbus_eeprom_queue_value[l_tail];
+
+            /* Unchanged bytes are not written again, it saves 4 ms and an erase/write cycle */
+            (void)Data_EEPROM_ReadByte(l_address, &l_stored);
+            if(l_value != l_stored)
+            {
+                (void)Data_EEPROM_Write_Start(l_address, l_value);
+                modbus_eeprom_writing = 1;
+            }
+            else
+            {
+                modbus_eeprom_byte++;
+            }
+        }
+    }
+
+    modbus_eeprom_committing = modbus_eeprom_writing;
+
+    return E_OK;
+}
+
+/**
+ * @brief Gets the slave counters.
+ * @param _statistics Pointer to the counters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Modbus_Slave_Get_Statistics(modbus_statistics_t *_statistics)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _statistics->bus_messages = MCAL_Read_Shared_U16(&(modbus_statistics.bus_messages));
+        _statistics->crc_errors = MCAL_Read_Shared_U16(&(modbus_statistics.crc_errors));
+        _statistics->exceptions = MCAL_Read_Shared_U16(&(modbus_statistics.exceptions));
+        _statistics->slave_messages = MCAL_Read_Shared_U16(&(modbus_statistics.slave_messages));
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief CRC-16/MODBUS, one byte with the table.
+ */
+static uint16 modbus_crc_update(uint16 _crc, uint8 _data)
+{
+    return (uint16)((_crc >> 8) ^ modbus_crc_table[(uint8)(_crc ^ _data)]);
+}
+
+/**
+ * @brief Executes the request, the response (or the exception) is sent while it is built.
+ */
+static void modbus_execute(void)
+{
+    uint8 l_function = modbus_rx_buffer[1];
+    uint8 l_exception = ZERO_INIT;
+
+    modbus_tx_length = ZERO_INIT;
+    modbus_tx_sent = ZERO_INIT;
+    modbus_tx_crc = 0xFFFFU;
+    modbus_tx_building = 1;
+    if(modbus_tx_answer)
+    {
+        modbus_driver_enable(GPIO_HIGH);
+    }
+    else { /* Nothing */ }
+    modbus_tx_put(modbus_rx_buffer[0]);
+
+    switch(l_function)
+    {
+        case MODBUS_FC_READ_HOLDING_REGISTERS :
+            l_exception = modbus_read_registers(MODBUS_TABLE_HOLDING);
+            break;
+
+        case MODBUS_FC_READ_INPUT_REGISTERS :
+            l_exception = modbus_read_registers(MODBUS_TABLE_INPUT);
+            break;
+
+        case MODBUS_FC_WRITE_SINGLE_REGISTER :
+            l_exception = modbus_write_single();
+            break;
+
+        case MODBUS_FC_WRITE_MULTIPLE_REGISTERS :
+            l_exception = modbus_write_multiple();
+            break;
+
+        default :
+            l_exception = MODBUS_EXCEPTION_ILLEGAL_FUNCTION;
+            break;
+    }
+
+    if(ZERO_INIT != l_exception)
+    {
+        modbus_tx_put((uint8)(l_function | 0x80U));
+        modbus_tx_put(l_exception);
+        modbus_statistics.exceptions++;
+    }
+    else { /* Nothing */ }
+
+    modbus_tx_end();
+}
+
+/**
+ * @brief Functions 3 and 4.
+ * @return Exception code, 0 when the registers were sent
+ */
+static uint8 modbus_read_registers(modbus_table_t _table)
+{
+    uint8 l_exception = ZERO_INIT;
+    uint16 l_start = (uint16)(((uint16)modbus_rx_buffer[2] << 8) | modbus_rx_buffer[3]);
+    uint16 l_quantity = (uint16)(((uint16)modbus_rx_buffer[4] << 8) | modbus_rx_buffer[5]);
+
+    if((MODBUS_FIXED_REQUEST_LENGTH != modbus_rx_count) || (ZERO_INIT == l_quantity) ||
+       (MODBUS_MAX_READ_QUANTITY < l_quantity))
+    {
+        l_exception = MODBUS_EXCEPTION_ILLEGAL_VALUE;
+    }
+    else
+    {
+        l_exception = modbus_walk(_table, l_start, l_quantity, MODBUS_WALK_CHECK_READ, NULL);
+        if(ZERO_INIT == l_exception)
+        {
+            modbus_tx_put(modbus_rx_buffer[1]);
+            modbus_tx_put((uint8)(l_quantity * 2U));
+            (void)modbus_walk(_table, l_start, l_quantity, MODBUS_WALK_READ, NULL);
+        }
+        else { /* Nothing */ }
+    }
+
+    return l_exception;
+}
+
+/**
+ * @brief Function 6, the response echoes the request.
+ * @return Exception code, 0 when the register was written
+ */
+static uint8 modbus_write_single(void)
+{
+    uint8 l_exception = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint16 l_address = (uint16)(((uint16)modbus_rx_buffer[2] << 8) | modbus_rx_buffer[3]);
+
+    if(MODBUS_FIXED_REQUEST_LENGTH != modbus_rx_count)
+    {
+        l_exception = MODBUS_EXCEPTION_ILLEGAL_VALUE;
+    }
+    else
+    {
+        l_exception = modbus_walk(MODBUS_TABLE_HOLDING, l_address, 1U, MODBUS_WALK_CHECK_WRITE, &modbus_rx_buffer[4]);
+        if(ZERO_INIT == l_exception)
+        {
+            (void)modbus_walk(MODBUS_TABLE_HOLDING, l_address, 1U, MODBUS_WALK_WRITE, &modbus_rx_buffer[4]);
+            for(l_index = 1U; l_index < 6U; l_index++)
+            {
+                modbus_tx_put(modbus_rx_buffer[l_index]);
+            }
+        }
+        else { /* Nothing */ }
+    }
+
+    return l_exception;
+}
+
+/**
+ * @brief Function 16, nothing is written unless every register can be.
+ * @return Exception code, 0 when the registers were written
+ */
+static uint8 modbus_write_multiple(void)
+{
+    uint8 l_exception = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint16 l_start = ZERO_INIT;
+    uint16 l_quantity = ZERO_INIT;
+
+    if(MODBUS_WRITE_MULTIPLE_HEADER > modbus_rx_count)
+    {
+        l_exception = MODBUS_EXCEPTION_ILLEGAL_VALUE;
+    }
+    else
+    {
+        l_start = (uint16)(((uint16)modbus_rx_buffer[2] << 8) | modbus_rx_buffer[3]);
+        l_quantity = (uint16)(((uint16)modbus_rx_buffer[4] << 8) | modbus_rx_buffer[5]);
+
+        if((ZERO_INIT == l_quantity) || (MODBUS_MAX_WRITE_QUANTITY < l_quantity) ||
+           ((l_quantity * 2U) != modbus_rx_buffer[6]) ||
+           ((MODBUS_WRITE_MULTIPLE_HEADER + (l_quantity * 2U)) != modbus_rx_count))
+        {
+            l_exception = MODBUS_EXCEPTION_ILLEGAL_VALUE;
+        }
+        else
+        {
+            l_exception = modbus_walk(MODBUS_TABLE_HOLDING, l_start, l_quantity, MODBUS_WALK_CHECK_WRITE, &modbus_rx_buffer[7]);
+            if(ZERO_INIT == l_exception)
+            {
+                (void)modbus_walk(MODBUS_TABLE_HOLDING, l_start, l_quantity, MODBUS_WALK_WRITE, &modbus_rx_buffer[7]);
+                for(l_index = 1U; l_index < 6U; l_index++)
+                {
+                    modbus_tx_put(modbus_rx_buffer[l_index]);
+                }
+            }
+            else { /* Nothing */ }
+        }
+    }
+
+    return l_exception;
+}
+
+/**
+ * @brief Runs one operation on consecutive registers, block by block.
+ * @details The block is only searched once per run of registers it holds. The check operations
+ *          return the exception the request gets, the read and write operations can't fail after them.
+ * @param _values Written values, high byte first (write operations only).
+ * @return Exception code, 0 when every register passed
+ */
+static uint8 modbus_walk(modbus_table_t _table, uint16 _address, uint16 _quantity, uint8 _operation, const uint8 *_values)
+{
+    uint8 l_exception = ZERO_INIT;
+    const modbus_register_block_t *l_block = NULL;
+    uint16 l_offset = ZERO_INIT;
+    uint16 l_run = ZERO_INIT;
+    uint16 l_value = ZERO_INIT;
+    uint8 l_eeprom_count = ZERO_INIT;
+
+    if(((uint32)_address + _quantity) > 0x10000UL)
+    {
+        l_exception = MODBUS_EXCEPTION_ILLEGAL_ADDRESS;
+    }
+    else
+    {
+        l_block = modbus_find_block(_table, _address);
+    }
+
+    while((ZERO_INIT == l_exception) && (ZERO_INIT != _quantity))
+    {
+        if(NULL == l_block)
+        {
+            l_exception = MODBUS_EXCEPTION_ILLEGAL_ADDRESS;
+        }
+        else if(((MODBUS_WALK_CHECK_WRITE == _operation) && (MODBUS_SOURCE_ADC == l_block->source)))
+        {
+            /* Read only storage */
+            l_exception = MODBUS_EXCEPTION_ILLEGAL_ADDRESS;
+        }
+        else if((MODBUS_WALK_CHECK_READ == _operation) && (MODBUS_SOURCE_EEPROM == l_block->source) &&
+                (modbus_eeprom_committing))
+        {
+            /* A commit owns EEADR / EEDATA, the master retries after the busy exception */
+            l_exception = MODBUS_EXCEPTION_SLAVE_BUSY;
+        }
+        else
+        {
+            l_offset = (uint16)(_address - l_block->start_address);
+            l_run = (uint16)(l_block->register_count - l_offset);
+            if(l_run > _quantity)
+            {
+                l_run = _quantity;
+            }
+            else { /* Nothing */ }
+            _address += l_run;
+            _quantity -= l_run;
+
+            while((ZERO_INIT == l_exception) && (ZERO_INIT != l_run))
+            {
+                if(NULL != _values)
+                {
+                    l_value = (uint16)(((uint16)_values[0] << 8) | _values[1]);
+                    _values += 2;
+                }
+                else { /* Nothing */ }
+
+                switch(_operation)
+                {
+                    case MODBUS_WALK_READ :
+                        modbus_tx_put_word(modbus_register_read(l_block, l_offset));
+                        break;
+
+                    case MODBUS_WALK_CHECK_WRITE :
+                        if((MODBUS_SOURCE_GPIO == l_block->source) && (1U < l_value))
+                        {
+                            l_exception = MODBUS_EXCEPTION_ILLEGAL_VALUE;
+                        }
+                        else if(MODBUS_SOURCE_EEPROM == l_block->source)
+                        {
+                            l_eeprom_count++;
+                        }
+                        else { /* Nothing */ }
+                        break;
+
+                    case MODBUS_WALK_WRITE :
+                        modbus_register_write(l_block, l_offset, l_value);
+                        break;
+
+                    default :
+                        /* Addresses only */
+                        break;
+                }
+                l_offset++;
+                l_run--;
+            }
+
+            if(ZERO_INIT != _quantity)
+            {
+                l_block = modbus_find_block(_table, _address);
+            }
+            else { /* Nothing */ }
+        }
+    }
+
+    if((ZERO_INIT == l_exception) && (l_eeprom_count > modbus_eeprom_free()))
+    {
+        l_exception = MODBUS_EXCEPTION_SLAVE_BUSY;
+    }
+    else { /* Nothing */ }
+
+    return l_exception;
+}
+
+/**
+ * @brief Block of the table holding the register.
+ * @return Pointer to the block, NULL when the address is not mapped
+ */
+static const modbus_register_block_t *modbus_find_block(modbus_table_t _table, uint16 _address)
+{
+    const modbus_register_block_t *l_block = NULL;
+    uint8 l_index = ZERO_INIT;
+
+    while((NULL == l_block) && (l_index < modbus_active->block_count))
+    {
+        if((_table == modbus_active->blocks[l_index].table) &&
+           (_address >= modbus_active->blocks[l_index].start_address) &&
+           ((uint16)(_address - modbus_active->blocks[l_index].start_address) < modbus_active->blocks[l_index].register_count))
+        {
+            l_block = &(modbus_active->blocks[l_index]);
+        }
+        else { /* Nothing */ }
+        l_index++;
+    }
+
+    return l_block;
+}
+
+static uint16 modbus_register_read(const modbus_register_block_t *_block, uint16 _offset)
+{
+    uint16 l_value = ZERO_INIT;
+    logic_t l_logic = GPIO_LOW;
+    adc_result_t l_result = ZERO_INIT;
+    uint8 l_byte = ZERO_INIT;
+    uint16 l_address = ZERO_INIT;
+    uint8 l_index = modbus_eeprom_tail;
+    uint8 l_queued = ZERO_INIT;
+
+    switch(_block->source)
+    {
+        case MODBUS_SOURCE_RAM :
+            l_value = _block->ram[_offset];
+            break;
+
+        case MODBUS_SOURCE_GPIO :
+            (void)gpio_pin_read_logic(&(_block->pins[_offset]), &l_logic);
+            l_value = (uint16)l_logic;
+            break;
+
+        case MODBUS_SOURCE_ADC :
+            (void)ADC_Filter_Read(&(_block->filters[_offset]), &l_result);
+            l_value = (uint16)l_result;
+            break;
+
+        case MODBUS_SOURCE_EEPROM :
+            l_address = (uint16)(_block->eeprom_address + (_offset * 2U));
+            /* The latest queued write wins over the stored value */
+            while(l_index != modbus_eeprom_head)
+            {
+                if(l_address == modbus_eeprom_queue_address[l_index])
+                {
+                    l_value = modbus_eeprom_queue_value[l_index];
+                    l_queued = 1;
+                }
+                else { /* Nothing */ }
+                l_index = (uint8)((l_index + 1U) & MODBUS_EEPROM_QUEUE_MASK);
+            }
+            if(ZERO_INIT == l_queued)
+            {
+                (void)Data_EEPROM_ReadByte(l_address, &l_byte);
+                l_value = (uint16)((uint16)l_byte << 8);
+                (void)Data_EEPROM_ReadByte((uint16)(l_address + 1U), &l_byte);
+                l_value |= l_byte;
+            }
+            else { /* Nothing */ }
+            break;
+
+        default :
+            break;
+    }
+
+    return l_value;
+}
+
+static void modbus_register_write(const modbus_register_block_t *_block, uint16 _offset, uint16 _value)
+{
+    uint8 l_head = modbus_eeprom_head;
+
+    switch(_block->source)
+    {
+        case MODBUS_SOURCE_RAM :
+            _block->ram[_offset] = _value;
+            break;
+
+        case MODBUS_SOURCE_GPIO :
+            (void)gpio_pin_write_logic(&(_block->pins[_offset]), (logic_t)_value);
+            break;
+
+        case MODBUS_SOURCE_EEPROM :
+            /* Room was checked with the request */
+            modbus_eeprom_queue_address[l_head] = (uint16)(_block->eeprom_address + (_offset * 2U));
+            modbus_eeprom_queue_value[l_head] = _value;
+            modbus_eeprom_head = (uint8)((l_head + 1U) & MODBUS_EEPROM_QUEUE_MASK);
+            break;
+
+        default :
+            break;
+    }
+}
+
+/**
+ * @brief Free entries of the EEPROM write queue, one entry is kept empty.
+ */
+static uint8 modbus_eeprom_free(void)
+{
+    return (uint8)(MODBUS_EEPROM_QUEUE_MASK - ((uint8)(modbus_eeprom_head - modbus_eeprom_tail) & MODBUS_EEPROM_QUEUE_MASK));
+}
+
+/**
+ * @brief Appends one byte to the response and sends what the EUSART can take.
+ */
+static void modbus_tx_put(uint8 _data)
+{
+    if(modbus_tx_length < MODBUS_CFG_MAX_FRAME)
+    {
+        modbus_tx_buffer[modbus_tx_length] = _data;
+        modbus_tx_crc = modbus_crc_update(modbus_tx_crc, _data);
+        modbus_tx_length++;
+    }
+    else { /* Quantities are limited to the frame buffer */ }
+    modbus_service();
+}
+
+static void modbus_tx_put_word(uint16 _data)
+{
+    modbus_tx_put((uint8)(_data >> 8));
+    modbus_tx_put((uint8)_data);
+}
+
+/**
+ * @brief Appends the CRC, low byte first.
+ */
+static void modbus_tx_end(void)
+{
+    uint16 l_crc = modbus_tx_crc;
+
+    modbus_tx_put((uint8)l_crc);
+    modbus_tx_put((uint8)(l_crc >> 8));
+    modbus_tx_building = ZERO_INIT;
+    modbus_service();
+}
+
+/**
+ * @brief Runs the pump unless it already runs in an interrupted context, which then loops once more.
+ */
+static void modbus_service(void)
+{
+    modbus_pump_request = 1;
+    while((modbus_pump_request) && (ZERO_INIT == modbus_pumping))
+    {
+        modbus_pumping = 1;
+        modbus_pump_request = ZERO_INIT;
+        modbus_pump();
+        modbus_pumping = ZERO_INIT;
+    }
+}
+
+/**
+ * @brief Queues the built response bytes to the EUSART while it has room.
+ */
+static void modbus_pump(void)
+{
+    uint16 l_free = ZERO_INIT;
+
+    if((MODBUS_STATE_RESPONDING == modbus_state) && (modbus_tx_answer))
+    {
+        (void)EUSART_ASYNC_TX_Free(&l_free);
+        while((ZERO_INIT != l_free) && (modbus_tx_sent < modbus_tx_length))
+        {
+            (void)EUSART_ASYNC_WriteByteNonBlocking(modbus_tx_buffer[modbus_tx_sent]);
+            modbus_tx_sent++;
+            l_free--;
+        }
+
+        if((ZERO_INIT == modbus_tx_building) && (modbus_tx_sent == modbus_tx_length))
+        {
+            /* Everything is queued, Timer0 waits for the end of the last character */
+            modbus_state = MODBUS_STATE_DRAINING;
+            (void)Timer0_Write_Value(&(modbus_active->frame_timer), MODBUS_T0_INTERVAL(modbus_char_ticks));
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+static void modbus_driver_enable(logic_t _logic)
+{
+    if(modbus_active->de_pin_used)
+    {
+        (void)gpio_pin_write_logic(&(modbus_active->de_pin), _logic);
+    }
+    else { /* Nothing */ }
+}
@@ -0,0 +1,225 @@
+/*
+ * File:   ecu_modbus_slave.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 1:10 AM
+ */
+
+#ifndef ECU_MODBUS_SLAVE_H
+#define	ECU_MODBUS_SLAVE_H
+
+/* Section : Includes */
+#include "ecu_modbus_slave_cfg.h"
+
+/* Section: Macro Declarations */
+
+/* Supported function codes */
+#define MODBUS_FC_READ_HOLDING_REGISTERS      0x03U
+#define MODBUS_FC_READ_INPUT_REGISTERS        0x04U
+#define MODBUS_FC_WRITE_SINGLE_REGISTER       0x06U
+#define MODBUS_FC_WRITE_MULTIPLE_REGISTERS    0x10U
+
+/* Exception codes */
+#define MODBUS_EXCEPTION_ILLEGAL_FUNCTION     0x01U
+#define MODBUS_EXCEPTION_ILLEGAL_ADDRESS      0x02U
+#define MODBUS_EXCEPTION_ILLEGAL_VALUE        0x03U
+#define MODBUS_EXCEPTION_SLAVE_BUSY           0x06U
+
+/* Requests to address 0 are executed by every slave and never answered */
+#define MODBUS_BROADCAST_ADDRESS              0x00U
+
+/* Silent intervals above 19200 baud are fixed by the specification */
+#define MODBUS_FIXED_TIMING_BAUDRATE          19200UL
+#define MODBUS_FIXED_T35_US                   1750UL
+#define MODBUS_FIXED_T15_US                   750UL
+
+/* Timer0 pre-scaler select matching MODBUS_CFG_TIMER0_PRESCALER */
+#if MODBUS_CFG_TIMER0_PRESCALER == 2UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_2
+#elif MODBUS_CFG_TIMER0_PRESCALER == 4UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_4
+#elif MODBUS_CFG_TIMER0_PRESCALER == 8UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_8
+#elif MODBUS_CFG_TIMER0_PRESCALER == 16UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_16
+#elif MODBUS_CFG_TIMER0_PRESCALER == 32UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_32
+#elif MODBUS_CFG_TIMER0_PRESCALER == 64UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_64
+#elif MODBUS_CFG_TIMER0_PRESCALER == 128UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_128
+#elif MODBUS_CFG_TIMER0_PRESCALER == 256UL
+#define MODBUS_TIMER0_PRESCALER_SELECT        TIMER0_PRESCALER_DIV_BY_256
+#else
+#error "Modbus : MODBUS_CFG_TIMER0_PRESCALER must be a power of 2 from 2 to 256"
+#endif
+
+#if (MODBUS_CFG_MAX_FRAME < 8U) || (MODBUS_CFG_MAX_FRAME > 256U)
+#error "Modbus : MODBUS_CFG_MAX_FRAME must be 8 to 256 bytes"
+#endif
+
+#if (MODBUS_CFG_EEPROM_QUEUE_SIZE == 0U) || ((MODBUS_CFG_EEPROM_QUEUE_SIZE & (MODBUS_CFG_EEPROM_QUEUE_SIZE - 1U)) != 0U)
+#error "Modbus : MODBUS_CFG_EEPROM_QUEUE_SIZE must be a power of 2"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Converts microseconds to Timer0 ticks */
+#define MODBUS_T0_US_TO_TICKS(_US_) \
+            ((uint32)(((uint32)(_US_) * ((_XTAL_FREQ / 4000UL) / MODBUS_CFG_TIMER0_PRESCALER)) / 1000UL))
+
+/* Length of _CHARS_ / 10 characters of 11 bits (start, 8 data, parity or second stop, stop) in microseconds */
+#define MODBUS_CHARS_TO_US(_CHARS_, _BAUD_)   (((uint32)(_CHARS_) * 1100000UL) / (uint32)(_BAUD_))
+
+/* Section: Data Type Declarations */
+
+/**
+ * @enum modbus_table_t
+ * @brief Register table of a block
+ * @note  Holding registers are read by function 3 and written by 6 and 16,
+ *        input registers are read only, by function 4.
+ */
+typedef enum
+{
+    MODBUS_TABLE_HOLDING = 0,
+    MODBUS_TABLE_INPUT
+} modbus_table_t;
+
+/**
+ * @enum modbus_source_t
+ * @brief Where the registers of a block are stored
+ */
+typedef enum
+{
+    MODBUS_SOURCE_RAM = 0,          /* One uint16 per register */
+    MODBUS_SOURCE_GPIO,             /* One pin per register, 0 or 1, written pins must be outputs */
+    MODBUS_SOURCE_ADC,              /* One filtered channel per register, read only */
+    MODBUS_SOURCE_EEPROM            /* Two bytes per register, high byte first */
+} modbus_source_t;
+
+/**
+ * @struct modbus_register_block_t
+ * @brief Range of consecutive registers with the same storage
+ * @note  Only the member matching the source is used. A request may span several blocks
+ *        as long as the addresses are contiguous.
+ */
+typedef struct
+{
+    modbus_table_t table;
+    modbus_source_t source;
+    uint16 start_address;           /* Protocol address of the first register */
+    uint16 register_count;
+    uint16 *ram;                    /* MODBUS_SOURCE_RAM */
+    const pin_config_t *pins;       /* MODBUS_SOURCE_GPIO */
+    const adc_filter_t *filters;    /* MODBUS_SOURCE_ADC, kept up to date by the ADC scan */
+    uint16 eeprom_address;          /* MODBUS_SOURCE_EEPROM */
+} modbus_register_block_t;
+
+/**
+ * @struct modbus_statistics_t
+ * @brief Slave counters, named after the Modbus diagnostic counters
+ */
+typedef struct
+{
+    uint16 bus_messages;            /* Frames with a valid CRC, whatever the address */
+    uint16 crc_errors;              /* Frames dropped on a CRC, length or character gap error */
+    uint16 exceptions;              /* Exception responses */
+    uint16 slave_messages;          /* Requests to this slave, broadcasts included */
+} modbus_statistics_t;
+
+/**
+ * @struct modbus_slave_t
+ * @brief Modbus RTU slave configurations
+ * @note  modbus_usart : baudrate, baudrate_gen_gonfig and the priorities are used, the rest is set
+ *        by Modbus_Slave_Init(). 8 data bits, parity is not supported by the EUSART driver.
+ *        frame_timer : only the priority is used, Timer0 is configured by Modbus_Slave_Init().
+ *        de_pin : RS-485 driver enable, driven high from the first response byte until the
+ *        last stop bit, used when de_pin_used is 1.
+ */
+typedef struct
+{
+    usart_t modbus_usart;
+    timer0_t frame_timer;
+    uint8 slave_address;                        /* 1 .. 247 */
+    uint8 de_pin_used;
+    pin_config_t de_pin;
+    const modbus_register_block_t *blocks;
+    uint8 block_count;
+} modbus_slave_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Selects the slave answered by Modbus_Slave_Rx_Byte() / Modbus_Slave_Frame_End().
+ * @details Called by Modbus_Slave_Init(), it can be used alone to replay recorded frames
+ *          without the EUSART and Timer0 interrupts. The parser state and counters are cleared.
+ * @param _slave Pointer to the slave configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid configurations
+ */
+Std_ReturnType Modbus_Slave_Select(const modbus_slave_t *_slave);
+
+/**
+ * @brief Adds one received byte to the current request.
+ * @details The CRC is updated byte by byte (table driven), the frame is only checked when
+ *          the silent interval ends it. Bytes are ignored while a response is being sent.
+ * @param _data Received byte.
+ * @return Status of the function:
+ *         - E_OK: Byte stored
+ *         - E_NOT_OK: Ignored, the frame is too long or no slave is selected
+ */
+Std_ReturnType Modbus_Slave_Rx_Byte(uint8 _data);
+
+/**
+ * @brief Ends the current request, executes it and starts the response.
+ * @details Called when the bus stays silent for 3.5 characters. The response is built in the
+ *          transmit buffer and the first bytes go to the EUSART before the registers after
+ *          them are read, so a long read starts answering right away.
+ * @return Status of the function:
+ *         - E_OK: A valid request to this slave was executed (exceptions included)
+ *         - E_NOT_OK: No frame, CRC or length error, or another slave address
+ */
+Std_ReturnType Modbus_Slave_Frame_End(void);
+
+/**
+ * @brief Commits the EEPROM register writes.
+ * @details The writes are queued by the request and committed here, from the main loop, one
+ *          byte at a time : each call starts the next changed byte or checks the end of the
+ *          running one (about 4 ms), it never waits. The interrupts are only disabled for the
+ *          unlock sequence, the slave keeps receiving and answering. While a byte is being
+ *          written, requests reading an EEPROM block get the slave busy exception (06).
+ *          Call it from the main loop until the queue is empty.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Modbus_Slave_Process(void);
+
+/**
+ * @brief Gets the slave counters.
+ * @param _statistics Pointer to the counters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Modbus_Slave_Get_Statistics(modbus_statistics_t *_statistics);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+#if TIMER0_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Initializes the EUSART and Timer0 and starts answering requests.
+ * @details Every received byte restarts Timer0 with the 3.5 character interval, its overflow
+ *          ends the frame. A gap above 1.5 characters inside a frame marks it as broken.
+ *          The response is sent from the Timer0 and EUSART transmit interrupts. Only one slave
+ *          can run, it owns the EUSART and Timer0 and its interrupt handler, so it can't run
+ *          with Ultrasonic_Init() which needs Timer0 as well.
+ * @param _slave Pointer to the slave configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure, or the interval doesn't fit in Timer0 at this baud rate
+ */
+Std_ReturnType Modbus_Slave_Init(modbus_slave_t *_slave);
+#endif
+#endif
+
+#endif	/* ECU_MODBUS_SLAVE_H */
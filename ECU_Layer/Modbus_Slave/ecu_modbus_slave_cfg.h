@@ -0,0 +1,35 @@
+/*
+ * File:   ecu_modbus_slave_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 1:10 AM
+ */
+
+#ifndef ECU_MODBUS_SLAVE_CFG_H
+#define	ECU_MODBUS_SLAVE_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/USART/hal_usart.h"
+#include "../../MCAL_Layer/Timer0/hal_timer0.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#include "../../MCAL_Layer/ADC/hal_adc_filter.h"
+#include "../../MCAL_Layer/EEPROM/hal_eeprom.h"
+
+/* Section: Macro Declarations */
+
+/* Largest request and response frame (ADU), address and CRC included, 8 .. 256 bytes */
+#define MODBUS_CFG_MAX_FRAME                  128U
+
+/* EEPROM register writes waiting for Modbus_Slave_Process(), power of 2 */
+#define MODBUS_CFG_EEPROM_QUEUE_SIZE          8U
+
+/* Timer0 pre-scaler timing the silent intervals, 2 gives 1 us ticks at 8 MHz */
+#define MODBUS_CFG_TIMER0_PRESCALER           2UL
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_MODBUS_SLAVE_CFG_H */
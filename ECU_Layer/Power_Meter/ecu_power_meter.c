@@ -0,0 +1,308 @@
+/*
+ * File:   ecu_power_meter.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 PM
+ */
+
+#include "ecu_power_meter.h"
+
+/* Mid-scale of the 10-bit converter, starting point of the DC offset tracking */
+#define POWER_METER_MID_SCALE                 512L
+
+/**
+ * Gain of the current alignment in Q16 : the mean of two samples 2 w T apart is cos(w T)
+ * times the sample in between, T the conversion period. cos(x) ~ 1 - x^2 / 2 with
+ * x = 2 pi f / fs, 2 pi^2 in Q16 is 1293636.
+ */
+#define POWER_METER_ALIGN_GAIN_Q16 \
+            (65536L - (sint32)((1293636UL * POWER_METER_CFG_MAINS_FREQUENCY * POWER_METER_CFG_MAINS_FREQUENCY) / \
+                               (POWER_METER_CFG_SAMPLE_RATE * POWER_METER_CFG_SAMPLE_RATE)))
+
+/* Sums of one mains cycle, samples relative to the offset of the previous cycle */
+typedef struct
+{
+    sint32 sum_v;
+    sint32 sum_i;
+    sint32 sum_vi;                          /* Voltage times twice the time aligned current */
+    uint32 sum_v2;
+    uint32 sum_i2;
+} power_meter_sums_t;
+
+static sint32 power_meter_offset_v = POWER_METER_MID_SCALE;
+static sint32 power_meter_offset_i = POWER_METER_MID_SCALE;
+static power_meter_sums_t power_meter_acc;
+static uint8 power_meter_count = ZERO_INIT;
+
+/* Current conversion of the previous pair, taken one conversion period before the voltage */
+static adc_result_t power_meter_last_current = (adc_result_t)POWER_METER_MID_SCALE;
+
+/* Last complete cycle, written by the interrupt before the sequence is incremented */
+static power_meter_sums_t power_meter_cycle;
+static volatile uint8 power_meter_sequence = ZERO_INIT;
+static volatile uint8 power_meter_cycle_valid = ZERO_INIT;
+
+static uint16 power_meter_isqrt(uint32 value);
+static sint32 power_meter_mul_div_n(sint32 sum, sint32 factor);
+
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+static const power_meter_t *power_meter_active = NULL;
+
+static void Power_Meter_Scan_ISR(void);
+
+/**
+ * @brief Initializes the ADC and the CCP2 trigger and starts metering.
+ * @param _meter Pointer to the meter configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Power_Meter_Init(power_meter_t *_meter)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    adc_channel_select_t l_channels[2];
+    adc_scan_cfg_t l_scan;
+
+    if((NULL == _meter) || (_meter->voltage_channel == _meter->current_channel))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        power_meter_active = _meter;
+        power_meter_offset_v = POWER_METER_MID_SCALE;
+        power_meter_offset_i = POWER_METER_MID_SCALE;
+        power_meter_acc.sum_v = ZERO_INIT;
+        power_meter_acc.sum_i = ZERO_INIT;
+        power_meter_acc.sum_vi = ZERO_INIT;
+        power_meter_acc.sum_v2 = ZERO_INIT;
+        power_meter_acc.sum_i2 = ZERO_INIT;
+        power_meter_count = ZERO_INIT;
+        power_meter_last_current = (adc_result_t)POWER_METER_MID_SCALE;
+        power_meter_cycle_valid = ZERO_INIT;
+
+        /* Results are read from the scan frames, the per conversion handler isn't used */
+        _meter->meter_adc.ADC_InterruptHandler = NULL;
+        _meter->meter_adc.adc_channel = _meter->voltage_channel;
+        _meter->meter_adc.result_format = ADC_RESULT_RIGHT;
+        ret = ADC_Init(&(_meter->meter_adc));
+
+        if(E_OK == ret)
+        {
+            /* Voltage then current, one channel per special event */
+            l_channels[0] = _meter->voltage_channel;
+            l_channels[1] = _meter->current_channel;
+            l_scan.ADC_ScanCompleteHandler = Power_Meter_Scan_ISR;
+            l_scan.channels = l_channels;
+            l_scan.oversampling = NULL;
+            l_scan.channel_count = 2;
+            l_scan.scan_mode = ADC_SCAN_TRIGGERED;
+            ret = ADC_Scan_Start(&(_meter->meter_adc), &l_scan);
+        }
+        else { /* Nothing */ }
+
+        if(E_OK == ret)
+        {
+            /* Only CCP2 starts the ADC on its special event */
+            _meter->sample_ccp.ccp_inst = CCP2_INST;
+            _meter->sample_ccp.ccp_mode = CCP_COMPARE_MODE_SELECTED;
+            _meter->sample_ccp.ccp_mode_variant = CCP_COMPARE_MODE_GEN_EVENT;
+            _meter->sample_ccp.special_event_frequency = POWER_METER_CFG_SAMPLE_RATE;
+            _meter->sample_ccp.special_event_timer_prescaler = POWER_METER_CFG_TIMER_PRESCALER;
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _meter->sample_ccp.CCP2_InterruptHandler = NULL;
+#endif
+            ret = CCP_Init(&(_meter->sample_ccp));
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Scan complete handler, one voltage/current pair is available.
+ */
+static void Power_Meter_Scan_ISR(void)
+{
+    adc_result_t l_frame[2];
+
+    if(E_OK == ADC_Scan_Read_Frame(&(power_meter_active->meter_adc), l_frame, NULL))
+    {
+        (void)Power_Meter_Add_Sample(l_frame[0], l_frame[1]);
+    }
+    else { /* Nothing */ }
+}
+#endif
+
+/**
+ * @brief Accumulates one voltage/current sample pair.
+ * @param voltage The voltage channel conversion result.
+ * @param current The current channel conversion result.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Power_Meter_Add_Sample(adc_result_t voltage, adc_result_t current)
+{
+    sint32 l_voltage = (sint32)voltage - power_meter_offset_v;
+    sint32 l_current = (sint32)current - power_meter_offset_i;
+    /* The currents converted one period before and after the voltage, summed : twice the
+       current at the voltage sampling time, the 5.6 degrees skew at 50 Hz doesn't reach the power */
+    sint32 l_current_aligned = ((sint32)power_meter_last_current - power_meter_offset_i) + l_current;
+
+    power_meter_last_current = current;
+    power_meter_acc.sum_v += l_voltage;
+    power_meter_acc.sum_i += l_current;
+    power_meter_acc.sum_vi += l_voltage * l_current_aligned;
+    power_meter_acc.sum_v2 += (uint32)(l_voltage * l_voltage);
+    power_meter_acc.sum_i2 += (uint32)(l_current * l_current);
+    power_meter_count++;
+
+    if(power_meter_count >= POWER_METER_SAMPLES_PER_CYCLE)
+    {
+        /* Publish the cycle, then the readers see the new sequence */
+        power_meter_cycle = power_meter_acc;
+        power_meter_sequence++;
+        power_meter_cycle_valid = 1;
+
+        /* The mean of this cycle becomes the offset of the next one */
+        power_meter_offset_v += power_meter_acc.sum_v / (sint32)POWER_METER_SAMPLES_PER_CYCLE;
+        power_meter_offset_i += power_meter_acc.sum_i / (sint32)POWER_METER_SAMPLES_PER_CYCLE;
+
+        power_meter_acc.sum_v = ZERO_INIT;
+        power_meter_acc.sum_i = ZERO_INIT;
+        power_meter_acc.sum_vi = ZERO_INIT;
+        power_meter_acc.sum_v2 = ZERO_INIT;
+        power_meter_acc.sum_i2 = ZERO_INIT;
+        power_meter_count = ZERO_INIT;
+    }
+    else { /* Nothing */ }
+
+    return E_OK;
+}
+
+/**
+ * @brief Computes the readings of the last complete mains cycle.
+ * @param _meter Pointer to the meter configurations.
+ * @param _reading Pointer to the readings.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: No complete cycle yet or invalid parameters
+ */
+Std_ReturnType Power_Meter_Get_Reading(const power_meter_t *_meter, power_meter_reading_t *_reading)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    power_meter_sums_t l_cycle;
+    uint8 l_sequence = ZERO_INIT;
+    uint32 l_v2 = ZERO_INIT;
+    uint32 l_i2 = ZERO_INIT;
+    sint32 l_vi = ZERO_INIT;
+    uint32 l_norm = ZERO_INIT;
+    sint32 l_power_factor = ZERO_INIT;
+
+    if((NULL == _meter) || (NULL == _reading))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT == power_meter_cycle_valid)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Copy again if the interrupt published a cycle meanwhile */
+        do
+        {
+            l_sequence = power_meter_sequence;
+            l_cycle = power_meter_cycle;
+        }while(l_sequence != power_meter_sequence);
+
+        /* Remove what's left of the DC offset : sum(x^2) - sum(x)^2 / N */
+        l_v2 = l_cycle.sum_v2 - (uint32)power_meter_mul_div_n(l_cycle.sum_v, l_cycle.sum_v);
+        l_i2 = l_cycle.sum_i2 - (uint32)power_meter_mul_div_n(l_cycle.sum_i, l_cycle.sum_i);
+        /* sum_vi holds twice the product, the aligned currents sum to about twice sum_i */
+        l_vi = (l_cycle.sum_vi - power_meter_mul_div_n(l_cycle.sum_v, 2L * l_cycle.sum_i)) / 2L;
+
+        /* RMS in counts with 4 fraction bits, then scaled by the Q10 gains */
+        _reading->voltage_rms = (uint16)(((uint32)power_meter_isqrt((l_v2 / POWER_METER_SAMPLES_PER_CYCLE) << 8) *
+                                          _meter->voltage_gain) >> 14);
+        _reading->current_rms = (uint16)(((uint32)power_meter_isqrt((l_i2 / POWER_METER_SAMPLES_PER_CYCLE) << 8) *
+                                          _meter->current_gain) >> 14);
+
+        /* Power factor = sum(v.i) / sqrt(sum(v^2) . sum(i^2)), per mille */
+        l_norm = (uint32)power_meter_isqrt(l_v2) * power_meter_isqrt(l_i2);
+        if(ZERO_INIT == l_norm)
+        {
+            l_power_factor = ZERO_INIT;
+        }
+        else if((l_vi < 2000000L) && (l_vi > -2000000L))
+        {
+            l_power_factor = (l_vi * 1000L) / (sint32)l_norm;
+        }
+        else
+        {
+            /* Large sums, |sum(v.i)| <= norm so norm / 1000 keeps 3 digits at least */
+            l_power_factor = l_vi / (sint32)(l_norm / 1000UL);
+        }
+        /* Undo the alignment gain, the cosine approximation is within 0.1 % down to 8 pairs per cycle */
+        l_power_factor = (l_power_factor * 65536L) / POWER_METER_ALIGN_GAIN_Q16;
+        if(l_power_factor > 1000L)
+        {
+            l_power_factor = 1000L;
+        }
+        else if(l_power_factor < -1000L)
+        {
+            l_power_factor = -1000L;
+        }
+        else { /* Nothing */ }
+        _reading->power_factor = l_power_factor;
+
+        /* 0.1 V x mA = 0.1 mW, / 1000 gives 0.1 VA */
+        _reading->apparent_power = ((uint32)_reading->voltage_rms * _reading->current_rms) / 1000UL;
+        _reading->real_power = ((sint32)_reading->apparent_power * l_power_factor) / 1000L;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief sum.factor / N without the 32-bit overflow of sum.factor.
+ * @note  |sum| <= 1023.N and |factor| <= 2046.N : sum = q.N + r gives q.factor + r.factor / N,
+ *        both products stay below 2^30 up to 255 pairs, sum^2 alone overflows above 45.
+ */
+static sint32 power_meter_mul_div_n(sint32 sum, sint32 factor)
+{
+    sint32 l_quotient = sum / (sint32)POWER_METER_SAMPLES_PER_CYCLE;
+    sint32 l_remainder = sum % (sint32)POWER_METER_SAMPLES_PER_CYCLE;
+
+    return (l_quotient * factor) + ((l_remainder * factor) / (sint32)POWER_METER_SAMPLES_PER_CYCLE);
+}
+
+/**
+ * @brief Integer square root, bit by bit.
+ */
+static uint16 power_meter_isqrt(uint32 value)
+{
+    uint32 l_root = ZERO_INIT;
+    uint32 l_bit = 1UL << 30;
+
+    while(l_bit > value)
+    {
+        l_bit >>= 2;
+    }
+    while(0UL != l_bit)
+    {
+        if(value >= (l_root + l_bit))
+        {
+            value -= l_root + l_bit;
+            l_root = (l_root >> 1) + l_bit;
+        }
+        else
+        {
+            l_root >>= 1;
+        }
+        l_bit >>= 2;
+    }
+    return (uint16)l_root;
+}
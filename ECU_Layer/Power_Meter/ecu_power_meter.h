@@ -0,0 +1,110 @@
+/*
+ * File:   ecu_power_meter.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 PM
+ */
+
+#ifndef ECU_POWER_METER_H
+#define	ECU_POWER_METER_H
+
+/* Section : Includes */
+#include "ecu_power_meter_cfg.h"
+
+/* Section: Macro Declarations */
+
+/* Voltage/current sample pairs in one mains cycle */
+#define POWER_METER_SAMPLES_PER_CYCLE         (POWER_METER_CFG_SAMPLE_RATE / (2UL * POWER_METER_CFG_MAINS_FREQUENCY))
+
+#if (POWER_METER_CFG_SAMPLE_RATE % (2UL * POWER_METER_CFG_MAINS_FREQUENCY)) != 0UL
+#error "Power meter : POWER_METER_CFG_SAMPLE_RATE must be a multiple of twice the mains frequency"
+#elif (POWER_METER_SAMPLES_PER_CYCLE < 8UL) || (POWER_METER_SAMPLES_PER_CYCLE > 255UL)
+#error "Power meter : 8 to 255 sample pairs per mains cycle are supported"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/**
+ * @struct power_meter_t
+ * @brief Voltage and current inputs of the meter
+ * @note  Both inputs are AC signals biased at mid-scale, the DC offset is tracked and removed.
+ *        The meter measures the feed of the loads switched by the RELAY_t outputs, a load switched
+ *        off simply reads 0 mA.
+ *        meter_adc : only voltage_reference (and manual timing if wanted) are used, Power_Meter_Init()
+ *        sets the rest. sample_ccp : only ccp_capture_timer is used, CCP2 runs the special event trigger.
+ *        voltage_gain / current_gain : 0.1 V / mA per count in Q10, that is units * 1024 / counts,
+ *        2^18 at most.
+ */
+typedef struct
+{
+    adc_conf_t meter_adc;                   /* ADC converting both inputs */
+    ccp_t sample_ccp;                       /* CCP2 special event, paces the conversions */
+    adc_channel_select_t voltage_channel;
+    adc_channel_select_t current_channel;
+    uint32 voltage_gain;                    /* 0.1 V per count, Q10 */
+    uint32 current_gain;                    /* mA per count, Q10 */
+} power_meter_t;
+
+/**
+ * @struct power_meter_reading_t
+ * @brief Values of the last complete mains cycle
+ */
+typedef struct
+{
+    uint16 voltage_rms;                     /* 0.1 V */
+    uint16 current_rms;                     /* mA */
+    uint32 apparent_power;                  /* 0.1 VA */
+    sint32 real_power;                      /* 0.1 W, negative when the power flows back */
+    sint32 power_factor;                    /* Per mille, -1000 .. 1000 */
+} power_meter_reading_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Accumulates one voltage/current sample pair.
+ * @details Adds the squares and the cross product of the offset free samples to 32-bit sums,
+ *          after POWER_METER_SAMPLES_PER_CYCLE pairs the sums of the cycle are published for
+ *          Power_Meter_Get_Reading(). Called from the ADC interrupt, it can be fed with
+ *          recorded samples as well.
+ *          The scan converts the current one conversion period after the voltage (312 us at
+ *          3200 conversions/s, 5.6 degrees at 50 Hz, 16 % of power error at a 0.5 power factor).
+ *          The cross product pairs each voltage with the mean of the current of the previous
+ *          pair and of this pair, taken one period before and after it.
+ * @param voltage The voltage channel conversion result.
+ * @param current The current channel conversion result.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Power_Meter_Add_Sample(adc_result_t voltage, adc_result_t current);
+
+/**
+ * @brief Computes the readings of the last complete mains cycle.
+ * @details The square roots and the scaling are done here, in the caller context, with
+ *          integer arithmetic only.
+ * @param _meter Pointer to the meter configurations.
+ * @param _reading Pointer to the readings.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: No complete cycle yet or invalid parameters
+ */
+Std_ReturnType Power_Meter_Get_Reading(const power_meter_t *_meter, power_meter_reading_t *_reading);
+
+#if (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/**
+ * @brief Initializes the ADC and the CCP2 trigger and starts metering.
+ * @details CCP2 starts a conversion every 1 / POWER_METER_CFG_SAMPLE_RATE second, the ADC scan
+ *          alternates the voltage and current channels and each pair is accumulated from the
+ *          ADC interrupt, the application only fetches the readings. Only one meter can run.
+ * @pre   Timer1/Timer3 (as selected by sample_ccp.ccp_capture_timer) is running in timer mode
+ *        with the POWER_METER_CFG_TIMER_PRESCALER pre-scaler.
+ * @param _meter Pointer to the meter configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Power_Meter_Init(power_meter_t *_meter);
+#endif
+
+#endif	/* ECU_POWER_METER_H */
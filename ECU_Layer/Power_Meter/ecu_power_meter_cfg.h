@@ -0,0 +1,32 @@
+/*
+ * File:   ecu_power_meter_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 PM
+ */
+
+#ifndef ECU_POWER_METER_CFG_H
+#define	ECU_POWER_METER_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/ADC/hal_adc.h"
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+
+/* Section: Macro Declarations */
+
+/* Conversions per second, the voltage and current channels alternate so each is sampled at half */
+#define POWER_METER_CFG_SAMPLE_RATE           3200UL
+
+/* Mains frequency in Hz, the readings are computed over one mains cycle */
+#define POWER_METER_CFG_MAINS_FREQUENCY       50UL
+
+/* Timer1/Timer3 pre-scaler of the CCP2 special event time base */
+#define POWER_METER_CFG_TIMER_PRESCALER       CCP_TIMER13_PRESCALER_DIV_BY_1
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_POWER_METER_CFG_H */
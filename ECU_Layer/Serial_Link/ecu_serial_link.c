@@ -0,0 +1,684 @@
+/*
+ * File:   ecu_serial_link.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:50 PM
+ */
+
+#include "ecu_serial_link.h"
+#include "../../MCAL_Layer/mcal_shared_read.h"
+
+/* COBS encoder phases */
+#define SERIAL_LINK_ENCODE_CODE               0x00U
+#define SERIAL_LINK_ENCODE_DATA               0x01U
+#define SERIAL_LINK_ENCODE_DELIMITER          0x02U
+
+/* Longest COBS block, code 0xFF is 254 data bytes without a zero after them */
+#define SERIAL_LINK_COBS_MAX_CODE             0xFFU
+
+/* Transmitted data frame, the payload stays in the caller buffer */
+static const uint8 *serial_link_tx_payload = NULL;
+static uint8 serial_link_tx_length = ZERO_INIT;
+static uint8 serial_link_tx_control = ZERO_INIT;
+static uint8 serial_link_tx_seq = ZERO_INIT;
+static uint16 serial_link_tx_crc = ZERO_INIT;
+static volatile serial_link_tx_status_t serial_link_tx_status = SERIAL_LINK_TX_IDLE;
+static volatile uint8 serial_link_tx_data_pending = ZERO_INIT;
+static uint8 serial_link_tx_retries = ZERO_INIT;
+static uint8 serial_link_tx_timer = ZERO_INIT;
+static volatile uint8 serial_link_ack_pending = ZERO_INIT;
+static volatile uint8 serial_link_ack_seq = ZERO_INIT;
+
+/* Encoder of the frame being sent, data or acknowledge */
+static uint8 serial_link_enc_active = ZERO_INIT;
+static uint8 serial_link_enc_is_data = ZERO_INIT;
+static uint8 serial_link_enc_phase = SERIAL_LINK_ENCODE_CODE;
+static uint8 serial_link_enc_control = ZERO_INIT;
+static uint8 serial_link_enc_seq = ZERO_INIT;
+static const uint8 *serial_link_enc_payload = NULL;
+static uint16 serial_link_enc_crc = ZERO_INIT;
+static uint16 serial_link_enc_length = ZERO_INIT;
+static uint16 serial_link_enc_index = ZERO_INIT;
+static uint8 serial_link_enc_block_left = ZERO_INIT;
+static uint8 serial_link_enc_code = ZERO_INIT;
+
+/* The encoder is run from the application and from the interrupts, one at a time */
+static volatile uint8 serial_link_pumping = ZERO_INIT;
+static volatile uint8 serial_link_pump_request = ZERO_INIT;
+
+/* Decoder, the payload (and the CRC after it) is written straight to the receive buffer */
+static uint8 serial_link_rx_buffer[SERIAL_LINK_CFG_MAX_PAYLOAD + 2U];
+static volatile uint8 serial_link_rx_ready = ZERO_INIT;
+static uint8 serial_link_rx_length = ZERO_INIT;
+static uint8 serial_link_rx_last_seq = ZERO_INIT;
+static uint8 serial_link_rx_seq_valid = ZERO_INIT;
+static uint8 serial_link_dec_started = ZERO_INIT;
+static uint8 serial_link_dec_error = ZERO_INIT;
+static uint8 serial_link_dec_storing = ZERO_INIT;
+static uint8 serial_link_dec_block_left = ZERO_INIT;
+static uint8 serial_link_dec_code = ZERO_INIT;
+static uint8 serial_link_dec_control = ZERO_INIT;
+static uint8 serial_link_dec_seq = ZERO_INIT;
+static uint16 serial_link_dec_count = ZERO_INIT;
+static uint16 serial_link_dec_crc = ZERO_INIT;
+
+static volatile serial_link_statistics_t serial_link_statistics;
+
+static uint16 serial_link_crc_update(uint16 _crc, uint8 _data);
+static void serial_link_service(void);
+static void serial_link_pump(void);
+static uint8 serial_link_arm(void);
+static uint8 serial_link_frame_byte(uint16 _index);
+static uint8 serial_link_encode_next(void);
+static void serial_link_block_end(void);
+static void serial_link_frame_sent(void);
+static void serial_link_decode_byte(uint8 _data);
+static void serial_link_frame_received(void);
+static void serial_link_decoder_reset(void);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+static void Serial_Link_Rx_ISR(void);
+
+/**
+ * @brief Initializes the EUSART and starts the link.
+ * @param _link Pointer to the link configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Serial_Link_Init(serial_link_t *_link)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _link)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _link->link_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+        _link->link_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+        _link->link_usart.usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_TX_DISABLE;
+        _link->link_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+        _link->link_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+        _link->link_usart.usart_rx_cfg.usart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE;
+        _link->link_usart.usart_rx_cfg.usart_rx_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+        /* Transmit buffer drained : encode the next bytes */
+        _link->link_usart.EUSART_TxDefaultInterruptHandler = serial_link_service;
+        _link->link_usart.EUSART_RxDefaultInterruptHandler = Serial_Link_Rx_ISR;
+        /* Framing errors and overruns are counted by the EUSART driver, the CRC drops the frame */
+        _link->link_usart.EUSART_FramingErrorHandler = NULL;
+        _link->link_usart.EUSART_OverrunErrorHandler = NULL;
+
+        serial_link_tx_status = SERIAL_LINK_TX_IDLE;
+        serial_link_tx_data_pending = ZERO_INIT;
+        serial_link_ack_pending = ZERO_INIT;
+        serial_link_enc_active = ZERO_INIT;
+        serial_link_rx_ready = ZERO_INIT;
+        serial_link_rx_seq_valid = ZERO_INIT;
+        serial_link_decoder_reset();
+
+        ret = EUSART_ASYNC_Init(&(_link->link_usart));
+    }
+
+    return ret;
+}
+
+/**
+ * @brief EUSART receive handler, decodes the buffered bytes.
+ */
+static void Serial_Link_Rx_ISR(void)
+{
+    uint8 l_data = ZERO_INIT;
+
+    while(E_OK == EUSART_ASYNC_ReadByteNonBlocking(&l_data))
+    {
+        (void)Serial_Link_Rx_Byte(l_data);
+    }
+}
+#endif
+
+/**
+ * @brief Sends one frame.
+ * @param _payload Pointer to the payload.
+ * @param _length Payload length, 0 .. SERIAL_LINK_CFG_MAX_PAYLOAD.
+ * @param _ack_request 1 to request an acknowledge and retransmit until it arrives.
+ * @return Status of the function:
+ *         - E_OK: The frame is being sent
+ *         - E_NOT_OK: The previous frame is not done or invalid parameters
+ */
+Std_ReturnType Serial_Link_Send(const uint8 *_payload, uint8 _length, uint8 _ack_request)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+    uint16 l_crc = 0xFFFFU;
+
+    if(((NULL == _payload) && (ZERO_INIT != _length)) || (SERIAL_LINK_CFG_MAX_PAYLOAD < _length))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((SERIAL_LINK_TX_SENDING == serial_link_tx_status) || (SERIAL_LINK_TX_WAIT_ACK == serial_link_tx_status))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        serial_link_tx_seq++;
+        serial_link_tx_control = (_ack_request) ? SERIAL_LINK_CONTROL_ACK_REQUEST : ZERO_INIT;
+        serial_link_tx_payload = _payload;
+        serial_link_tx_length = _length;
+        serial_link_tx_retries = ZERO_INIT;
+
+        /* The CRC is computed once here, the retransmissions reuse it */
+        l_crc = serial_link_crc_update(l_crc, serial_link_tx_control);
+        l_crc = serial_link_crc_update(l_crc, serial_link_tx_seq);
+        for(l_index = 0; l_index < _length; l_index++)
+        {
+            l_crc = serial_link_crc_update(l_crc, _payload[l_index]);
+        }
+        serial_link_tx_crc = l_crc;
+
+        serial_link_tx_status = SERIAL_LINK_TX_SENDING;
+        serial_link_tx_data_pending = 1;
+        serial_link_service();
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Gets the state of the last sent frame.
+ * @param _status Pointer to the transmit status.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Serial_Link_Tx_Status(serial_link_tx_status_t *_status)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_status = serial_link_tx_status;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Gets the last received frame.
+ * @param _payload Pointer to the payload address.
+ * @param _length Pointer to the payload length.
+ * @return Status of the function:
+ *         - E_OK: A frame is available
+ *         - E_NOT_OK: No frame or invalid parameters
+ */
+Std_ReturnType Serial_Link_Receive(const uint8 **_payload, uint8 *_length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL == _payload) || (NULL == _length))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT == serial_link_rx_ready)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_payload = serial_link_rx_buffer;
+        *_length = serial_link_rx_length;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Frees the receive buffer for the next frame.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Serial_Link_Release(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    serial_link_rx_ready = ZERO_INIT;
+
+    return ret;
+}
+
+/**
+ * @brief Runs the acknowledge timeout, retransmits or reports the frame as failed.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Serial_Link_Tick(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    /* The acknowledge is handled by the receive interrupt, keep it out while the state changes */
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    EUSART_RX_InterruptDisable();
+#endif
+    if(SERIAL_LINK_TX_WAIT_ACK == serial_link_tx_status)
+    {
+        serial_link_tx_timer--;
+        if(ZERO_INIT == serial_link_tx_timer)
+        {
+            if(serial_link_tx_retries < SERIAL_LINK_CFG_RETRY_COUNT)
+            {
+                serial_link_tx_retries++;
+                serial_link_statistics.retransmissions++;
+                serial_link_tx_status = SERIAL_LINK_TX_SENDING;
+                serial_link_tx_data_pending = 1;
+                serial_link_service();
+            }
+            else
+            {
+                serial_link_statistics.tx_failures++;
+                serial_link_tx_status = SERIAL_LINK_TX_FAILED;
+            }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    EUSART_RX_InterruptEnable();
+#endif
+
+    return ret;
+}
+
+/**
+ * @brief Gets the link counters.
+ * @param _statistics Pointer to the counters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Serial_Link_Get_Statistics(serial_link_statistics_t *_statistics)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _statistics->tx_frames = MCAL_Read_Shared_U16(&(serial_link_statistics.tx_frames));
+        _statistics->retransmissions = MCAL_Read_Shared_U16(&(serial_link_statistics.retransmissions));
+        _statistics->tx_failures = MCAL_Read_Shared_U16(&(serial_link_statistics.tx_failures));
+        _statistics->rx_frames = MCAL_Read_Shared_U16(&(serial_link_statistics.rx_frames));
+        _statistics->crc_errors = MCAL_Read_Shared_U16(&(serial_link_statistics.crc_errors));
+        _statistics->rx_dropped = MCAL_Read_Shared_U16(&(serial_link_statistics.rx_dropped));
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Decodes one received byte.
+ * @param _data Received byte.
+ * @return Status of the function:
+ *         - E_OK: Byte accepted
+ *         - E_NOT_OK: A frame ended with an error and was dropped
+ */
+Std_ReturnType Serial_Link_Rx_Byte(uint8 _data)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(ZERO_INIT == _data)
+    {
+        /* Delimiter : the frame is complete, CRC-16 over the frame and its CRC leaves 0 */
+        if((ZERO_INIT == serial_link_dec_error) && (ZERO_INIT == serial_link_dec_block_left) &&
+           (SERIAL_LINK_FRAME_OVERHEAD <= serial_link_dec_count) && (ZERO_INIT == serial_link_dec_crc))
+        {
+            serial_link_frame_received();
+        }
+        else if(serial_link_dec_started)
+        {
+            serial_link_statistics.crc_errors++;
+            ret = E_NOT_OK;
+        }
+        else { /* Back to back delimiters, nothing to decode */ }
+        serial_link_decoder_reset();
+    }
+    else if(serial_link_dec_error)
+    {
+        /* Ignore the rest of a broken frame until the delimiter */
+    }
+    else if(ZERO_INIT == serial_link_dec_block_left)
+    {
+        /* COBS code byte, the previous block ended with a zero unless it was a full block */
+        if((serial_link_dec_started) && (SERIAL_LINK_COBS_MAX_CODE != serial_link_dec_code))
+        {
+            serial_link_decode_byte(ZERO_INIT);
+        }
+        else { /* Nothing */ }
+        serial_link_dec_started = 1;
+        serial_link_dec_code = _data;
+        serial_link_dec_block_left = (uint8)(_data - 1U);
+    }
+    else
+    {
+        serial_link_decode_byte(_data);
+        serial_link_dec_block_left--;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief CRC-16/CCITT (polynomial 0x1021), one byte without a table.
+ */
+static uint16 serial_link_crc_update(uint16 _crc, uint8 _data)
+{
+    uint16 l_x = ZERO_INIT;
+
+    l_x = (uint16)(((_crc >> 8) ^ _data) & 0xFFU);
+    l_x ^= (uint16)(l_x >> 4);
+    return (uint16)((_crc << 8) ^ (l_x << 12) ^ (l_x << 5) ^ l_x);
+}
+
+/**
+ * @brief Runs the encoder unless it already runs in an interrupted context, which then loops once more.
+ */
+static void serial_link_service(void)
+{
+    serial_link_pump_request = 1;
+    while((serial_link_pump_request) && (ZERO_INIT == serial_link_pumping))
+    {
+        serial_link_pumping = 1;
+        serial_link_pump_request = ZERO_INIT;
+        serial_link_pump();
+        serial_link_pumping = ZERO_INIT;
+    }
+}
+
+/**
+ * @brief Encodes bytes into the EUSART transmit buffer while it has room.
+ */
+static void serial_link_pump(void)
+{
+    uint16 l_free = ZERO_INIT;
+
+    (void)EUSART_ASYNC_TX_Free(&l_free);
+    while((ZERO_INIT != l_free) && ((serial_link_enc_active) || (serial_link_arm())))
+    {
+        (void)EUSART_ASYNC_WriteByteNonBlocking(serial_link_encode_next());
+        l_free--;
+    }
+}
+
+/**
+ * @brief Starts encoding the next frame, a pending acknowledge goes first.
+ * @return 1 when a frame was started
+ */
+static uint8 serial_link_arm(void)
+{
+    uint8 l_armed = 1;
+
+    if(serial_link_ack_pending)
+    {
+        serial_link_ack_pending = ZERO_INIT;
+        serial_link_enc_is_data = ZERO_INIT;
+        serial_link_enc_control = SERIAL_LINK_CONTROL_ACK;
+        serial_link_enc_seq = serial_link_ack_seq;
+        serial_link_enc_payload = NULL;
+        serial_link_enc_length = SERIAL_LINK_FRAME_OVERHEAD;
+        serial_link_enc_crc = serial_link_crc_update(serial_link_crc_update(0xFFFFU, serial_link_enc_control),
+                                                     serial_link_enc_seq);
+    }
+    else if(serial_link_tx_data_pending)
+    {
+        serial_link_tx_data_pending = ZERO_INIT;
+        serial_link_enc_is_data = 1;
+        serial_link_enc_control = serial_link_tx_control;
+        serial_link_enc_seq = serial_link_tx_seq;
+        serial_link_enc_payload = serial_link_tx_payload;
+        serial_link_enc_length = (uint16)(serial_link_tx_length + SERIAL_LINK_FRAME_OVERHEAD);
+        serial_link_enc_crc = serial_link_tx_crc;
+    }
+    else
+    {
+        l_armed = ZERO_INIT;
+    }
+
+    if(l_armed)
+    {
+        serial_link_enc_index = ZERO_INIT;
+        serial_link_enc_phase = SERIAL_LINK_ENCODE_CODE;
+        serial_link_enc_active = 1;
+    }
+    else { /* Nothing */ }
+
+    return l_armed;
+}
+
+/**
+ * @brief Byte of the frame before encoding : control, sequence, payload, CRC high, CRC low.
+ */
+static uint8 serial_link_frame_byte(uint16 _index)
+{
+    uint8 l_byte = ZERO_INIT;
+
+    if(0U == _index)
+    {
+        l_byte = serial_link_enc_control;
+    }
+    else if(1U == _index)
+    {
+        l_byte = serial_link_enc_seq;
+    }
+    else if(_index < (serial_link_enc_length - 2U))
+    {
+        l_byte = serial_link_enc_payload[_index - 2U];
+    }
+    else if(_index == (serial_link_enc_length - 2U))
+    {
+        l_byte = (uint8)(serial_link_enc_crc >> 8);
+    }
+    else
+    {
+        l_byte = (uint8)serial_link_enc_crc;
+    }
+
+    return l_byte;
+}
+
+/**
+ * @brief Next COBS encoded byte of the frame, the code byte looks ahead to the next zero.
+ */
+static uint8 serial_link_encode_next(void)
+{
+    uint8 l_byte = ZERO_INIT;
+    uint8 l_run = ZERO_INIT;
+
+    switch(serial_link_enc_phase)
+    {
+        case SERIAL_LINK_ENCODE_CODE :
+            while((l_run < (SERIAL_LINK_COBS_MAX_CODE - 1U)) &&
+                  ((serial_link_enc_index + l_run) < serial_link_enc_length) &&
+                  (ZERO_INIT != serial_link_frame_byte(serial_link_enc_index + l_run)))
+            {
+                l_run++;
+            }
+            serial_link_enc_code = (uint8)(l_run + 1U);
+            serial_link_enc_block_left = l_run;
+            l_byte = serial_link_enc_code;
+            if(ZERO_INIT != l_run)
+            {
+                serial_link_enc_phase = SERIAL_LINK_ENCODE_DATA;
+            }
+            else
+            {
+                serial_link_block_end();
+            }
+            break;
+
+        case SERIAL_LINK_ENCODE_DATA :
+            l_byte = serial_link_frame_byte(serial_link_enc_index);
+            serial_link_enc_index++;
+            serial_link_enc_block_left--;
+            if(ZERO_INIT == serial_link_enc_block_left)
+            {
+                serial_link_block_end();
+            }
+            else { /* Nothing */ }
+            break;
+
+        default :
+            /* Delimiter */
+            l_byte = ZERO_INIT;
+            serial_link_enc_active = ZERO_INIT;
+            serial_link_frame_sent();
+            break;
+    }
+
+    return l_byte;
+}
+
+/**
+ * @brief End of a COBS block, skips the zero it stands for.
+ */
+static void serial_link_block_end(void)
+{
+    if((SERIAL_LINK_COBS_MAX_CODE != serial_link_enc_code) && (serial_link_enc_index < serial_link_enc_length))
+    {
+        /* The zero is implied by the code, a zero as last byte still needs an empty block */
+        serial_link_enc_index++;
+        serial_link_enc_phase = SERIAL_LINK_ENCODE_CODE;
+    }
+    else if(serial_link_enc_index < serial_link_enc_length)
+    {
+        serial_link_enc_phase = SERIAL_LINK_ENCODE_CODE;
+    }
+    else
+    {
+        serial_link_enc_phase = SERIAL_LINK_ENCODE_DELIMITER;
+    }
+}
+
+/**
+ * @brief Last byte of a data frame queued, wait for the acknowledge if requested.
+ */
+static void serial_link_frame_sent(void)
+{
+    if(serial_link_enc_is_data)
+    {
+        if(serial_link_enc_control & SERIAL_LINK_CONTROL_ACK_REQUEST)
+        {
+            serial_link_tx_timer = SERIAL_LINK_CFG_ACK_TIMEOUT;
+            serial_link_tx_status = SERIAL_LINK_TX_WAIT_ACK;
+        }
+        else
+        {
+            serial_link_statistics.tx_frames++;
+            serial_link_tx_status = SERIAL_LINK_TX_IDLE;
+        }
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Stores one decoded byte and updates the CRC.
+ */
+static void serial_link_decode_byte(uint8 _data)
+{
+    serial_link_dec_crc = serial_link_crc_update(serial_link_dec_crc, _data);
+
+    if(0U == serial_link_dec_count)
+    {
+        serial_link_dec_control = _data;
+    }
+    else if(1U == serial_link_dec_count)
+    {
+        serial_link_dec_seq = _data;
+        /* A frame is only stored in a free buffer, the application may be reading the last one */
+        serial_link_dec_storing = (uint8)(ZERO_INIT == serial_link_rx_ready);
+    }
+    else if((serial_link_dec_count - 2U) < (SERIAL_LINK_CFG_MAX_PAYLOAD + 2U))
+    {
+        if(serial_link_dec_storing)
+        {
+            serial_link_rx_buffer[serial_link_dec_count - 2U] = _data;
+        }
+        else { /* Nothing */ }
+    }
+    else
+    {
+        /* Longer than any valid frame */
+        serial_link_dec_error = 1;
+    }
+    serial_link_dec_count++;
+}
+
+/**
+ * @brief Handles a frame with a valid CRC.
+ */
+static void serial_link_frame_received(void)
+{
+    uint8 l_acknowledge = ZERO_INIT;
+
+    if(serial_link_dec_control & SERIAL_LINK_CONTROL_ACK)
+    {
+        if((SERIAL_LINK_TX_WAIT_ACK == serial_link_tx_status) && (serial_link_dec_seq == serial_link_tx_seq))
+        {
+            serial_link_statistics.tx_frames++;
+            serial_link_tx_status = SERIAL_LINK_TX_IDLE;
+        }
+        else { /* Late or unexpected acknowledge */ }
+    }
+    else
+    {
+        if((serial_link_rx_seq_valid) && (serial_link_dec_seq == serial_link_rx_last_seq) &&
+           (serial_link_dec_control & SERIAL_LINK_CONTROL_ACK_REQUEST))
+        {
+            /* Our acknowledge was lost, the sender retried a frame already delivered */
+            l_acknowledge = 1;
+        }
+        else if((serial_link_dec_storing) && (ZERO_INIT == serial_link_rx_ready))
+        {
+            serial_link_rx_length = (uint8)(serial_link_dec_count - SERIAL_LINK_FRAME_OVERHEAD);
+            serial_link_rx_last_seq = serial_link_dec_seq;
+            serial_link_rx_seq_valid = 1;
+            serial_link_statistics.rx_frames++;
+            serial_link_rx_ready = 1;
+            l_acknowledge = (uint8)(serial_link_dec_control & SERIAL_LINK_CONTROL_ACK_REQUEST);
+        }
+        else
+        {
+            /* Not acknowledged, the sender will retry once the buffer is released */
+            serial_link_statistics.rx_dropped++;
+        }
+
+        if(l_acknowledge)
+        {
+            serial_link_ack_seq = serial_link_dec_seq;
+            serial_link_ack_pending = 1;
+            serial_link_service();
+        }
+        else { /* Nothing */ }
+    }
+}
+
+static void serial_link_decoder_reset(void)
+{
+    serial_link_dec_started = ZERO_INIT;
+    serial_link_dec_error = ZERO_INIT;
+    serial_link_dec_storing = ZERO_INIT;
+    serial_link_dec_block_left = ZERO_INIT;
+    serial_link_dec_code = ZERO_INIT;
+    serial_link_dec_count = ZERO_INIT;
+    serial_link_dec_crc = 0xFFFFU;
+}
@@ -0,0 +1,157 @@
+/*
+ * File:   ecu_serial_link.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:50 PM
+ */
+
+#ifndef ECU_SERIAL_LINK_H
+#define	ECU_SERIAL_LINK_H
+
+/* Section : Includes */
+#include "ecu_serial_link_cfg.h"
+
+/* Section: Macro Declarations */
+
+/* Frame control byte */
+#define SERIAL_LINK_CONTROL_ACK               0x01U   /* Acknowledge of the frame with the same sequence */
+#define SERIAL_LINK_CONTROL_ACK_REQUEST       0x02U   /* The receiver must acknowledge this frame */
+
+/* Control, sequence and CRC-16 around the payload */
+#define SERIAL_LINK_FRAME_OVERHEAD            4U
+
+#if (SERIAL_LINK_CFG_MAX_PAYLOAD < 1U) || (SERIAL_LINK_CFG_MAX_PAYLOAD > 250U)
+#error "Serial link : SERIAL_LINK_CFG_MAX_PAYLOAD must be 1 to 250 bytes"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/**
+ * @enum serial_link_tx_status_t
+ * @brief State of the last frame given to Serial_Link_Send()
+ */
+typedef enum
+{
+    SERIAL_LINK_TX_IDLE = 0,        /* Sent (and acknowledged if requested), a new frame can be sent */
+    SERIAL_LINK_TX_SENDING,         /* Being encoded to the EUSART */
+    SERIAL_LINK_TX_WAIT_ACK,        /* Sent, waiting for the acknowledge */
+    SERIAL_LINK_TX_FAILED           /* Not acknowledged after the retries, a new frame can be sent */
+} serial_link_tx_status_t;
+
+/**
+ * @struct serial_link_statistics_t
+ * @brief Link counters
+ */
+typedef struct
+{
+    uint16 tx_frames;               /* Data frames completely sent, retransmissions excluded */
+    uint16 retransmissions;
+    uint16 tx_failures;             /* Frames never acknowledged */
+    uint16 rx_frames;               /* Data frames delivered to the application */
+    uint16 crc_errors;              /* Frames dropped on a CRC or COBS error */
+    uint16 rx_dropped;              /* Frames dropped because the previous one was not released */
+} serial_link_statistics_t;
+
+/**
+ * @struct serial_link_t
+ * @brief Serial link configurations
+ * @note  link_usart : baudrate, baudrate_gen_gonfig and the priorities are used, the rest is set
+ *        by Serial_Link_Init(). The link owns the EUSART, no other code may write to it.
+ */
+typedef struct
+{
+    usart_t link_usart;
+} serial_link_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Decodes one received byte.
+ * @details The COBS decoder, the CRC-16 and the copy of the payload to the receive buffer are
+ *          done byte by byte, there is no frame buffer to decode afterwards. It is called from
+ *          the EUSART receive interrupt and can be fed with recorded streams as well.
+ *          Data frames requesting it are acknowledged, duplicates (same sequence as the last
+ *          delivered frame) are acknowledged again but not delivered.
+ * @param _data Received byte.
+ * @return Status of the function:
+ *         - E_OK: Byte accepted
+ *         - E_NOT_OK: A frame ended with an error and was dropped
+ */
+Std_ReturnType Serial_Link_Rx_Byte(uint8 _data);
+
+/**
+ * @brief Sends one frame.
+ * @details The frame is COBS encoded on the fly from the caller buffer into the EUSART transmit
+ *          buffer by the transmit interrupt, the payload is not copied. The buffer must not change
+ *          until the status leaves SERIAL_LINK_TX_SENDING / SERIAL_LINK_TX_WAIT_ACK, as it is read
+ *          again for the retransmissions.
+ * @param _payload Pointer to the payload.
+ * @param _length Payload length, 0 .. SERIAL_LINK_CFG_MAX_PAYLOAD.
+ * @param _ack_request 1 to request an acknowledge and retransmit until it arrives.
+ * @return Status of the function:
+ *         - E_OK: The frame is being sent
+ *         - E_NOT_OK: The previous frame is not done or invalid parameters
+ */
+Std_ReturnType Serial_Link_Send(const uint8 *_payload, uint8 _length, uint8 _ack_request);
+
+/**
+ * @brief Gets the state of the last sent frame.
+ * @param _status Pointer to the transmit status.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Serial_Link_Tx_Status(serial_link_tx_status_t *_status);
+
+/**
+ * @brief Gets the last received frame.
+ * @details The payload stays in the receive buffer, no copy is made. Frames arriving before
+ *          Serial_Link_Release() are dropped and not acknowledged, so the sender retries them.
+ * @param _payload Pointer to the payload address.
+ * @param _length Pointer to the payload length.
+ * @return Status of the function:
+ *         - E_OK: A frame is available
+ *         - E_NOT_OK: No frame or invalid parameters
+ */
+Std_ReturnType Serial_Link_Receive(const uint8 **_payload, uint8 *_length);
+
+/**
+ * @brief Frees the receive buffer for the next frame.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Serial_Link_Release(void);
+
+/**
+ * @brief Runs the acknowledge timeout, retransmits or reports the frame as failed.
+ * @details To be called periodically, SERIAL_LINK_CFG_ACK_TIMEOUT is counted in calls.
+ * @return Status of the function:
+ *         - E_OK: Success
+ */
+Std_ReturnType Serial_Link_Tick(void);
+
+/**
+ * @brief Gets the link counters.
+ * @param _statistics Pointer to the counters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Invalid parameters
+ */
+Std_ReturnType Serial_Link_Get_Statistics(serial_link_statistics_t *_statistics);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/**
+ * @brief Initializes the EUSART and starts the link.
+ * @details Both EUSART interrupts are enabled, the frames are decoded and encoded from them.
+ *          Only one link can run.
+ * @param _link Pointer to the link configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Serial_Link_Init(serial_link_t *_link);
+#endif
+
+#endif	/* ECU_SERIAL_LINK_H */
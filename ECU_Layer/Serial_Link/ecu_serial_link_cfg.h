@@ -0,0 +1,31 @@
+/*
+ * File:   ecu_serial_link_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 11:50 PM
+ */
+
+#ifndef ECU_SERIAL_LINK_CFG_H
+#define	ECU_SERIAL_LINK_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/USART/hal_usart.h"
+
+/* Section: Macro Declarations */
+
+/* Largest payload of one frame, 1 .. 250 bytes */
+#define SERIAL_LINK_CFG_MAX_PAYLOAD           64U
+
+/* Time without acknowledge before a frame is sent again, in Serial_Link_Tick() periods */
+#define SERIAL_LINK_CFG_ACK_TIMEOUT           50U
+
+/* Retransmissions of an unacknowledged frame before it is reported as failed */
+#define SERIAL_LINK_CFG_RETRY_COUNT           3U
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_SERIAL_LINK_CFG_H */
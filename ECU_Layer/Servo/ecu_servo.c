@@ -0,0 +1,305 @@
+/*
+ * File:   ecu_servo.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 AM
+ */
+
+#include "ecu_servo.h"
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+
+#define SERVO_PHASE_GAP                   0x00U
+#define SERVO_PHASE_PULSE                 0x01U
+
+#define SERVO_SLOT_TICKS                  SERVO_US_TO_TICKS(SERVO_SLOT_US)
+#define SERVO_CENTER_PULSE_US             ((SERVO_CFG_MIN_PULSE_US + SERVO_CFG_MAX_PULSE_US) / 2U)
+
+/* Servo group served by the compare interrupt */
+static const servo_t *servo_active = NULL;
+static volatile uint8 *servo_lat = NULL;
+static uint8 servo_pin_mask[SERVO_CFG_MAX_SERVOS];
+static uint8 servo_all_pins_mask = ZERO_INIT;
+
+/* Pulse widths in ticks, the ISR reads servo_ticks, the application writes servo_pending_ticks */
+static uint16 servo_ticks[SERVO_CFG_MAX_SERVOS];
+static volatile uint16 servo_pending_ticks[SERVO_CFG_MAX_SERVOS];
+static volatile uint8 servo_update_pending = ZERO_INIT;
+
+/* Slot starting at the next compare match and what that match ends */
+static volatile uint8 servo_slot = ZERO_INIT;
+static volatile uint8 servo_phase = SERVO_PHASE_GAP;
+
+static void Servo_Compare_ISR(void);
+static void Servo_Next_Slot(void);
+static void Servo_Lock(const servo_t *_servo);
+static void Servo_Unlock(const servo_t *_servo);
+
+/**
+ * @brief Initializes the servo pins and starts the pulse train.
+ * @param _servo Pointer to the servo group configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Init(servo_t *_servo)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+    pin_config_t l_servo_pin;
+
+    if((NULL == _servo) || (ZERO_INIT == _servo->servo_count) || (SERVO_CFG_MAX_SERVOS < _servo->servo_count) ||
+       (PORT_MAX_NUMBER <= _servo->port))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        servo_active = NULL;
+        servo_lat = LAT_REGESTERS[_servo->port];
+        servo_all_pins_mask = ZERO_INIT;
+
+        for(l_index = 0; l_index < SERVO_CFG_MAX_SERVOS; l_index++)
+        {
+            servo_pin_mask[l_index] = ZERO_INIT;
+            servo_ticks[l_index] = SERVO_US_TO_TICKS(SERVO_CENTER_PULSE_US);
+            servo_pending_ticks[l_index] = servo_ticks[l_index];
+        }
+        for(l_index = 0; l_index < _servo->servo_count; l_index++)
+        {
+            if(PIN_MAX_NUMBER <= _servo->pins[l_index])
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                l_servo_pin.PORT = _servo->port;
+                l_servo_pin.PIN = _servo->pins[l_index];
+                l_servo_pin.DIRECTION = GPIO_DIRECTION_OUTPUT;
+                l_servo_pin.LOGIC = GPIO_LOW;
+                gpio_pin_intialize(&l_servo_pin);
+                servo_pin_mask[l_index] = (uint8)(BIT_MASK << _servo->pins[l_index]);
+                servo_all_pins_mask |= servo_pin_mask[l_index];
+            }
+        }
+
+        if(E_OK == ret)
+        {
+            /* Each match resets the time base, so CCPRx always holds the next interval */
+            _servo->servo_ccp.ccp_mode = CCP_COMPARE_MODE_SELECTED;
+            _servo->servo_ccp.ccp_mode_variant = CCP_COMPARE_MODE_GEN_EVENT;
+            _servo->servo_ccp.special_event_frequency = ZERO_INIT;
+            _servo->servo_ccp.special_event_timer_prescaler = SERVO_CFG_TIMER_PRESCALER;
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _servo->servo_ccp.CCP1_InterruptHandler = (CCP1_INST == _servo->servo_ccp.ccp_inst) ? Servo_Compare_ISR : NULL;
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _servo->servo_ccp.CCP2_InterruptHandler = (CCP2_INST == _servo->servo_ccp.ccp_inst) ? Servo_Compare_ISR : NULL;
+#endif
+            servo_slot = ZERO_INIT;
+            servo_phase = SERVO_PHASE_GAP;
+            servo_update_pending = ZERO_INIT;
+            servo_active = _servo;
+
+            /* The first match opens slot 0 of the first frame */
+            ret = CCP_Compare_Mode_Set_Value(&(_servo->servo_ccp), (uint16)(SERVO_SLOT_TICKS - 1U));
+            if(E_OK == ret)
+            {
+                ret = CCP_Init(&(_servo->servo_ccp));
+            }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Stops the pulse train and drives all the servo pins low.
+ * @param _servo Pointer to the servo group configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_DeInit(const servo_t *_servo)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL == _servo) || (servo_active != _servo))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_DeInit(&(_servo->servo_ccp));
+        *servo_lat &= (uint8)~servo_all_pins_mask;
+        servo_active = NULL;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Requests a new pulse width for one servo, applied at the next frame boundary.
+ * @param _servo Pointer to the servo group configurations.
+ * @param channel Servo channel, 0 .. servo_count - 1.
+ * @param pulse_us Pulse width in microseconds or SERVO_PULSE_OFF.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Set_Pulse(const servo_t *_servo, uint8 channel, uint16 pulse_us)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL == _servo) || (servo_active != _servo) || (channel >= _servo->servo_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((SERVO_PULSE_OFF != pulse_us) &&
+            ((pulse_us < SERVO_CFG_MIN_PULSE_US) || (pulse_us > SERVO_CFG_MAX_PULSE_US)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 16-bit write, keep the compare interrupt out while it is half done */
+        Servo_Lock(_servo);
+        servo_pending_ticks[channel] = (SERVO_PULSE_OFF == pulse_us) ? ZERO_INIT : SERVO_US_TO_TICKS(pulse_us);
+        servo_update_pending = 1;
+        Servo_Unlock(_servo);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Requests a new angle for one servo, applied at the next frame boundary.
+ * @param _servo Pointer to the servo group configurations.
+ * @param channel Servo channel, 0 .. servo_count - 1.
+ * @param angle Servo angle in degrees, 0 .. 180.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Set_Angle(const servo_t *_servo, uint8 channel, uint8 angle)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_pulse_us = ZERO_INIT;
+
+    if(180U < angle)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_pulse_us = (uint16)(SERVO_CFG_MIN_PULSE_US +
+                     (((uint32)(SERVO_CFG_MAX_PULSE_US - SERVO_CFG_MIN_PULSE_US) * angle) / 180UL));
+        ret = Servo_Set_Pulse(_servo, channel, l_pulse_us);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Compare match handler, ends a pulse or opens the next slot.
+ * @note  The pin edge is written first, the interval of the next match is computed
+ *        from the reset time base, so only the latency jitter reaches the pulse width.
+ */
+static void Servo_Compare_ISR(void)
+{
+    uint16 l_slot_ticks = ZERO_INIT;
+
+    if(SERVO_PHASE_PULSE == servo_phase)
+    {
+        /* End of the pulse, the rest of the slot keeps the pin low */
+        *servo_lat &= (uint8)~servo_pin_mask[servo_slot];
+        CCP_Compare_Mode_Set_Value(&(servo_active->servo_ccp), (uint16)(SERVO_SLOT_TICKS - servo_ticks[servo_slot] - 1U));
+        servo_phase = SERVO_PHASE_GAP;
+        Servo_Next_Slot();
+    }
+    else
+    {
+        l_slot_ticks = servo_ticks[servo_slot];
+        if((servo_slot < servo_active->servo_count) && (ZERO_INIT != l_slot_ticks))
+        {
+            /* Start of the pulse */
+            *servo_lat |= servo_pin_mask[servo_slot];
+            CCP_Compare_Mode_Set_Value(&(servo_active->servo_ccp), (uint16)(l_slot_ticks - 1U));
+            servo_phase = SERVO_PHASE_PULSE;
+        }
+        else
+        {
+            /* Unused or stopped servo, the slot still takes its time so the frame stays 20 ms */
+            CCP_Compare_Mode_Set_Value(&(servo_active->servo_ccp), (uint16)(SERVO_SLOT_TICKS - 1U));
+            Servo_Next_Slot();
+        }
+    }
+}
+
+/**
+ * @brief Moves to the next slot and latches the new positions at the frame boundary.
+ * @note  Runs right after the next interval is loaded, so the copy never delays an edge.
+ */
+static void Servo_Next_Slot(void)
+{
+    uint8 l_index = ZERO_INIT;
+
+    servo_slot++;
+    if(SERVO_CFG_MAX_SERVOS <= servo_slot)
+    {
+        servo_slot = ZERO_INIT;
+        if(servo_update_pending)
+        {
+            for(l_index = 0; l_index < SERVO_CFG_MAX_SERVOS; l_index++)
+            {
+                servo_ticks[l_index] = servo_pending_ticks[l_index];
+            }
+            servo_update_pending = ZERO_INIT;
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+static void Servo_Lock(const servo_t *_servo)
+{
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(CCP1_INST == _servo->servo_ccp.ccp_inst)
+    {
+        CCP1_InterruptDisable();
+    }
+    else { /* Nothing */ }
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(CCP2_INST == _servo->servo_ccp.ccp_inst)
+    {
+        CCP2_InterruptDisable();
+    }
+    else { /* Nothing */ }
+#endif
+}
+
+static void Servo_Unlock(const servo_t *_servo)
+{
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(CCP1_INST == _servo->servo_ccp.ccp_inst)
+    {
+        CCP1_InterruptEnable();
+    }
+    else { /* Nothing */ }
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(CCP2_INST == _servo->servo_ccp.ccp_inst)
+    {
+        CCP2_InterruptEnable();
+    }
+    else { /* Nothing */ }
+#endif
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * File:   ecu_servo.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 AM
+ */
+
+#ifndef ECU_SERVO_H
+#define	ECU_SERVO_H
+
+/* Section : Includes */
+#include "ecu_servo_cfg.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+
+/* Section: Macro Declarations */
+
+/* Length of one servo slot, the 20 ms frame is shared by all the slots */
+#define SERVO_SLOT_US                     (SERVO_CFG_FRAME_US / SERVO_CFG_MAX_SERVOS)
+
+/* Pulse value which keeps the servo pin low (servo not driven) */
+#define SERVO_PULSE_OFF                   0U
+
+#if (SERVO_CFG_MAX_PULSE_US + 100U) > SERVO_SLOT_US
+#error "Servo : the maximum pulse doesn't fit in the slot, reduce SERVO_CFG_MAX_SERVOS"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/**
+ * @brief Converts microseconds to compare time base ticks
+ * @note  (_XTAL_FREQ / 4000) / pre-scaler is the number of ticks per millisecond
+ */
+#define SERVO_US_TO_TICKS(_US_) \
+            ((uint16)(((uint32)(_US_) * ((_XTAL_FREQ / 4000UL) / SERVO_CFG_TIMER_PRESCALER)) / 1000UL))
+
+/* Section: Data Type Declarations */
+
+/**
+ * @struct servo_t
+ * @brief Servo group driven from one CCP compare channel
+ * @note  All the servo pins must be on the same port so every edge is a single LAT write.
+ *        servo_ccp : only ccp_inst and ccp_capture_timer are used, mode, variant and the
+ *        interrupt handler are set by Servo_Init().
+ */
+typedef struct
+{
+    ccp_t servo_ccp;                            /* Compare channel generating the frame */
+    PORT_INDEX_t port;                          /* Port holding all the servo pins */
+    uint8 servo_count;                          /* Used servos, 1 .. SERVO_CFG_MAX_SERVOS */
+    PIN_INDEX_t pins[SERVO_CFG_MAX_SERVOS];     /* Servo channel to pin mapping */
+} servo_t;
+
+/* Section: Function Declarations */
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+/**
+ * @brief Initializes the servo pins and starts the pulse train.
+ * @details The frame is split in SERVO_CFG_MAX_SERVOS slots, each slot raises its servo pin,
+ *          the compare match ends the pulse and a second match ends the slot.
+ *          The compare special event resets the time base on each match, so the pulse width
+ *          doesn't depend on the interrupt latency. All the servos start centered.
+ *          Only one servo group can run at a time.
+ * @pre   Timer1/Timer3 (as selected by servo_ccp.ccp_capture_timer) is running in timer mode
+ *        with the SERVO_CFG_TIMER_PRESCALER pre-scaler and its interrupt disabled.
+ *        With CCP2 the special event also starts the ADC if it is enabled.
+ * @param _servo Pointer to the servo group configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Init(servo_t *_servo);
+
+/**
+ * @brief Stops the pulse train and drives all the servo pins low.
+ * @param _servo Pointer to the servo group configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_DeInit(const servo_t *_servo);
+
+/**
+ * @brief Requests a new pulse width for one servo.
+ * @details The value is buffered and applied at the next frame boundary,
+ *          so a frame never mixes old and new positions.
+ * @param _servo Pointer to the servo group configurations.
+ * @param channel Servo channel, 0 .. servo_count - 1.
+ * @param pulse_us Pulse width in microseconds (SERVO_CFG_MIN_PULSE_US .. SERVO_CFG_MAX_PULSE_US),
+ *                 or SERVO_PULSE_OFF to stop driving the servo.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Set_Pulse(const servo_t *_servo, uint8 channel, uint16 pulse_us);
+
+/**
+ * @brief Requests a new angle for one servo.
+ * @details The angle is mapped linearly on SERVO_CFG_MIN_PULSE_US .. SERVO_CFG_MAX_PULSE_US.
+ * @param _servo Pointer to the servo group configurations.
+ * @param channel Servo channel, 0 .. servo_count - 1.
+ * @param angle Servo angle in degrees, 0 .. 180.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Servo_Set_Angle(const servo_t *_servo, uint8 channel, uint8 angle);
+#endif
+
+#endif	/* ECU_SERVO_H */
@@ -0,0 +1,35 @@
+/*
+ * File:   ecu_servo_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 10:15 AM
+ */
+
+#ifndef ECU_SERVO_CFG_H
+#define	ECU_SERVO_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+
+/* Section: Macro Declarations */
+
+/* Number of time slots in the frame, one servo per slot */
+#define SERVO_CFG_MAX_SERVOS              8
+
+/* Servo frame period in microseconds (50 Hz) */
+#define SERVO_CFG_FRAME_US                20000UL
+
+/* Pulse width limits in microseconds, also used to map the angle 0 .. 180 */
+#define SERVO_CFG_MIN_PULSE_US            1000U
+#define SERVO_CFG_MAX_PULSE_US            2000U
+
+/* Timer1/Timer3 pre-scaler of the compare time base, 1 tick = 1 us with an 8 MHz oscillator */
+#define SERVO_CFG_TIMER_PRESCALER         CCP_TIMER13_PRESCALER_DIV_BY_2
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_SERVO_CFG_H */
@@ -0,0 +1,226 @@
+/*
+ * File:   ecu_ultrasonic.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "ecu_ultrasonic.h"
+#include "../../MCAL_Layer/mcal_shared_read.h"
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+#if TIMER0_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+
+/* Measurement cycle states */
+#define ULTRASONIC_STATE_HOLDOFF              0x00U
+#define ULTRASONIC_STATE_TRIGGER              0x01U
+#define ULTRASONIC_STATE_WAIT_RISE            0x02U
+#define ULTRASONIC_STATE_WAIT_FALL            0x03U
+
+/* Timer0 counts up to the overflow, the interval is loaded as its complement */
+#define ULTRASONIC_T0_INTERVAL(_US_)          ((uint16)(0U - ULTRASONIC_T0_US_TO_TICKS(_US_)))
+
+static const ultrasonic_t *ultrasonic_active = NULL;
+static volatile uint8 ultrasonic_state = ULTRASONIC_STATE_HOLDOFF;
+static volatile uint8 ultrasonic_current = ZERO_INIT;
+static uint16 ultrasonic_rise_time = ZERO_INIT;
+
+/* Latest echo width of each sensor in capture ticks, written by the capture interrupt */
+static volatile uint16 ultrasonic_echo_ticks[ULTRASONIC_CFG_MAX_SENSORS];
+static volatile uint8 ultrasonic_status[ULTRASONIC_CFG_MAX_SENSORS];
+
+static void Ultrasonic_Timer0_ISR(void);
+static void Ultrasonic_Capture_ISR(void);
+static void Ultrasonic_Start_Holdoff(void);
+
+/**
+ * @brief Initializes the sensors and starts the measurement cycle.
+ * @param _ultrasonic Pointer to the sensors configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Ultrasonic_Init(ultrasonic_t *_ultrasonic)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+    pin_config_t l_trigger_pin;
+
+    if((NULL == _ultrasonic) || (ZERO_INIT == _ultrasonic->sensor_count) ||
+       (ULTRASONIC_CFG_MAX_SENSORS < _ultrasonic->sensor_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ultrasonic_active = NULL;
+        ret = E_OK;
+
+        for(l_index = 0; l_index < _ultrasonic->sensor_count; l_index++)
+        {
+            l_trigger_pin = _ultrasonic->trigger_pins[l_index];
+            l_trigger_pin.DIRECTION = GPIO_DIRECTION_OUTPUT;
+            l_trigger_pin.LOGIC = GPIO_LOW;
+            if(E_OK != gpio_pin_intialize(&l_trigger_pin))
+            {
+                ret = E_NOT_OK;
+            }
+            else { /* Nothing */ }
+            ultrasonic_echo_ticks[l_index] = ZERO_INIT;
+            ultrasonic_status[l_index] = ULTRASONIC_STATUS_NOT_READY;
+        }
+
+        if(E_OK == ret)
+        {
+            /* Echo rising edge first, the capture only counts during the echo window */
+            _ultrasonic->echo_ccp.ccp_mode = CCP_CAPTURE_MODE_SELECTED;
+            _ultrasonic->echo_ccp.ccp_mode_variant = CCP_CAPTURE_MODE_1_RISING_EDGE;
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _ultrasonic->echo_ccp.CCP1_InterruptHandler = (CCP1_INST == _ultrasonic->echo_ccp.ccp_inst) ? Ultrasonic_Capture_ISR : NULL;
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            _ultrasonic->echo_ccp.CCP2_InterruptHandler = (CCP2_INST == _ultrasonic->echo_ccp.ccp_inst) ? Ultrasonic_Capture_ISR : NULL;
+#endif
+
+            /* The cycle starts with a hold-off, then sensor 0 is triggered */
+            _ultrasonic->sequencer_timer.TMR0_InterruptHandler = Ultrasonic_Timer0_ISR;
+            _ultrasonic->sequencer_timer.prescaler_enable = TIMER0_PRESCALER_ENABLE_CFG;
+            _ultrasonic->sequencer_timer.prescaler_value = ULTRASONIC_TIMER0_PRESCALER_SELECT;
+            _ultrasonic->sequencer_timer.timer0_mode = TIMER0_TIMER_MODE;
+            _ultrasonic->sequencer_timer.timer0_register_size = TIMER0_16BIT_REGISTER_MODE;
+            _ultrasonic->sequencer_timer.timer0_preload_value = ULTRASONIC_T0_INTERVAL(ULTRASONIC_CFG_HOLDOFF_US);
+
+            ultrasonic_current = (uint8)(_ultrasonic->sensor_count - 1U);
+            ultrasonic_state = ULTRASONIC_STATE_HOLDOFF;
+            ultrasonic_active = _ultrasonic;
+
+            ret = CCP_Init(&(_ultrasonic->echo_ccp));
+            if(E_OK == ret)
+            {
+                ret = Timer0_Init(&(_ultrasonic->sequencer_timer));
+            }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Gets the latest distance measured by one sensor.
+ * @param _ultrasonic Pointer to the sensors configurations.
+ * @param sensor_index Sensor index, 0 .. sensor_count - 1.
+ * @param distance_mm Pointer to the distance in millimeters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: No reading yet, no echo in the window, or invalid parameters
+ */
+Std_ReturnType Ultrasonic_Get_Distance(const ultrasonic_t *_ultrasonic, uint8 sensor_index, uint16 *distance_mm)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_echo_ticks = ZERO_INIT;
+    uint32 l_echo_us = ZERO_INIT;
+    sint32 l_temperature = ULTRASONIC_CFG_DEFAULT_TEMPERATURE;
+    sint32 l_sound_speed = ZERO_INIT;
+
+    if((NULL == _ultrasonic) || (NULL == distance_mm) || (sensor_index >= _ultrasonic->sensor_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ULTRASONIC_STATUS_VALID != ultrasonic_status[sensor_index])
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_echo_ticks = MCAL_Read_Shared_U16(&(ultrasonic_echo_ticks[sensor_index]));
+        l_echo_us = ULTRASONIC_CAPTURE_TICKS_TO_US(l_echo_ticks);
+
+        if(NULL != _ultrasonic->temperature_sensor)
+        {
+            l_temperature = _ultrasonic->temperature_sensor->temperature_deci_celsius;
+        }
+        else { /* Nothing */ }
+
+        /* Speed of sound in 0.1 m/s : 3313 + 0.606 * T, with T in 0.1 Celsius */
+        l_sound_speed = 3313L + ((606L * l_temperature) / 1000L);
+
+        /* Round trip : mm = t(us) * c(0.1 m/s) * 100 / 10^6 / 2 */
+        *distance_mm = (uint16)((l_echo_us * (uint32)l_sound_speed) / 20000UL);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Timer0 handler, moves the cycle : trigger end, echo timeout, hold-off end.
+ */
+static void Ultrasonic_Timer0_ISR(void)
+{
+    switch(ultrasonic_state)
+    {
+        case ULTRASONIC_STATE_HOLDOFF :
+            /* Next sensor, round-robin */
+            ultrasonic_current++;
+            if(ultrasonic_current >= ultrasonic_active->sensor_count)
+            {
+                ultrasonic_current = ZERO_INIT;
+            }
+            else { /* Nothing */ }
+            gpio_pin_write_logic(&(ultrasonic_active->trigger_pins[ultrasonic_current]), GPIO_HIGH);
+            Timer0_Write_Value(&(ultrasonic_active->sequencer_timer), ULTRASONIC_T0_INTERVAL(ULTRASONIC_CFG_TRIGGER_US));
+            ultrasonic_state = ULTRASONIC_STATE_TRIGGER;
+            break;
+
+        case ULTRASONIC_STATE_TRIGGER :
+            /* End of the trigger pulse, open the echo window */
+            gpio_pin_write_logic(&(ultrasonic_active->trigger_pins[ultrasonic_current]), GPIO_LOW);
+            CCP_Capture_Mode_Set_Edge(&(ultrasonic_active->echo_ccp), CCP_CAPTURE_MODE_1_RISING_EDGE);
+            Timer0_Write_Value(&(ultrasonic_active->sequencer_timer), ULTRASONIC_T0_INTERVAL(ULTRASONIC_CFG_ECHO_TIMEOUT_US));
+            ultrasonic_state = ULTRASONIC_STATE_WAIT_RISE;
+            break;
+
+        default :
+            /* Echo window elapsed without a complete echo */
+            ultrasonic_status[ultrasonic_current] = ULTRASONIC_STATUS_NO_ECHO;
+            Ultrasonic_Start_Holdoff();
+            break;
+    }
+}
+
+/**
+ * @brief Capture handler, timestamps the echo edges of the triggered sensor.
+ */
+static void Ultrasonic_Capture_ISR(void)
+{
+    uint16 l_capture_time = ZERO_INIT;
+
+    CCP_Capture_Mode_Read_Value(&(ultrasonic_active->echo_ccp), &l_capture_time);
+
+    if(ULTRASONIC_STATE_WAIT_RISE == ultrasonic_state)
+    {
+        ultrasonic_rise_time = l_capture_time;
+        CCP_Capture_Mode_Set_Edge(&(ultrasonic_active->echo_ccp), CCP_CAPTURE_MODE_1_FALLING_EDGE);
+        ultrasonic_state = ULTRASONIC_STATE_WAIT_FALL;
+    }
+    else if(ULTRASONIC_STATE_WAIT_FALL == ultrasonic_state)
+    {
+        ultrasonic_echo_ticks[ultrasonic_current] = (uint16)(l_capture_time - ultrasonic_rise_time);
+        ultrasonic_status[ultrasonic_current] = ULTRASONIC_STATUS_VALID;
+        /* Don't wait for the end of the window, the hold-off starts now */
+        Ultrasonic_Start_Holdoff();
+    }
+    else { /* Edges outside of the echo window are ignored */ }
+}
+
+static void Ultrasonic_Start_Holdoff(void)
+{
+    Timer0_Write_Value(&(ultrasonic_active->sequencer_timer), ULTRASONIC_T0_INTERVAL(ULTRASONIC_CFG_HOLDOFF_US));
+    ultrasonic_state = ULTRASONIC_STATE_HOLDOFF;
+}
+
+#endif
+#endif
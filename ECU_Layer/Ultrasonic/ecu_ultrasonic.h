@@ -0,0 +1,114 @@
+/*
+ * File:   ecu_ultrasonic.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#ifndef ECU_ULTRASONIC_H
+#define	ECU_ULTRASONIC_H
+
+/* Section : Includes */
+#include "ecu_ultrasonic_cfg.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+
+/* Section: Macro Declarations */
+
+/* Sensor reading status */
+#define ULTRASONIC_STATUS_NOT_READY           0x00U
+#define ULTRASONIC_STATUS_VALID               0x01U
+#define ULTRASONIC_STATUS_NO_ECHO             0x02U
+
+/* Timer0 pre-scaler select matching ULTRASONIC_CFG_TIMER0_PRESCALER */
+#if ULTRASONIC_CFG_TIMER0_PRESCALER == 2UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_2
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 4UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_4
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 8UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_8
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 16UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_16
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 32UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_32
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 64UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_64
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 128UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_128
+#elif ULTRASONIC_CFG_TIMER0_PRESCALER == 256UL
+#define ULTRASONIC_TIMER0_PRESCALER_SELECT    TIMER0_PRESCALER_DIV_BY_256
+#else
+#error "Ultrasonic : ULTRASONIC_CFG_TIMER0_PRESCALER must be a power of 2 from 2 to 256"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Converts microseconds to Timer0 ticks */
+#define ULTRASONIC_T0_US_TO_TICKS(_US_) \
+            ((uint16)(((uint32)(_US_) * ((_XTAL_FREQ / 4000UL) / ULTRASONIC_CFG_TIMER0_PRESCALER)) / 1000UL))
+
+/* Converts capture ticks to microseconds */
+#define ULTRASONIC_CAPTURE_TICKS_TO_US(_TICKS_) \
+            (((uint32)(_TICKS_) * 1000UL) / ((_XTAL_FREQ / 4000UL) / ULTRASONIC_CFG_CAPTURE_PRESCALER))
+
+#if ((ULTRASONIC_CFG_ECHO_TIMEOUT_US * ((_XTAL_FREQ / 4000UL) / ULTRASONIC_CFG_TIMER0_PRESCALER)) / 1000UL) > 65000UL
+#error "Ultrasonic : the echo window doesn't fit in Timer0, increase ULTRASONIC_CFG_TIMER0_PRESCALER"
+#endif
+
+/* Section: Data Type Declarations */
+
+/**
+ * @struct ultrasonic_t
+ * @brief Group of HC-SR04 like sensors sharing one capture channel
+ * @note  The echo outputs are wired-OR (diodes) on the CCPx pin, only the triggered sensor answers.
+ *        echo_ccp : only ccp_inst and ccp_capture_timer are used.
+ *        sequencer_timer : only the priority is used, Timer0 is configured by Ultrasonic_Init().
+ *        temperature_sensor : optional LM35 holding the air temperature in its
+ *        temperature_deci_celsius reading, NULL uses ULTRASONIC_CFG_DEFAULT_TEMPERATURE.
+ */
+typedef struct
+{
+    ccp_t echo_ccp;                                         /* Capture channel measuring the echo width */
+    timer0_t sequencer_timer;                               /* Times the trigger, echo window and hold-off */
+    uint8 sensor_count;                                     /* 1 .. ULTRASONIC_CFG_MAX_SENSORS */
+    pin_config_t trigger_pins[ULTRASONIC_CFG_MAX_SENSORS];  /* Trigger pin of each sensor */
+    const LM35_Sensor_t *temperature_sensor;                /* Optional temperature compensation */
+} ultrasonic_t;
+
+/* Section: Function Declarations */
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)) || \
+    ((CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) && (CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE))
+#if TIMER0_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Initializes the sensors and starts the measurement cycle.
+ * @details The sensors are measured round-robin from the Timer0 and capture interrupts :
+ *          trigger pulse, echo rising and falling edge captures, then a hold-off before the next
+ *          sensor. No function waits on a sensor, the readings are fetched with Ultrasonic_Get_Distance().
+ *          Only one sensor group can run at a time. The group owns Timer0 and its interrupt
+ *          handler, it can't run with Modbus_Slave_Init() which needs Timer0 as well.
+ * @pre   Timer1/Timer3 (as selected by echo_ccp.ccp_capture_timer) is running in timer mode
+ *        with the ULTRASONIC_CFG_CAPTURE_PRESCALER pre-scaler.
+ * @param _ultrasonic Pointer to the sensors configurations.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: Failure
+ */
+Std_ReturnType Ultrasonic_Init(ultrasonic_t *_ultrasonic);
+
+/**
+ * @brief Gets the latest distance measured by one sensor.
+ * @details The echo time is converted with the speed of sound at the current air temperature,
+ *          331.3 m/s + 0.606 m/s per Celsius. The LM35 integer reading in 0.1 Celsius is
+ *          used, the whole conversion is integer arithmetic.
+ * @param _ultrasonic Pointer to the sensors configurations.
+ * @param sensor_index Sensor index, 0 .. sensor_count - 1.
+ * @param distance_mm Pointer to the distance in millimeters.
+ * @return Status of the function:
+ *         - E_OK: Success
+ *         - E_NOT_OK: No reading yet, no echo in the window, or invalid parameters
+ */
+Std_ReturnType Ultrasonic_Get_Distance(const ultrasonic_t *_ultrasonic, uint8 sensor_index, uint16 *distance_mm);
+#endif
+#endif
+
+#endif	/* ECU_ULTRASONIC_H */
@@ -0,0 +1,45 @@
+/*
+ * File:   ecu_ultrasonic_cfg.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#ifndef ECU_ULTRASONIC_CFG_H
+#define	ECU_ULTRASONIC_CFG_H
+
+/* Section : Includes */
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+#include "../../MCAL_Layer/Timer0/hal_timer0.h"
+#include "../LM35/ecu_lm35_sensor.h"
+
+/* Section: Macro Declarations */
+
+/* Sensors sharing the capture pin, measured one after the other */
+#define ULTRASONIC_CFG_MAX_SENSORS            4
+
+/* Trigger pulse width, the sensor needs at least 10 us */
+#define ULTRASONIC_CFG_TRIGGER_US             12UL
+
+/* Echo window, 30 ms covers more than 5 m */
+#define ULTRASONIC_CFG_ECHO_TIMEOUT_US        30000UL
+
+/* Silence between two sensors so late reflections die out */
+#define ULTRASONIC_CFG_HOLDOFF_US             10000UL
+
+/* Timer0 pre-scaler (2 .. 256) sequencing the measurements, 1 tick = 1 us with an 8 MHz oscillator */
+#define ULTRASONIC_CFG_TIMER0_PRESCALER       2UL
+
+/* Timer1/Timer3 pre-scaler of the capture time base, 1 tick = 1 us with an 8 MHz oscillator */
+#define ULTRASONIC_CFG_CAPTURE_PRESCALER      CCP_TIMER13_PRESCALER_DIV_BY_2
+
+/* Air temperature in 0.1 Celsius used when no LM35 sensor is attached */
+#define ULTRASONIC_CFG_DEFAULT_TEMPERATURE    200
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+#endif	/* ECU_ULTRASONIC_CFG_H */
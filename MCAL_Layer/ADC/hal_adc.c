@@ -6,14 +6,65 @@
  */
 
 #include"hal_adc.h"
+#include"hal_adc_filter.h"
+#include"hal_adc_window.h"
+#include"../mcal_shared_read.h"
+
+/* Channel connected to the multiplexer, and channels whose pin is already an input (bit per channel) */
+static adc_channel_select_t adc_selected_channel = ADC_CHANNEL_AN0;
+static uint16 adc_configured_channels = ZERO_INIT;
+
+/* Timing applied by ADC_Init(), restored after the scan and burst changes */
+static adc_acquisition_time_t adc_acquisition_time = ADC_AUTO_ACQUISITION_TIME;
+static adc_conversion_clock_t adc_conversion_clock = ADC_AUTO_CONVERSION_CLOCK;
+/* Set by ADC_Init(), the first single conversion runs the acquisition even on the same channel */
+static uint8 adc_acquisition_pending = 1;
 
 #if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 static void (*ADC_InterruptHandler)(void) = NULL;
+
+/* Scan sequencer state, owned by the ADC interrupt while adc_scan_active is set */
+static const adc_conf_t *adc_scan_adc = NULL;
+static void (*ADC_ScanCompleteHandler)(void) = NULL;
+static adc_channel_select_t adc_scan_channels[ADC_SCAN_MAX_CHANNELS];
+static uint8 adc_scan_oversampling[ADC_SCAN_MAX_CHANNELS];
+static uint8 adc_scan_channel_count = ZERO_INIT;
+static adc_scan_mode_t adc_scan_mode = ADC_SCAN_SINGLE;
+static volatile uint8 adc_scan_active = ZERO_INIT;
+static uint8 adc_scan_index = ZERO_INIT;
+static uint16 adc_scan_accumulator = ZERO_INIT;
+static uint8 adc_scan_sample_count = ZERO_INIT;
+
+/* Double buffered frames, the interrupt fills the back frame while the front one is read */
+static volatile adc_result_t adc_scan_frames[2][ADC_SCAN_MAX_CHANNELS];
+static uint8 adc_scan_back_frame = ZERO_INIT;
+static volatile uint8 adc_scan_front_frame = ZERO_INIT;
+static volatile uint8 adc_scan_sequence = ZERO_INIT;
+static volatile uint8 adc_scan_frame_valid = ZERO_INIT;
+
+/* 8-bit burst state */
+static const adc_conf_t *adc_burst_adc = NULL;
+static void (*ADC_BurstCompleteHandler)(void) = NULL;
+static uint8 *adc_burst_buffer = NULL;
+static uint16 adc_burst_length = ZERO_INIT;
+static volatile uint16 adc_burst_count = ZERO_INIT;
+static volatile uint8 adc_burst_active = ZERO_INIT;
+
+/* Length of each ACQT setting in TAD, and FOSC divider of each ADCS setting (0 : FRC) */
+static const uint8 adc_acquisition_tads[8] = {0U, 2U, 4U, 6U, 8U, 12U, 16U, 20U};
+static const uint8 adc_clock_dividers[8] = {2U, 8U, 32U, 0U, 4U, 16U, 64U, 0U};
+
+static Std_ReturnType adc_scan_cfg_check(const adc_scan_cfg_t *_scan);
+static void adc_burst_timing(adc_conversion_clock_t *clock, adc_acquisition_time_t *acquisition);
+static void adc_scan_step(void);
+static void adc_burst_step(void);
+static void adc_scan_result_dispatch(adc_channel_select_t channel, adc_result_t result);
 #endif
 
 static inline void adc_input_channel_port_configure(adc_channel_select_t channel);
 static inline void select_result_format(const adc_conf_t *_adc);
 static inline void configure_voltage_reference(const adc_conf_t *_adc);
+static inline void adc_single_acquisition(adc_channel_select_t channel);
 
 /**
  * @Summary Initializes the ADC
@@ -38,12 +89,26 @@ Std_ReturnType ADC_Init(const adc_conf_t *_adc)
     {
         /* Disable the ADC */
         ADC_CONVERTER_DISABLE();
+        /* Acquisition time and conversion clock, derived from _XTAL_FREQ unless set by hand */
+        if(ADC_TIMING_MANUAL == _adc->manual_timing)
+        {
+            adc_acquisition_time = _adc->acquisition_time;
+            adc_conversion_clock = _adc->conversion_clock;
+        }
+        else
+        {
+            adc_acquisition_time = ADC_AUTO_ACQUISITION_TIME;
+            adc_conversion_clock = ADC_AUTO_CONVERSION_CLOCK;
+        }
         /* Configure the acquisition time */
-        ADCON2bits.ACQT = _adc->acquisition_time;
+        ADCON2bits.ACQT = adc_acquisition_time;
         /* Configure the conversion clock */
-        ADCON2bits.ADCS = _adc->conversion_clock;
+        ADCON2bits.ADCS = adc_conversion_clock;
         /* Configure the default channel */
         ADCON0bits.CHS = _adc->adc_channel;
+        adc_selected_channel = _adc->adc_channel;
+        adc_acquisition_pending = 1;
+        adc_configured_channels = ZERO_INIT;
         adc_input_channel_port_configure(_adc->adc_channel);
         /* Configure the interrupt */
 #if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
@@ -123,8 +188,14 @@ Std_ReturnType ADC_SelectChannel(const adc_conf_t *_adc, adc_channel_select_t ch
     }
     else
     {
-        /* Configure the default channel */
-        ADCON0bits.CHS = channel;
+        /* Only a channel change touches the multiplexer, and it needs the acquisition time again */
+        if(channel != adc_selected_channel)
+        {
+            ADCON0bits.CHS = channel;
+            adc_selected_channel = channel;
+            ADCON2bits.ACQT = adc_acquisition_time;
+        }
+        else { /* Nothing */ }
         adc_input_channel_port_configure(channel);
         ret = E_OK;
     }
@@ -215,7 +286,8 @@ Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc, adc_result_t *con
         }
         else if(ADC_RESULT_LEFT == _adc->result_format)
         {
-            *conversion_result = (adc_result_t)(((ADRESH << 8) + ADRESL) >> 6);
+            /* ADRESH holds bits 9..2 and ADRESL bits 1..0 in its top bits, no 16-bit shift */
+            *conversion_result = (adc_result_t)(((adc_result_t)ADRESH << 2) | (ADRESL >> 6));
         }
         else
         {
@@ -250,6 +322,7 @@ Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc, adc_channel_se
     else
     {
         /* select the A/D channel */
+        adc_single_acquisition(channel);
         ret = ADC_SelectChannel(_adc, channel);
         /* Start the conversion */
         ret |= ADC_StartConversion(_adc);
@@ -286,6 +359,7 @@ Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc, adc_channel
     {
         ADC_InterruptFlagClear();
         /* select the A/D channel */
+        adc_single_acquisition(channel);
         ret = ADC_SelectChannel(_adc, channel);
         /* Start the conversion */
         ret = ADC_StartConversion(_adc);
@@ -293,26 +367,286 @@ Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc, adc_channel
     }
     return ret;
 }
+
+/**
+ * @brief Arms the ADC for conversions started by the CCP2 special event trigger.
+ * @pre ADC_Init() function should have been called before calling this function.
+ * @param _adc Pointer to the ADC configurations.
+ * @param channel The channel to be sampled.
+ * @return Status of the function:
+ *          (E_OK) : The ADC is waiting for the special event trigger.
+ *          (E_NOT_OK) : The function encountered an issue while arming the ADC.
+ */
+Std_ReturnType ADC_StartConversion_Triggered(const adc_conf_t *_adc, adc_channel_select_t channel)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if(NULL == _adc)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* select the A/D channel, it stays connected between the triggers */
+        ret = ADC_SelectChannel(_adc, channel);
+        ADC_InterruptFlagClear();
+        ADC_InterruptEnable();
+        /* The special event only sets GO/DONE while the converter is on */
+        ADC_CONVERTER_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts the interrupt driven scan of a channel list.
+ * @pre ADC_Init() function should have been called with an acquisition time other than ADC_0_TAD.
+ * @param _adc Pointer to the ADC configurations.
+ * @param _scan Pointer to the scan configurations, the channel list is copied.
+ * @return Status of the function:
+ *          (E_OK) : The scan is running.
+ *          (E_NOT_OK) : Invalid configurations.
+ */
+Std_ReturnType ADC_Scan_Start(const adc_conf_t *_adc, const adc_scan_cfg_t *_scan)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+    adc_channel_select_t l_highest_channel = ADC_CHANNEL_AN0;
+    
+    if((NULL == _adc) || (NULL == _scan) || (NULL == _scan->channels))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((ZERO_INIT == _scan->channel_count) || (ADC_SCAN_MAX_CHANNELS < _scan->channel_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(E_OK != adc_scan_cfg_check(_scan))
+    {
+        /* Nothing touched yet, a running scan keeps going */
+        ret = E_NOT_OK;
+    }
+    else if(ADC_0_TAD == adc_acquisition_time)
+    {
+        /* GO/DONE is set right after the channel switch, the hardware must insert the acquisition */
+        ret = E_NOT_OK;
+    }
+    else if(adc_burst_active)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Abort the scan or the conversion in progress */
+        adc_scan_active = ZERO_INIT;
+        ADCON0bits.GO_nDONE = 0;
+        
+        for(l_index = 0; l_index < _scan->channel_count; l_index++)
+        {
+            adc_scan_channels[l_index] = _scan->channels[l_index];
+            adc_input_channel_port_configure(adc_scan_channels[l_index]);
+            if(adc_scan_channels[l_index] > l_highest_channel)
+            {
+                l_highest_channel = adc_scan_channels[l_index];
+            }
+            else { /* Nothing */ }
+            adc_scan_oversampling[l_index] = (NULL != _scan->oversampling) ?
+                                             (uint8)_scan->oversampling[l_index] : (uint8)ADC_OVERSAMPLING_NONE;
+        }
+        adc_scan_adc = _adc;
+        ADC_ScanCompleteHandler = _scan->ADC_ScanCompleteHandler;
+        adc_scan_channel_count = _scan->channel_count;
+        adc_scan_mode = _scan->scan_mode;
+        adc_scan_index = ZERO_INIT;
+        adc_scan_accumulator = ZERO_INIT;
+        adc_scan_sample_count = ZERO_INIT;
+        adc_scan_frame_valid = ZERO_INIT;
+        
+        /* AN0 .. highest scanned channel analog, set once for the whole channel list */
+        ADC_ANALOG_DIGITAL_PORT_CONFIG(ADC_AN0_ANALOG_FUNCTIONALITY - l_highest_channel);
+        ADCON2bits.ACQT = adc_acquisition_time;
+        ret = ADC_SelectChannel(_adc, adc_scan_channels[0]);
+        ADC_InterruptFlagClear();
+        adc_scan_active = 1;
+        ADC_InterruptEnable();
+        ADC_CONVERTER_ENABLE();
+        if(ADC_SCAN_TRIGGERED != adc_scan_mode)
+        {
+            ADC_START_CONVERSION();
+        }
+        else { /* The CCP2 special event starts the first conversion */ }
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops the scan, the conversion in progress is discarded.
+ * @param _adc Pointer to the ADC configurations.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Scan_Stop(const adc_conf_t *_adc)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _adc)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_scan_active = ZERO_INIT;
+        ADCON0bits.GO_nDONE = 0;
+        ADC_InterruptFlagClear();
+        /* The scan may have left the acquisition time at 0 TAD */
+        ADCON2bits.ACQT = adc_acquisition_time;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Copies the last complete scan frame.
+ * @param _adc Pointer to the ADC configurations.
+ * @param results Array of channel_count results, in the order of the channel list.
+ * @param sequence Number of the frame, incremented for every complete scan. May be NULL.
+ * @return Status of the function:
+ *          (E_OK) : The frame was copied.
+ *          (E_NOT_OK) : No complete frame yet or invalid parameters.
+ */
+Std_ReturnType ADC_Scan_Read_Frame(const adc_conf_t *_adc, adc_result_t *results, uint8 *sequence)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_sequence = ZERO_INIT;
+    uint8 l_frame = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == _adc) || (NULL == results))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT == adc_scan_frame_valid)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* The interrupt changes the front frame before the sequence, a new frame forces a new copy */
+        do
+        {
+            l_sequence = adc_scan_sequence;
+            l_frame = adc_scan_front_frame;
+            for(l_index = 0; l_index < adc_scan_channel_count; l_index++)
+            {
+                results[l_index] = adc_scan_frames[l_frame][l_index];
+            }
+        }while(l_sequence != adc_scan_sequence);
+        
+        if(NULL != sequence)
+        {
+            *sequence = l_sequence;
+        }
+        else { /* Nothing */ }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Samples one channel at the highest rate with 8-bit results.
+ * @pre ADC_Init() function should have been called before calling this function.
+ * @param _adc Pointer to the ADC configurations.
+ * @param _burst Pointer to the burst configurations, the buffer must stay valid until the end.
+ * @return Status of the function:
+ *          (E_OK) : The burst is running.
+ *          (E_NOT_OK) : A scan or a burst is running, or invalid configurations.
+ */
+Std_ReturnType ADC_Burst_Start_8Bit(const adc_conf_t *_adc, const adc_burst_cfg_t *_burst)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    adc_conversion_clock_t l_clock = ADC_FASTEST_CONVERSION_CLOCK;
+    adc_acquisition_time_t l_acquisition = ADC_AUTO_ACQUISITION_TIME;
+    
+    if((NULL == _adc) || (NULL == _burst) || (NULL == _burst->buffer) || (ZERO_INIT == _burst->length))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(adc_scan_active || adc_burst_active)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_burst_adc = _adc;
+        ADC_BurstCompleteHandler = _burst->ADC_BurstCompleteHandler;
+        adc_burst_buffer = _burst->buffer;
+        adc_burst_length = _burst->length;
+        adc_burst_count = ZERO_INIT;
+        
+        /* Only ADRESH is read, the 8 most significant bits must be there */
+        ADC_RESULT_LEFT_FORMAT();
+        /* Channel first, a change would set the acquisition back to the configured one */
+        ret = ADC_SelectChannel(_adc, _burst->channel);
+        adc_burst_timing(&l_clock, &l_acquisition);
+        ADCON2bits.ADCS = l_clock;
+        ADCON2bits.ACQT = l_acquisition;
+        ADC_InterruptFlagClear();
+        adc_burst_active = 1;
+        ADC_InterruptEnable();
+        ADC_CONVERTER_ENABLE();
+        ADC_START_CONVERSION();
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of samples stored by the current or last burst.
+ * @param _adc Pointer to the ADC configurations.
+ * @param sample_count Pointer to the count.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Burst_Get_Count(const adc_conf_t *_adc, uint16 *sample_count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _adc) || (NULL == sample_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *sample_count = MCAL_Read_Shared_U16(&adc_burst_count);
+        ret = E_OK;
+    }
+    return ret;
+}
 #endif
 static inline void adc_input_channel_port_configure(adc_channel_select_t channel)
 {
-    switch(channel)
-    {
-        case ADC_CHANNEL_AN0  : SET_BIT(TRISA, _TRISA_RA0_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN1  : SET_BIT(TRISA, _TRISA_RA1_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN2  : SET_BIT(TRISA, _TRISA_RA2_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN3  : SET_BIT(TRISA, _TRISA_RA3_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN4  : SET_BIT(TRISA, _TRISA_RA5_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN5  : SET_BIT(TRISE, _TRISE_RE0_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN6  : SET_BIT(TRISE, _TRISE_RE1_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN7  : SET_BIT(TRISE, _TRISE_RE2_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN8  : SET_BIT(TRISB, _TRISB_RB2_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN9  : SET_BIT(TRISB, _TRISB_RB3_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN10 : SET_BIT(TRISB, _TRISB_RB1_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN11 : SET_BIT(TRISB, _TRISB_RB4_POSN); break; /* Disable the digital output driver */
-        case ADC_CHANNEL_AN12 : SET_BIT(TRISB, _TRISB_RB0_POSN); break; /* Disable the digital output driver */
-        default : /* Nothing */;
+    /* The pin stays an input once configured, TRIS is written only for a new channel */
+    if(0U == (adc_configured_channels & (uint16)(1U << channel)))
+    {
+        adc_configured_channels |= (uint16)(1U << channel);
+        switch(channel)
+        {
+            case ADC_CHANNEL_AN0  : SET_BIT(TRISA, _TRISA_RA0_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN1  : SET_BIT(TRISA, _TRISA_RA1_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN2  : SET_BIT(TRISA, _TRISA_RA2_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN3  : SET_BIT(TRISA, _TRISA_RA3_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN4  : SET_BIT(TRISA, _TRISA_RA5_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN5  : SET_BIT(TRISE, _TRISE_RE0_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN6  : SET_BIT(TRISE, _TRISE_RE1_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN7  : SET_BIT(TRISE, _TRISE_RE2_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN8  : SET_BIT(TRISB, _TRISB_RB2_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN9  : SET_BIT(TRISB, _TRISB_RB3_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN10 : SET_BIT(TRISB, _TRISB_RB1_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN11 : SET_BIT(TRISB, _TRISB_RB4_POSN); break; /* Disable the digital output driver */
+            case ADC_CHANNEL_AN12 : SET_BIT(TRISB, _TRISB_RB0_POSN); break; /* Disable the digital output driver */
+            default : /* Nothing */;
+        }
     }
+    else { /* Nothing */ }
 }
 
 static inline void select_result_format(const adc_conf_t *_adc)
@@ -347,14 +681,209 @@ static inline void configure_voltage_reference(const adc_conf_t *_adc)
     }
 }
 
+/* Same check as the scan : the input converted last was tracked since, no acquisition time */
+static inline void adc_single_acquisition(adc_channel_select_t channel)
+{
+    if((channel == adc_selected_channel) && (ZERO_INIT == adc_acquisition_pending))
+    {
+        ADCON2bits.ACQT = ADC_0_TAD;
+    }
+    else
+    {
+        ADCON2bits.ACQT = adc_acquisition_time;
+        adc_acquisition_pending = ZERO_INIT;
+    }
+}
+
 #if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Checks the scan mode and every entry of the channel list, without changing any state.
+ */
+static Std_ReturnType adc_scan_cfg_check(const adc_scan_cfg_t *_scan)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    
+    if(ADC_SCAN_TRIGGERED < _scan->scan_mode)
+    {
+        ret = E_NOT_OK;
+    }
+    else { /* Nothing */ }
+    for(l_index = 0; l_index < _scan->channel_count; l_index++)
+    {
+        if(ADC_CHANNEL_COUNT <= (uint8)_scan->channels[l_index])
+        {
+            ret = E_NOT_OK;
+        }
+        else if((NULL != _scan->oversampling) && (ADC_OVERSAMPLING_X64 < _scan->oversampling[l_index]))
+        {
+            ret = E_NOT_OK;
+        }
+        else { /* Nothing */ }
+    }
+    return ret;
+}
+
+/**
+ * @brief Stores the scan result and starts the conversion of the next channel.
+ */
+static void adc_scan_step(void)
+{
+    adc_result_t l_result = ZERO_INIT;
+    uint8 l_frame_complete = ZERO_INIT;
+    uint8 l_shift = adc_scan_oversampling[adc_scan_index];
+    adc_channel_select_t l_channel = ADC_CHANNEL_AN0;
+    
+    (void)ADC_GetConversionResult(adc_scan_adc, &l_result);
+    adc_scan_accumulator += l_result;
+    adc_scan_sample_count++;
+    
+    /* 4^n conversions summed then decimated by 2^n, 64 * 1023 still fits the accumulator */
+    if(adc_scan_sample_count >= (uint8)(1U << (l_shift << 1)))
+    {
+        l_result = (adc_result_t)(adc_scan_accumulator >> l_shift);
+        adc_scan_frames[adc_scan_back_frame][adc_scan_index] = l_result;
+        adc_scan_result_dispatch(adc_scan_channels[adc_scan_index], l_result);
+        adc_scan_accumulator = ZERO_INIT;
+        adc_scan_sample_count = ZERO_INIT;
+        adc_scan_index++;
+    }
+    else { /* Same channel again */ }
+    
+    if(adc_scan_index >= adc_scan_channel_count)
+    {
+        /* Publish the frame, the next scan fills the other one */
+        adc_scan_front_frame = adc_scan_back_frame;
+        adc_scan_back_frame ^= 1U;
+        adc_scan_sequence++;
+        adc_scan_frame_valid = 1;
+        adc_scan_index = ZERO_INIT;
+        l_frame_complete = 1;
+        if(ADC_SCAN_SINGLE == adc_scan_mode)
+        {
+            adc_scan_active = ZERO_INIT;
+            ADCON2bits.ACQT = adc_acquisition_time;
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+    
+    if(adc_scan_active)
+    {
+        l_channel = adc_scan_channels[adc_scan_index];
+        if(l_channel != adc_selected_channel)
+        {
+            /* Multiplexer change, the hardware runs the acquisition time before the conversion */
+            ADCON0bits.CHS = l_channel;
+            adc_selected_channel = l_channel;
+            ADCON2bits.ACQT = adc_acquisition_time;
+        }
+        else
+        {
+            /* Same input, the holding capacitor tracked it since the last conversion */
+            ADCON2bits.ACQT = ADC_0_TAD;
+        }
+        if(ADC_SCAN_TRIGGERED != adc_scan_mode)
+        {
+            ADC_START_CONVERSION();
+        }
+        else { /* Waiting for the next CCP2 special event */ }
+    }
+    else { /* Nothing */ }
+    
+    /* Called last, the handler may stop or restart the scan */
+    if(l_frame_complete && ADC_ScanCompleteHandler)
+    {
+        ADC_ScanCompleteHandler();
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Picks the burst TAD and the first acquisition, at least as long as the configured one.
+ * @note  The configured acquisition is counted in FOSC periods and converted back to TADs of
+ *        ADC_FASTEST_CONVERSION_CLOCK, rounded up to an ACQT setting. An FRC clock or an
+ *        acquisition above 20 fast TADs keeps the configured clock and acquisition.
+ */
+static void adc_burst_timing(adc_conversion_clock_t *clock, adc_acquisition_time_t *acquisition)
+{
+    uint16 l_acquisition_cycles = (uint16)adc_acquisition_tads[adc_acquisition_time] *
+                                  adc_clock_dividers[adc_conversion_clock];
+    uint8 l_setting = (uint8)ADC_0_TAD;
+    
+    *clock = adc_conversion_clock;
+    *acquisition = adc_acquisition_time;
+    if((0U != adc_clock_dividers[adc_conversion_clock]) &&
+       (l_acquisition_cycles <= ((uint16)adc_acquisition_tads[ADC_20_TAD] * ADC_FASTEST_CONVERSION_DIVIDER)))
+    {
+        while(((uint16)adc_acquisition_tads[l_setting] * ADC_FASTEST_CONVERSION_DIVIDER) < l_acquisition_cycles)
+        {
+            l_setting++;
+        }
+        *clock = ADC_FASTEST_CONVERSION_CLOCK;
+        *acquisition = (adc_acquisition_time_t)l_setting;
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Stores the 8-bit sample and starts the next conversion of the burst.
+ */
+static void adc_burst_step(void)
+{
+    uint16 l_count = adc_burst_count;
+    
+    adc_burst_buffer[l_count] = ADRESH;
+    l_count++;
+    adc_burst_count = l_count;
+    
+    if(l_count < adc_burst_length)
+    {
+        /* Same input, the holding capacitor doesn't need a new acquisition */
+        ADCON2bits.ACQT = ADC_0_TAD;
+        ADC_START_CONVERSION();
+    }
+    else
+    {
+        adc_burst_active = ZERO_INIT;
+        ADCON2bits.ADCS = adc_conversion_clock;
+        ADCON2bits.ACQT = adc_acquisition_time;
+        select_result_format(adc_burst_adc);
+        if(ADC_BurstCompleteHandler)
+        {
+            ADC_BurstCompleteHandler();
+        }
+        else { /* Nothing */ }
+    }
+}
+
+/**
+ * @brief Hands a channel result to the processing attached to the channel.
+ */
+static void adc_scan_result_dispatch(adc_channel_select_t channel, adc_result_t result)
+{
+    adc_result_t l_value = ADC_Filter_Channel_Update(channel, result);
+    
+    /* The window compares the filtered value when the channel has a filter */
+    ADC_Window_Channel_Update(channel, l_value);
+}
+
 void ADC_ISR(void)
 {
     ADC_InterruptFlagClear();
     
-    if(ADC_InterruptHandler)
+    if(adc_burst_active)
+    {
+        adc_burst_step();
+    }
+    else if(adc_scan_active)
+    {
+        adc_scan_step();
+    }
+    else if(ADC_InterruptHandler)
     {
         ADC_InterruptHandler();
     }
+    else { /* Nothing */ }
 }
 #endif
\ No newline at end of file
@@ -40,6 +40,85 @@
 #define ADC_VOLTAGE_REFERENCE_ENABLED       0x01U
 #define ADC_VOLTAGE_REFERENCE_DISABLED      0x00U
 
+/* Number of analog channels, AN0 .. AN12 */
+#define ADC_CHANNEL_COUNT         13U
+
+/* Largest scan result, 10-bit conversions oversampled with ADC_OVERSAMPLING_X64 (shift of 3) */
+#define ADC_OVERSAMPLING_MAX_SHIFT      3U
+#define ADC_RESULT_MAX_VALUE            (1023UL << ADC_OVERSAMPLING_MAX_SHIFT)
+
+/* Minimum A/D clock period (TAD) of the PIC18F4620, in nanoseconds */
+#define ADC_TAD_MIN_NS            700UL
+
+/**
+ * @brief Fastest conversion clock keeping TAD >= ADC_TAD_MIN_NS at _XTAL_FREQ
+ * @note  TAD = divider / _XTAL_FREQ, the smallest divider with divider * 10^9 >= 700 * _XTAL_FREQ.
+ */
+#if (_XTAL_FREQ / 100UL) * 7UL <= 2UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_2
+#define ADC_FASTEST_CONVERSION_DIVIDER  2UL
+#elif (_XTAL_FREQ / 100UL) * 7UL <= 4UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_4
+#define ADC_FASTEST_CONVERSION_DIVIDER  4UL
+#elif (_XTAL_FREQ / 100UL) * 7UL <= 8UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_8
+#define ADC_FASTEST_CONVERSION_DIVIDER  8UL
+#elif (_XTAL_FREQ / 100UL) * 7UL <= 16UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_16
+#define ADC_FASTEST_CONVERSION_DIVIDER  16UL
+#elif (_XTAL_FREQ / 100UL) * 7UL <= 32UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_32
+#define ADC_FASTEST_CONVERSION_DIVIDER  32UL
+#elif (_XTAL_FREQ / 100UL) * 7UL <= 64UL * 100000UL
+#define ADC_FASTEST_CONVERSION_CLOCK    ADC_CONVERSION_CLOCK_FOSC_DIV_64
+#define ADC_FASTEST_CONVERSION_DIVIDER  64UL
+#else
+#error "ADC : _XTAL_FREQ too high for TAD >= 0.7 us even with FOSC/64"
+#endif
+
+/* TAD of ADC_FASTEST_CONVERSION_CLOCK, in nanoseconds */
+#define ADC_AUTO_TAD_NS                 ((ADC_FASTEST_CONVERSION_DIVIDER * 100000UL) / (_XTAL_FREQ / 10000UL))
+
+/**
+ * @brief Minimum acquisition time, in nanoseconds, for ADC_CFG_SOURCE_IMPEDANCE_OHM
+ * @note  TACQ = TAMP + TC + TCOFF from the device datasheet :
+ *        TAMP  = 0.2 us amplifier settling
+ *        TC    = CHOLD (25 pF) * (RIC (1k) + RSS (2k) + RS) * ln(2048), charging within 1/2 LSB
+ *        TCOFF = (Temp - 25 C) * 0.02 us/C temperature coefficient
+ */
+#define ADC_AUTO_ACQUISITION_NS \
+            (200UL + (((3000UL + ADC_CFG_SOURCE_IMPEDANCE_OHM) * 190625UL) / 1000000UL) + \
+             ((ADC_CFG_MAX_TEMPERATURE_C - 25UL) * 20UL))
+
+/* Acquisition time in TAD, rounded up */
+#define ADC_AUTO_ACQUISITION_TADS       ((ADC_AUTO_ACQUISITION_NS + ADC_AUTO_TAD_NS - 1UL) / ADC_AUTO_TAD_NS)
+
+#if (ADC_CFG_SOURCE_IMPEDANCE_OHM > 20000UL) || (ADC_CFG_MAX_TEMPERATURE_C < 25UL)
+#error "ADC : ADC_CFG_SOURCE_IMPEDANCE_OHM or ADC_CFG_MAX_TEMPERATURE_C out of range"
+#elif ADC_AUTO_ACQUISITION_TADS <= 2UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_2_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 4UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_4_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 6UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_6_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 8UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_8_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 12UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_12_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 16UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_16_TAD
+#elif ADC_AUTO_ACQUISITION_TADS <= 20UL
+#define ADC_AUTO_ACQUISITION_TIME       ADC_20_TAD
+#else
+#error "ADC : the acquisition time for ADC_CFG_SOURCE_IMPEDANCE_OHM exceeds 20 TAD, buffer the source"
+#endif
+
+/* Conversion clock used by ADC_Init() when manual_timing is 0 */
+#define ADC_AUTO_CONVERSION_CLOCK       ADC_FASTEST_CONVERSION_CLOCK
+
+#define ADC_TIMING_AUTO                 0x00U
+#define ADC_TIMING_MANUAL               0x01U
+
 #define ADC_CONVERSION_COMPLETED  0x01U
 #define ADC_CONVERSION_INPROGRESS 0x00U
 
@@ -154,12 +233,13 @@ typedef struct{
     interrupt_priority_cfg priority;
     #endif
 #endif
-    adc_acquisition_time_t acquisition_time;  /* @ref adc_acquisition_time_t */
-    adc_conversion_clock_t conversion_clock;  /* @ref adc_conversion_clock_t */
+    adc_acquisition_time_t acquisition_time;  /* @ref adc_acquisition_time_t, ADC_TIMING_MANUAL only */
+    adc_conversion_clock_t conversion_clock;  /* @ref adc_conversion_clock_t, ADC_TIMING_MANUAL only */
     adc_channel_select_t adc_channel;         /* @ref adc_channel_select_t */
     uint8 voltage_reference : 1;              /* Voltage Reference Configuration */
     uint8 result_format : 1;                  /* A/D Result Format Select */
-    uint8 ADC_Reserved : 6;
+    uint8 manual_timing : 1;                  /* ADC_TIMING_AUTO : ADC_AUTO_CONVERSION_CLOCK and ADC_AUTO_ACQUISITION_TIME */
+    uint8 ADC_Reserved : 5;
 }adc_conf_t;
 
 /**
@@ -167,6 +247,55 @@ typedef struct{
  */
 typedef uint16 adc_result_t;
 
+#if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief  Scan sequencer modes
+ * @note   ADC_SCAN_SINGLE     : the list is converted once, then the scan stops.
+ *         ADC_SCAN_CONTINUOUS : the next scan starts as soon as the last channel is converted.
+ *         ADC_SCAN_TRIGGERED  : every conversion is started by the CCP2 special event trigger,
+ *                               one channel per trigger, the list is repeated.
+ */
+typedef enum{
+    ADC_SCAN_SINGLE = 0,
+    ADC_SCAN_CONTINUOUS,
+    ADC_SCAN_TRIGGERED
+}adc_scan_mode_t;
+
+/**
+ * @brief  Oversampling ratio of a scan channel
+ * @note   4^n conversions are summed and the sum is shifted right by n, the result has 10 + n bits
+ *         (up to 13 bits with ADC_OVERSAMPLING_X64). The gain needs at least 1 LSB of noise on the
+ *         input, a perfectly steady input keeps its 10-bit steps.
+ */
+typedef enum{
+    ADC_OVERSAMPLING_NONE = 0,
+    ADC_OVERSAMPLING_X4,
+    ADC_OVERSAMPLING_X16,
+    ADC_OVERSAMPLING_X64
+}adc_oversampling_t;
+
+/**
+ * ADC Scan Configurations
+ */
+typedef struct{
+    void (* ADC_ScanCompleteHandler)(void);   /* Called from the ADC interrupt when a frame is complete */
+    const adc_channel_select_t *channels;     /* Channels in conversion order */
+    const adc_oversampling_t *oversampling;   /* Ratio of each channel, NULL : no oversampling */
+    uint8 channel_count;                      /* 1 .. ADC_SCAN_MAX_CHANNELS */
+    adc_scan_mode_t scan_mode;                /* @ref adc_scan_mode_t */
+}adc_scan_cfg_t;
+
+/**
+ * ADC 8-bit Burst Configurations
+ */
+typedef struct{
+    void (* ADC_BurstCompleteHandler)(void);  /* Called from the ADC interrupt after the last sample */
+    uint8 *buffer;                            /* Receives the 8 most significant bits of each result */
+    uint16 length;                            /* Number of samples */
+    adc_channel_select_t channel;             /* Sampled channel */
+}adc_burst_cfg_t;
+#endif
+
 /* Section: Function Declarations */
 
 
@@ -195,6 +324,7 @@ Std_ReturnType ADC_DeInit(const adc_conf_t *_adc);
 /**
  * @Summary Allows selection of a channel for conversion
  * @Description This routine is used to select desired channel for conversion.
+ *              A channel change sets the configured acquisition time back.
  * @Preconditions ADC_Init() function should have been called before calling this function.
  * @param _adc Pointer to the ADC configurations
  * @param channel Defines the channel available for conversion.
@@ -249,6 +379,8 @@ Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc, adc_result_t *con
  * @Summary Returns the ADC conversion value, also allows selection of a channel for conversion.
  * @Description This routine is used to select desired channel for conversion.
  *              This routine is get the analog to digital converted value.
+ *              The acquisition time only runs after ADC_Init() or a channel change, the
+ *              channel converted last is converted right away.
  * @Preconditions ADC_Init() function should have been called before calling this function.
  * @param _adc Pointer to the ADC configurations
  * @param channel Defines the channel available for conversion.
@@ -265,7 +397,8 @@ Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc, adc_channel_se
  *
  * @details This function starts an ADC conversion in interrupt mode for the specified channel.
  * It initiates the conversion process and returns immediately, allowing the microcontroller
- * to continue with other tasks while the ADC converts the analog input.
+ * to continue with other tasks while the ADC converts the analog input. As with
+ * ADC_GetConversion_Blocking(), the acquisition time only runs on a new channel.
  * @pre ADC_Init() function should have been called before calling this function.
  * @param _adc Pointer to the ADC configurations.
  * @param channel The channel to be converted.
@@ -275,6 +408,103 @@ Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc, adc_channel_se
  */
 #if ADC_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc, adc_channel_select_t channel);
+
+/**
+ * @brief Arms the ADC for conversions started by the CCP2 special event trigger.
+ *
+ * @details The channel is selected once and the converter is left enabled without setting GO/DONE.
+ * Every CCP2 compare match (CCP_COMPARE_MODE_GEN_EVENT variant) then resets the Timer1/Timer3
+ * time base and starts a conversion in hardware, so the sample instants carry no software jitter.
+ * Each result is delivered through ADC_InterruptHandler, read it there with ADC_GetConversionResult().
+ * The acquisition time configured in ADC_Init() is inserted by the hardware before each conversion.
+ * @pre ADC_Init() function should have been called before calling this function.
+ *      CCP2 configured by CCP_Init() in compare mode, CCP_COMPARE_MODE_GEN_EVENT variant,
+ *      with special_event_frequency holding the sampling rate.
+ * @param _adc Pointer to the ADC configurations.
+ * @param channel The channel to be sampled.
+ * @return Status of the function:
+ *          (E_OK) : The ADC is waiting for the special event trigger.
+ *          (E_NOT_OK) : The function encountered an issue while arming the ADC.
+ */
+Std_ReturnType ADC_StartConversion_Triggered(const adc_conf_t *_adc, adc_channel_select_t channel);
+
+/**
+ * @brief Starts the interrupt driven scan of a channel list.
+ *
+ * @details The ADC interrupt stores each result, selects the next channel and starts its
+ * conversion, the hardware inserts the acquisition time (ACQT) after the channel switch so
+ * no software delay is needed. Results are written to the back frame of a double buffer,
+ * the complete frame is published and ADC_ScanCompleteHandler is called after the last channel.
+ * While a scan is running ADC_InterruptHandler isn't called, every channel result is also fed
+ * to the filter attached with ADC_Filter_Attach().
+ * An oversampled channel is converted 4^n times in a row before the scan moves on, the
+ * accumulation and the decimation are done in the interrupt.
+ * @pre ADC_Init() function should have been called with an acquisition time other than ADC_0_TAD
+ *      (always the case with ADC_TIMING_AUTO).
+ *      ADC_SCAN_TRIGGERED : CCP2 configured as for ADC_StartConversion_Triggered().
+ * @param _adc Pointer to the ADC configurations.
+ * @param _scan Pointer to the scan configurations, the channel list is copied.
+ * @return Status of the function:
+ *          (E_OK) : The scan is running.
+ *          (E_NOT_OK) : Invalid configurations, checked before any change : a running scan,
+ *                       the ports and the previous channel list are left as they were.
+ */
+Std_ReturnType ADC_Scan_Start(const adc_conf_t *_adc, const adc_scan_cfg_t *_scan);
+
+/**
+ * @brief Stops the scan, the conversion in progress is discarded.
+ * @param _adc Pointer to the ADC configurations.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Scan_Stop(const adc_conf_t *_adc);
+
+/**
+ * @brief Copies the last complete scan frame.
+ *
+ * @details The frame is read without disabling the interrupts, the copy is repeated if
+ * the ADC interrupt published a new frame meanwhile.
+ * @param _adc Pointer to the ADC configurations.
+ * @param results Array of channel_count results, in the order of the channel list.
+ * @param sequence Number of the frame, incremented for every complete scan (wraps around).
+ *                 Comparing it with the previous read tells if the frame is new. May be NULL.
+ * @return Status of the function:
+ *          (E_OK) : The frame was copied.
+ *          (E_NOT_OK) : No complete frame yet or invalid parameters.
+ */
+Std_ReturnType ADC_Scan_Read_Frame(const adc_conf_t *_adc, adc_result_t *results, uint8 *sequence);
+
+/**
+ * @brief Samples one channel at the highest rate with 8-bit results.
+ *
+ * @details For inputs where 8 bits are enough (potentiometers, coarse sensing). The result is
+ * left justified and the ADC interrupt stores ADRESH only, then starts the next conversion on
+ * the same channel right away, with the fastest legal TAD (ADC_FASTEST_CONVERSION_CLOCK) and no
+ * acquisition time after the first sample. Each sample costs 11 TAD of conversion plus the
+ * interrupt latency, which is the limit of the rate.
+ * The first acquisition is recomputed in fast TADs so it's never shorter than the configured
+ * one. When it can't be (FRC clock, or more than 20 fast TADs) the configured clock is kept.
+ * The conversion clock, acquisition time and result format of _adc are restored after the burst.
+ * @pre ADC_Init() function should have been called before calling this function.
+ *      No scan running.
+ * @param _adc Pointer to the ADC configurations.
+ * @param _burst Pointer to the burst configurations, the buffer must stay valid until the end.
+ * @return Status of the function:
+ *          (E_OK) : The burst is running.
+ *          (E_NOT_OK) : A scan or a burst is running, or invalid configurations.
+ */
+Std_ReturnType ADC_Burst_Start_8Bit(const adc_conf_t *_adc, const adc_burst_cfg_t *_burst);
+
+/**
+ * @brief Gets the number of samples stored by the current or last burst.
+ * @param _adc Pointer to the ADC configurations.
+ * @param sample_count Pointer to the count.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Burst_Get_Count(const adc_conf_t *_adc, uint16 *sample_count);
 #endif
 
 #endif	/* HAL_ADC_H */
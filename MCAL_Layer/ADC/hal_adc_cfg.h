@@ -18,6 +18,24 @@
 
 /* Section: Macro Declarations */
 
+/* Output impedance of the sources driving the analog inputs, 2500 ohm at most is recommended */
+#define ADC_CFG_SOURCE_IMPEDANCE_OHM    2500UL
+
+/* Highest operating temperature in Celsius (25 .. 125), the holding capacitor leakage grows with it */
+#define ADC_CFG_MAX_TEMPERATURE_C       85UL
+
+/* Longest channel list accepted by ADC_Scan_Start() */
+#define ADC_SCAN_MAX_CHANNELS           8U
+
+/* Longest moving average window of hal_adc_filter, 255 at most, costs 2 bytes of RAM per filter and sample */
+#define ADC_FILTER_MA_MAX_LENGTH        16U
+
+/* Window comparator events waiting for the application, must be a power of 2 */
+#define ADC_WINDOW_EVENT_QUEUE_SIZE     8U
+
+/* Reference voltage (VDD or VREF+ - VREF-) used by the millivolt conversion */
+#define ADC_CONVERT_VREF_MV             5000UL
+
 /* Section: Macro Functions Declarations */
 
 /* Section: Data Type Declarations */
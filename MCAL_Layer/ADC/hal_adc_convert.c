@@ -0,0 +1,187 @@
+/* 
+ * File:   hal_adc_convert.c
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 9:00 PM
+ */
+
+#include "hal_adc_convert.h"
+
+/* Conversion attached to each channel */
+static const adc_convert_t *adc_channel_converts[ADC_CHANNEL_COUNT];
+
+static sint32 adc_convert_linear(const adc_convert_t *_convert, adc_result_t raw);
+static sint32 adc_convert_table(const adc_convert_t *_convert, adc_result_t raw);
+static Std_ReturnType adc_convert_check_table(const adc_convert_t *_convert);
+
+/**
+ * @brief Converts a result to engineering units.
+ * @param _convert Pointer to the conversion.
+ * @param raw The conversion result.
+ * @param value Pointer to the converted value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid conversion or parameters
+ */
+Std_ReturnType ADC_Convert(const adc_convert_t *_convert, adc_result_t raw, sint32 *value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _convert) || (NULL == value))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ADC_CONVERT_LINEAR == _convert->convert_type)
+    {
+        *value = adc_convert_linear(_convert, raw);
+        ret = E_OK;
+    }
+    else if((ADC_CONVERT_TABLE == _convert->convert_type) && (NULL != _convert->table) &&
+            (2U <= _convert->table_size))
+    {
+        *value = adc_convert_table(_convert, raw);
+        ret = E_OK;
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Attaches a conversion to an ADC channel.
+ * @param channel The ADC channel.
+ * @param _convert Pointer to the conversion or NULL to detach.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Convert_Attach(adc_channel_select_t channel, const adc_convert_t *_convert)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(ADC_CHANNEL_COUNT <= (uint8)channel)
+    {
+        ret = E_NOT_OK;
+    }
+    else if((NULL != _convert) && (ADC_CONVERT_TABLE == _convert->convert_type) &&
+            (E_OK != adc_convert_check_table(_convert)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_channel_converts[channel] = _convert;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a result with the conversion attached to its channel.
+ * @param channel The ADC channel the result belongs to.
+ * @param raw The conversion result.
+ * @param value Pointer to the converted value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No conversion attached or invalid parameters
+ */
+Std_ReturnType ADC_Convert_Channel(adc_channel_select_t channel, adc_result_t raw, sint32 *value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(ADC_CHANNEL_COUNT <= (uint8)channel)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = ADC_Convert(adc_channel_converts[channel], raw, value);
+    }
+    return ret;
+}
+
+static sint32 adc_convert_linear(const adc_convert_t *_convert, adc_result_t raw)
+{
+    sint32 l_product = (sint32)raw * _convert->gain;
+    
+    /* Round to nearest, the shift is applied on the magnitude so negative gains round the same way */
+    if(l_product >= 0)
+    {
+        l_product = (l_product + (1L << (ADC_CONVERT_GAIN_Q_BITS - 1U))) >> ADC_CONVERT_GAIN_Q_BITS;
+    }
+    else
+    {
+        l_product = -((-l_product + (1L << (ADC_CONVERT_GAIN_Q_BITS - 1U))) >> ADC_CONVERT_GAIN_Q_BITS);
+    }
+    return _convert->offset + l_product;
+}
+
+static sint32 adc_convert_table(const adc_convert_t *_convert, adc_result_t raw)
+{
+    const adc_convert_point_t *l_low = &(_convert->table[0]);
+    const adc_convert_point_t *l_high = &(_convert->table[_convert->table_size - 1U]);
+    sint32 l_value = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if(raw <= l_low->raw)
+    {
+        l_value = l_low->value;
+    }
+    else if(raw >= l_high->raw)
+    {
+        l_value = l_high->value;
+    }
+    else
+    {
+        /* First point above raw, the last point is above it so the search stops in the table */
+        l_index = 1;
+        while(raw >= _convert->table[l_index].raw)
+        {
+            l_index++;
+        }
+        l_low = &(_convert->table[l_index - 1U]);
+        l_high = &(_convert->table[l_index]);
+        l_value = l_low->value + (((l_high->value - l_low->value) * (sint32)(raw - l_low->raw)) /
+                                  (sint32)(l_high->raw - l_low->raw));
+    }
+    return l_value;
+}
+
+/* Raw points increasing, and each segment's value step times its raw step inside 32 bits */
+static Std_ReturnType adc_convert_check_table(const adc_convert_t *_convert)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_value_step = ZERO_INIT;
+    uint16 l_raw_step = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == _convert->table) || (2U > _convert->table_size))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_index = 1; l_index < _convert->table_size; l_index++)
+        {
+            l_raw_step = (uint16)(_convert->table[l_index].raw - _convert->table[l_index - 1U].raw);
+            /* Magnitude computed unsigned, the difference of two sint32 may not fit a sint32 */
+            if(_convert->table[l_index].value >= _convert->table[l_index - 1U].value)
+            {
+                l_value_step = (uint32)_convert->table[l_index].value - (uint32)_convert->table[l_index - 1U].value;
+            }
+            else
+            {
+                l_value_step = (uint32)_convert->table[l_index - 1U].value - (uint32)_convert->table[l_index].value;
+            }
+            if((_convert->table[l_index].raw <= _convert->table[l_index - 1U].raw) ||
+               (l_value_step > (0x7FFFFFFFUL / l_raw_step)))
+            {
+                ret = E_NOT_OK;
+            }
+            else { /* Nothing */ }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,105 @@
+/* 
+ * File:   hal_adc_convert.h
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 9:00 PM
+ */
+
+#ifndef HAL_ADC_CONVERT_H
+#define	HAL_ADC_CONVERT_H
+
+/* Section : Includes */
+#include "hal_adc.h"
+
+/* Section: Macro Declarations */
+
+/* Fraction bits of the linear gain */
+#define ADC_CONVERT_GAIN_Q_BITS         16U
+
+/* Section: Macro Functions Declarations */
+
+/**
+ * @brief Linear gain in Q16 from a full scale : _UNITS_ output units for _COUNTS_ counts
+ * @note  Evaluated at compile time, ex : ADC_CONVERT_GAIN_Q(5000, 1024) is 4.8828 mV per count.
+ *        _UNITS_ must stay below 65536.
+ */
+#define ADC_CONVERT_GAIN_Q(_UNITS_, _COUNTS_) \
+            ((sint32)((((uint32)(_UNITS_) << ADC_CONVERT_GAIN_Q_BITS) + ((uint32)(_COUNTS_) / 2UL)) / (uint32)(_COUNTS_)))
+
+/* Gain of a plain 10-bit result to millivolts */
+#define ADC_CONVERT_MV_GAIN             ADC_CONVERT_GAIN_Q(ADC_CONVERT_VREF_MV, 1024UL)
+
+/* Section: Data Type Declarations */
+
+/**
+ * @brief Conversion types
+ * @note  ADC_CONVERT_LINEAR : value = offset + raw * gain / 2^16
+ *        ADC_CONVERT_TABLE  : piecewise linear interpolation between calibration points,
+ *                             clamped to the first/last point outside the table.
+ */
+typedef enum{
+    ADC_CONVERT_LINEAR = 0,
+    ADC_CONVERT_TABLE
+}adc_convert_type_t;
+
+/**
+ * Calibration point of a conversion table
+ */
+typedef struct{
+    adc_result_t raw;                         /* Conversion result, increasing along the table */
+    sint32 value;                             /* Engineering value at this result */
+}adc_convert_point_t;
+
+/**
+ * ADC Conversion
+ * @note The output unit is chosen by the calibration (mV, 0.1 Celsius, ...), only 32-bit
+ *       integer arithmetic is used. LINEAR : |raw * gain| must stay below 2^31, that is a
+ *       full scale output up to 32767 units. TABLE : the value step times the raw step of
+ *       each segment must stay below 2^31, ex : 2.1 million units over a 1023 count segment,
+ *       ADC_Convert_Attach() rejects the tables that don't.
+ */
+typedef struct{
+    adc_convert_type_t convert_type;          /* @ref adc_convert_type_t */
+    sint32 offset;                            /* LINEAR : value at raw 0 */
+    sint32 gain;                              /* LINEAR : units per count in Q16, @ref ADC_CONVERT_GAIN_Q */
+    const adc_convert_point_t *table;         /* TABLE : calibration points */
+    uint8 table_size;                         /* TABLE : 2 points at least */
+}adc_convert_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Converts a result to engineering units.
+ * @param _convert Pointer to the conversion.
+ * @param raw The conversion result.
+ * @param value Pointer to the converted value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid conversion or parameters
+ */
+Std_ReturnType ADC_Convert(const adc_convert_t *_convert, adc_result_t raw, sint32 *value);
+
+/**
+ * @brief Attaches a conversion to an ADC channel.
+ * @details A table is checked once here : raw points increasing and no segment overflowing
+ *          the 32-bit interpolation, ADC_Convert() doesn't check it on every result.
+ * @param channel The ADC channel.
+ * @param _convert Pointer to the conversion or NULL to detach.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid channel or table
+ */
+Std_ReturnType ADC_Convert_Attach(adc_channel_select_t channel, const adc_convert_t *_convert);
+
+/**
+ * @brief Converts a result with the conversion attached to its channel.
+ * @param channel The ADC channel the result belongs to.
+ * @param raw The conversion result.
+ * @param value Pointer to the converted value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No conversion attached or invalid parameters
+ */
+Std_ReturnType ADC_Convert_Channel(adc_channel_select_t channel, adc_result_t raw, sint32 *value);
+
+#endif	/* HAL_ADC_CONVERT_H */
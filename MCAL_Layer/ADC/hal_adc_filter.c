@@ -0,0 +1,286 @@
+/* 
+ * File:   hal_adc_filter.c
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 7:10 PM
+ */
+
+#include "hal_adc_filter.h"
+#include "../mcal_shared_read.h"
+
+/* Filter attached to each channel, fed by the scan sequencer */
+static adc_filter_t *adc_channel_filters[ADC_CHANNEL_COUNT];
+
+static uint8 adc_filter_taps(const adc_filter_t *_filter);
+static adc_result_t adc_filter_median_3(adc_result_t a, adc_result_t b, adc_result_t c);
+static adc_result_t adc_filter_median_5(const adc_result_t *_samples);
+
+/**
+ * @brief Initializes the filter state.
+ * @param _filter Pointer to the filter.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid filter configurations
+ */
+Std_ReturnType ADC_Filter_Init(adc_filter_t *_filter)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _filter)
+    {
+        ret = E_NOT_OK;
+    }
+    else if((ADC_FILTER_MOVING_AVERAGE == _filter->filter_type) &&
+            ((ZERO_INIT == _filter->ma_length) || (ADC_FILTER_MA_MAX_LENGTH < _filter->ma_length) ||
+             (ZERO_INIT != (_filter->ma_length & (_filter->ma_length - 1U)))))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((ADC_FILTER_IIR == _filter->filter_type) &&
+            ((ZERO_INIT == _filter->iir_shift) || (8U < _filter->iir_shift)))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ADC_FILTER_IIR < _filter->filter_type)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _filter->history_index = ZERO_INIT;
+        _filter->primed = ZERO_INIT;
+        _filter->ma_shift = ZERO_INIT;
+        while((ADC_FILTER_MOVING_AVERAGE == _filter->filter_type) &&
+              ((1U << _filter->ma_shift) < _filter->ma_length))
+        {
+            _filter->ma_shift++;
+        }
+        _filter->state = ZERO_INIT;
+        _filter->output = ZERO_INIT;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Feeds one sample to the filter.
+ * @param _filter Pointer to the filter.
+ * @param sample The new conversion result.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Filter_Update(adc_filter_t *_filter, adc_result_t sample)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_taps = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint32 l_input = ZERO_INIT;
+    adc_result_t l_output = sample;
+    
+    if(NULL == _filter)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_taps = adc_filter_taps(_filter);
+        
+        if(ZERO_INIT == _filter->primed)
+        {
+            /* The first sample fills the history, no ramp up from 0 */
+            for(l_index = 0; l_index < l_taps; l_index++)
+            {
+                _filter->history[l_index] = sample;
+            }
+            _filter->state = (ADC_FILTER_IIR == _filter->filter_type) ?
+                             ((uint32)sample << ADC_FILTER_IIR_FRACTION_BITS) : ((uint32)sample * l_taps);
+            _filter->primed = 1;
+        }
+        else { /* Nothing */ }
+        
+        switch(_filter->filter_type)
+        {
+            case ADC_FILTER_MOVING_AVERAGE :
+                /* The running sum drops the oldest sample and adds the new one */
+                _filter->state -= _filter->history[_filter->history_index];
+                _filter->state += sample;
+                l_output = (adc_result_t)(_filter->state >> _filter->ma_shift);
+                break;
+                
+            case ADC_FILTER_MEDIAN_3 :
+                l_output = adc_filter_median_3(sample, _filter->history[0], _filter->history[1]);
+                break;
+                
+            case ADC_FILTER_MEDIAN_5 :
+                _filter->history[_filter->history_index] = sample;
+                l_output = adc_filter_median_5(_filter->history);
+                break;
+                
+            case ADC_FILTER_IIR :
+                /* Unsigned state, the step is computed on the magnitude of the error */
+                l_input = (uint32)sample << ADC_FILTER_IIR_FRACTION_BITS;
+                if(l_input >= _filter->state)
+                {
+                    _filter->state += (l_input - _filter->state) >> _filter->iir_shift;
+                }
+                else
+                {
+                    _filter->state -= (_filter->state - l_input) >> _filter->iir_shift;
+                }
+                l_output = (adc_result_t)((_filter->state + (1U << (ADC_FILTER_IIR_FRACTION_BITS - 1U)))
+                                          >> ADC_FILTER_IIR_FRACTION_BITS);
+                break;
+                
+            default : /* ADC_FILTER_NONE */ break;
+        }
+        
+        /* History update, the 3-tap median keeps its last two samples at index 0 and 1 */
+        if(ADC_FILTER_MEDIAN_3 == _filter->filter_type)
+        {
+            _filter->history[1] = _filter->history[0];
+            _filter->history[0] = sample;
+        }
+        else if((ADC_FILTER_MOVING_AVERAGE == _filter->filter_type) || (ADC_FILTER_MEDIAN_5 == _filter->filter_type))
+        {
+            _filter->history[_filter->history_index] = sample;
+            _filter->history_index++;
+            if(_filter->history_index >= l_taps)
+            {
+                _filter->history_index = ZERO_INIT;
+            }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+        
+        _filter->output = l_output;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the filtered value.
+ * @param _filter Pointer to the filter.
+ * @param value Pointer to the filtered value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No sample yet or invalid parameters
+ */
+Std_ReturnType ADC_Filter_Read(const adc_filter_t *_filter, adc_result_t *value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _filter) || (NULL == value))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT == _filter->primed)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *value = MCAL_Read_Shared_U16(&(_filter->output));
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Attaches a filter to an ADC channel.
+ * @param channel The ADC channel.
+ * @param _filter Pointer to the filter or NULL.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Filter_Attach(adc_channel_select_t channel, adc_filter_t *_filter)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(ADC_CHANNEL_COUNT <= (uint8)channel)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_channel_filters[channel] = _filter;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Feeds a channel result to its attached filter.
+ * @param channel The ADC channel the result belongs to.
+ * @param sample The conversion result.
+ * @return The filtered value, or the sample itself when no filter is attached.
+ */
+adc_result_t ADC_Filter_Channel_Update(adc_channel_select_t channel, adc_result_t sample)
+{
+    adc_result_t l_value = sample;
+    
+    if((ADC_CHANNEL_COUNT > (uint8)channel) && (NULL != adc_channel_filters[channel]))
+    {
+        (void)ADC_Filter_Update(adc_channel_filters[channel], sample);
+        l_value = adc_channel_filters[channel]->output;
+    }
+    else { /* Nothing */ }
+    return l_value;
+}
+
+static uint8 adc_filter_taps(const adc_filter_t *_filter)
+{
+    uint8 l_taps = 1U;
+    
+    switch(_filter->filter_type)
+    {
+        case ADC_FILTER_MOVING_AVERAGE : l_taps = _filter->ma_length; break;
+        case ADC_FILTER_MEDIAN_3       : l_taps = 2U; break; /* The two previous samples */
+        case ADC_FILTER_MEDIAN_5       : l_taps = 5U; break;
+        default : /* Nothing */ break;
+    }
+    return l_taps;
+}
+
+static adc_result_t adc_filter_median_3(adc_result_t a, adc_result_t b, adc_result_t c)
+{
+    adc_result_t l_median = a;
+    
+    if(a > b)
+    {
+        if(b > c)       { l_median = b; }
+        else if(a > c)  { l_median = c; }
+        else            { l_median = a; }
+    }
+    else
+    {
+        if(a > c)       { l_median = a; }
+        else if(b > c)  { l_median = c; }
+        else            { l_median = b; }
+    }
+    return l_median;
+}
+
+static adc_result_t adc_filter_median_5(const adc_result_t *_samples)
+{
+    adc_result_t l_sorted[ADC_FILTER_MEDIAN_MAX_TAPS];
+    adc_result_t l_temp = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_pos = ZERO_INIT;
+    
+    /* Insertion sort of 5 samples, 10 compares at most */
+    for(l_index = 0; l_index < ADC_FILTER_MEDIAN_MAX_TAPS; l_index++)
+    {
+        l_temp = _samples[l_index];
+        l_pos = l_index;
+        while((l_pos > 0U) && (l_sorted[l_pos - 1U] > l_temp))
+        {
+            l_sorted[l_pos] = l_sorted[l_pos - 1U];
+            l_pos--;
+        }
+        l_sorted[l_pos] = l_temp;
+    }
+    return l_sorted[2];
+}
@@ -0,0 +1,126 @@
+/* 
+ * File:   hal_adc_filter.h
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 7:10 PM
+ */
+
+#ifndef HAL_ADC_FILTER_H
+#define	HAL_ADC_FILTER_H
+
+/* Section : Includes */
+#include "hal_adc.h"
+
+/* Section: Macro Declarations */
+
+/* Median filter taps */
+#define ADC_FILTER_MEDIAN_MAX_TAPS      5U
+
+/* IIR state fraction bits, results up to 13 bits (oversampled) are kept as Q13.6 in 32 bits */
+#define ADC_FILTER_IIR_FRACTION_BITS    6U
+
+#if (ADC_FILTER_MA_MAX_LENGTH * ADC_RESULT_MAX_VALUE) > 0xFFFFFFFFUL
+#error "ADC filter : ADC_FILTER_MA_MAX_LENGTH overflows the 32-bit running sum of the largest oversampled results"
+#elif ADC_FILTER_MA_MAX_LENGTH > 255U
+#error "ADC filter : ADC_FILTER_MA_MAX_LENGTH above 255 doesn't fit the 8-bit ma_length"
+#elif ADC_FILTER_MA_MAX_LENGTH < ADC_FILTER_MEDIAN_MAX_TAPS
+#error "ADC filter : the history is shared with the median, ADC_FILTER_MA_MAX_LENGTH must be 5 at least"
+#elif (ADC_FILTER_MA_MAX_LENGTH & (ADC_FILTER_MA_MAX_LENGTH - 1U)) != 0U
+#error "ADC filter : ADC_FILTER_MA_MAX_LENGTH must be a power of 2"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/**
+ * @brief  Filter types
+ * @note   ADC_FILTER_MOVING_AVERAGE : boxcar of ma_length samples, running sum shifted right,
+ *                                     no division in the interrupt.
+ *         ADC_FILTER_MEDIAN_3 / 5   : median of the last 3 / 5 samples, removes spikes.
+ *         ADC_FILTER_IIR            : first order low-pass, y += (x - y) / 2^iir_shift.
+ */
+typedef enum{
+    ADC_FILTER_NONE = 0,
+    ADC_FILTER_MOVING_AVERAGE,
+    ADC_FILTER_MEDIAN_3,
+    ADC_FILTER_MEDIAN_5,
+    ADC_FILTER_IIR
+}adc_filter_type_t;
+
+/**
+ * ADC Filter
+ * @note filter_type, ma_length and iir_shift are the configurations, the other members
+ *       are the filter state cleared by ADC_Filter_Init(). The first sample fills the
+ *       whole history so the output doesn't ramp up from 0.
+ */
+typedef struct{
+    adc_filter_type_t filter_type;            /* @ref adc_filter_type_t */
+    uint8 ma_length;                          /* Moving average : power of 2, 1 .. ADC_FILTER_MA_MAX_LENGTH */
+    uint8 iir_shift;                          /* IIR : 1 .. 8, time constant of 2^iir_shift samples */
+    adc_result_t history[ADC_FILTER_MA_MAX_LENGTH];
+    uint8 history_index;
+    uint8 primed;
+    uint8 ma_shift;                           /* log2(ma_length) */
+    uint32 state;                             /* Running sum or IIR state, sized for oversampled results */
+    volatile adc_result_t output;
+}adc_filter_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Initializes the filter state.
+ * @param _filter Pointer to the filter.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid filter configurations, a moving average length that isn't
+ *                       a power of 2 included
+ */
+Std_ReturnType ADC_Filter_Init(adc_filter_t *_filter);
+
+/**
+ * @brief Feeds one sample to the filter.
+ * @details Constant work per sample for every filter type, it can be called from the
+ *          ADC interrupt.
+ * @param _filter Pointer to the filter.
+ * @param sample The new conversion result.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Filter_Update(adc_filter_t *_filter, adc_result_t sample);
+
+/**
+ * @brief Reads the filtered value.
+ * @details The value may be updated by the ADC interrupt, it's read with
+ *          MCAL_Read_Shared_U16() so the interrupts stay enabled.
+ * @param _filter Pointer to the filter.
+ * @param value Pointer to the filtered value.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No sample yet or invalid parameters
+ */
+Std_ReturnType ADC_Filter_Read(const adc_filter_t *_filter, adc_result_t *value);
+
+/**
+ * @brief Attaches a filter to an ADC channel.
+ * @details Every result of the channel converted by the scan sequencer is fed to the filter
+ *          from the ADC interrupt. One filter per channel, NULL detaches the filter.
+ * @pre ADC_Filter_Init() function should have been called for the filter.
+ * @param channel The ADC channel.
+ * @param _filter Pointer to the filter or NULL.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Filter_Attach(adc_channel_select_t channel, adc_filter_t *_filter);
+
+/**
+ * @brief Feeds a channel result to its attached filter.
+ * @param channel The ADC channel the result belongs to.
+ * @param sample The conversion result.
+ * @return The filtered value, or the sample itself when no filter is attached.
+ */
+adc_result_t ADC_Filter_Channel_Update(adc_channel_select_t channel, adc_result_t sample);
+
+#endif	/* HAL_ADC_FILTER_H */
@@ -0,0 +1,197 @@
+/* 
+ * File:   hal_adc_window.c
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 8:05 PM
+ */
+
+#include "hal_adc_window.h"
+
+#define ADC_WINDOW_QUEUE_INDEX_MASK     (ADC_WINDOW_EVENT_QUEUE_SIZE - 1U)
+
+/* Window comparator attached to each channel, fed by the scan sequencer */
+static adc_window_t *adc_channel_windows[ADC_CHANNEL_COUNT];
+
+/* Single producer (ADC interrupt) single consumer (application) queue */
+static adc_window_event_t adc_window_queue[ADC_WINDOW_EVENT_QUEUE_SIZE];
+static volatile uint8 adc_window_queue_head = ZERO_INIT;
+static volatile uint8 adc_window_queue_tail = ZERO_INIT;
+static volatile uint8 adc_window_lost_events = ZERO_INIT;
+
+static void adc_window_post_event(adc_channel_select_t channel, adc_window_state_t state, adc_result_t value);
+
+/**
+ * @brief Initializes the window comparator.
+ * @param _window Pointer to the window comparator.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid thresholds
+ */
+Std_ReturnType ADC_Window_Init(adc_window_t *_window)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _window)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(_window->low_threshold > _window->high_threshold)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _window->state = ADC_WINDOW_STATE_UNKNOWN;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Attaches a window comparator to an ADC channel.
+ * @param channel The ADC channel.
+ * @param _window Pointer to the window comparator or NULL to detach.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Window_Attach(adc_channel_select_t channel, adc_window_t *_window)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(ADC_CHANNEL_COUNT <= (uint8)channel)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        adc_channel_windows[channel] = _window;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Compares a channel value with its attached window, nothing is done without a window.
+ * @param channel The ADC channel the value belongs to.
+ * @param value The value to compare.
+ */
+void ADC_Window_Channel_Update(adc_channel_select_t channel, adc_result_t value)
+{
+    adc_window_t *l_window = NULL;
+    adc_window_state_t l_state = ADC_WINDOW_STATE_UNKNOWN;
+    
+    if((ADC_CHANNEL_COUNT > (uint8)channel) && (NULL != adc_channel_windows[channel]))
+    {
+        l_window = adc_channel_windows[channel];
+        
+        if(value > l_window->high_threshold)
+        {
+            l_state = ADC_WINDOW_STATE_ABOVE;
+        }
+        else if(value < l_window->low_threshold)
+        {
+            l_state = ADC_WINDOW_STATE_BELOW;
+        }
+        else if(ADC_WINDOW_STATE_ABOVE == l_window->state)
+        {
+            /* Back inside only once below high_threshold - hysteresis */
+            l_state = (((uint16)value + l_window->hysteresis) < l_window->high_threshold) ?
+                      ADC_WINDOW_STATE_INSIDE : ADC_WINDOW_STATE_ABOVE;
+        }
+        else if(ADC_WINDOW_STATE_BELOW == l_window->state)
+        {
+            /* Back inside only once above low_threshold + hysteresis */
+            l_state = (value > ((uint16)l_window->low_threshold + l_window->hysteresis)) ?
+                      ADC_WINDOW_STATE_INSIDE : ADC_WINDOW_STATE_BELOW;
+        }
+        else
+        {
+            l_state = ADC_WINDOW_STATE_INSIDE;
+        }
+        
+        if(l_state != l_window->state)
+        {
+            l_window->state = l_state;
+            adc_window_post_event(channel, l_state, value);
+            if(l_window->ADC_WindowEventHandler)
+            {
+                l_window->ADC_WindowEventHandler();
+            }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief Gets the oldest window event.
+ * @param _event Pointer to the event.
+ * @return Status of the function:
+ *          (E_OK) : An event was read
+ *          (E_NOT_OK) : The queue is empty
+ */
+Std_ReturnType ADC_Window_Read_Event(adc_window_event_t *_event)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_tail = adc_window_queue_tail;
+    
+    if(NULL == _event)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(l_tail == adc_window_queue_head)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_event = adc_window_queue[l_tail];
+        /* Release the slot only after the copy, the interrupt may refill it right after */
+        adc_window_queue_tail = (uint8)((l_tail + 1U) & ADC_WINDOW_QUEUE_INDEX_MASK);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Gets the number of events dropped because the queue was full.
+ * @param lost_events Pointer to the count, saturates at 255.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Window_Get_Lost_Events(uint8 *lost_events)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == lost_events)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *lost_events = adc_window_lost_events;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+static void adc_window_post_event(adc_channel_select_t channel, adc_window_state_t state, adc_result_t value)
+{
+    uint8 l_next_head = (uint8)((adc_window_queue_head + 1U) & ADC_WINDOW_QUEUE_INDEX_MASK);
+    
+    if(l_next_head != adc_window_queue_tail)
+    {
+        adc_window_queue[adc_window_queue_head].channel = channel;
+        adc_window_queue[adc_window_queue_head].state = state;
+        adc_window_queue[adc_window_queue_head].value = value;
+        adc_window_queue_head = l_next_head;
+    }
+    else if(0xFFU != adc_window_lost_events)
+    {
+        adc_window_lost_events++;
+    }
+    else { /* Nothing */ }
+}
@@ -0,0 +1,107 @@
+/* 
+ * File:   hal_adc_window.h
+ * Author: Abdelrahman Aref 
+ *
+ * Created on October 19, 2026, 8:05 PM
+ */
+
+#ifndef HAL_ADC_WINDOW_H
+#define	HAL_ADC_WINDOW_H
+
+/* Section : Includes */
+#include "hal_adc.h"
+
+/* Section: Macro Declarations */
+
+#if (ADC_WINDOW_EVENT_QUEUE_SIZE & (ADC_WINDOW_EVENT_QUEUE_SIZE - 1U)) != 0U
+#error "ADC window : ADC_WINDOW_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/**
+ * @brief Position of a channel value relative to its window
+ */
+typedef enum{
+    ADC_WINDOW_STATE_UNKNOWN = 0,             /* No sample compared yet */
+    ADC_WINDOW_STATE_BELOW,
+    ADC_WINDOW_STATE_INSIDE,
+    ADC_WINDOW_STATE_ABOVE
+}adc_window_state_t;
+
+/**
+ * ADC Window Comparator
+ * @note The value leaves the window when it goes above high_threshold or below low_threshold,
+ *       it's back inside only once it is hysteresis counts past the crossed threshold,
+ *       so a noisy value on a threshold doesn't post a burst of events.
+ */
+typedef struct{
+    void (* ADC_WindowEventHandler)(void);    /* Optional, called from the ADC interrupt on a state change */
+    adc_result_t low_threshold;
+    adc_result_t high_threshold;
+    adc_result_t hysteresis;
+    volatile adc_window_state_t state;        /* Cleared by ADC_Window_Init() */
+}adc_window_t;
+
+/**
+ * Window state change event
+ */
+typedef struct{
+    adc_channel_select_t channel;             /* Channel that changed state */
+    adc_window_state_t state;                 /* New state */
+    adc_result_t value;                       /* Value that caused the change */
+}adc_window_event_t;
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Initializes the window comparator.
+ * @param _window Pointer to the window comparator.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Invalid thresholds
+ */
+Std_ReturnType ADC_Window_Init(adc_window_t *_window);
+
+/**
+ * @brief Attaches a window comparator to an ADC channel.
+ * @details Every result of the channel converted by the scan sequencer (after its filter,
+ *          if one is attached) is compared from the ADC interrupt, an event is posted only
+ *          when the state changes. The first compared value posts the initial state.
+ * @pre ADC_Window_Init() function should have been called for the window comparator.
+ * @param channel The ADC channel.
+ * @param _window Pointer to the window comparator or NULL to detach.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Window_Attach(adc_channel_select_t channel, adc_window_t *_window);
+
+/**
+ * @brief Compares a channel value with its attached window, nothing is done without a window.
+ * @param channel The ADC channel the value belongs to.
+ * @param value The value to compare.
+ */
+void ADC_Window_Channel_Update(adc_channel_select_t channel, adc_result_t value);
+
+/**
+ * @brief Gets the oldest window event.
+ * @param _event Pointer to the event.
+ * @return Status of the function:
+ *          (E_OK) : An event was read
+ *          (E_NOT_OK) : The queue is empty
+ */
+Std_ReturnType ADC_Window_Read_Event(adc_window_event_t *_event);
+
+/**
+ * @brief Gets the number of events dropped because the queue was full.
+ * @param lost_events Pointer to the count, saturates at 255.
+ * @return Status of the function:
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType ADC_Window_Get_Lost_Events(uint8 *lost_events);
+
+#endif	/* HAL_ADC_WINDOW_H */
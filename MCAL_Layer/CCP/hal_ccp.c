@@ -7,6 +7,7 @@
 
 /* ----------------- Includes -----------------*/
 #include "hal_ccp.h"
+#include "../Timer2/hal_timer2.h"
 
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     static void (*CCP1_InterruptHandler)(void) = NULL;
@@ -17,11 +18,17 @@
 #endif
   
 static void CCP_Interrupt_Config(const ccp_t *_ccp_obj);
-static void CCP_PWM_Mode_Config(const ccp_t *_ccp_obj);
+static Std_ReturnType CCP_PWM_Mode_Config(const ccp_t *_ccp_obj);
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+static Std_ReturnType CCP_PWM_Timing_Calculate(uint32 pwm_frequency, uint8 _prescaler, ccp_pwm_timing_t *_timing);
+#endif
 static void CCP_Pin_Config(const ccp_t *_ccp_obj);
 static void CCP_Mode_Timer_Select(const ccp_t *_ccp_obj);
 static Std_ReturnType CCP_Capture_Mode_Config(const ccp_t *_ccp_obj);
 static Std_ReturnType CCP_Compare_Mode_Config(const ccp_t *_ccp_obj);
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+static uint8 CCP_Time_Base_Prescaler(const ccp_t *_ccp_obj);
+#endif
    
 Std_ReturnType CCP_Init(const ccp_t *_ccp_obj)
 {
@@ -58,13 +65,18 @@ Std_ReturnType CCP_Init(const ccp_t *_ccp_obj)
         /* CCP Module PWM Mode Initialization */
         else if(CCP_PWM_MODE_SELECTED == _ccp_obj->ccp_mode)
         {
-            CCP_PWM_Mode_Config(_ccp_obj);
+            ret = CCP_PWM_Mode_Config(_ccp_obj);
         }
 #endif
         else {/* Nothing */}
         
-        /* PIN Configurations */
-        CCP_Pin_Config(_ccp_obj);
+        /* PIN Configurations, the software interrupt and special event variants leave the pin free */
+        if((CCP_COMPARE_MODE_GEN_SW_INTERRUPT != _ccp_obj->ccp_mode_variant) && 
+           (CCP_COMPARE_MODE_GEN_EVENT != _ccp_obj->ccp_mode_variant))
+        {
+            CCP_Pin_Config(_ccp_obj);
+        }
+        else { /* Nothing */ }
         /* Interrupt Configurations for CCP1 and CCP2 Modules */
         CCP_Interrupt_Config(_ccp_obj);
         
@@ -103,7 +115,7 @@ Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj)
     return ret;
 }
 
-#if (CCP1_CFG_SELECTED_MODE==CCP1_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP1_CFG_CAPTURE_MODE_SELECTED)
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
 Std_ReturnType CCP_IsCapturedDataReady(const ccp_t *_ccp_obj, uint8 *_capture_status)
 {
     Std_ReturnType ret = E_NOT_OK;
@@ -178,6 +190,39 @@ Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *captur
     }
     return ret;
 }
+
+Std_ReturnType CCP_Capture_Mode_Set_Edge(const ccp_t *_ccp_obj, uint8 capture_variant)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _ccp_obj) || 
+       ((CCP_CAPTURE_MODE_1_FALLING_EDGE != capture_variant) && (CCP_CAPTURE_MODE_1_RISING_EDGE != capture_variant)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            CCP1_SET_MODE(capture_variant);
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            /* The mode change itself may raise the flag */
+            CCP1_InterruptFlagClear();
+#endif
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst)
+        {
+            CCP2_SET_MODE(capture_variant);
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            CCP2_InterruptFlagClear();
+#endif
+        }
+        else{ /* Nothing */ }
+        
+        ret = E_OK;
+    }
+    return ret;
+}
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
@@ -252,6 +297,37 @@ Std_ReturnType CCP_Compare_Mode_Set_Value(const ccp_t *_ccp_obj, uint16 compare_
     }
     return ret;
 }
+
+Std_ReturnType CCP_Compare_Special_Event_Set_Frequency(const ccp_t *_ccp_obj, uint32 event_frequency)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_period_ticks = ZERO_INIT;
+    
+    if((NULL == _ccp_obj) || (ZERO_INIT == event_frequency) || (ZERO_INIT == _ccp_obj->special_event_timer_prescaler))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(_ccp_obj->special_event_timer_prescaler != CCP_Time_Base_Prescaler(_ccp_obj))
+    {
+        /* The period is computed for this prescaler, another one would give a wrong rate */
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_period_ticks = CCP_SPECIAL_EVENT_PERIOD_TICKS(event_frequency, _ccp_obj->special_event_timer_prescaler);
+        /* The time base is reset on match, so the period must fit the 16-bit compare register */
+        if((l_period_ticks < 2UL) || (l_period_ticks > 0x10000UL))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* Timer counts 0 .. CCPRx, so the period is (CCPRx + 1) ticks */
+            ret = CCP_Compare_Mode_Set_Value(_ccp_obj, (uint16)(l_period_ticks - 1UL));
+        }
+    }
+    return ret;
+}
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
@@ -333,6 +409,69 @@ Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj)
 
     return ret;
 }
+
+Std_ReturnType CCP_PWM_Frequency_Synthesize(uint32 pwm_frequency, ccp_pwm_timing_t *_timing)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _timing) || (ZERO_INIT == pwm_frequency))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Smallest pre-scaler first, it leaves the largest PR2 so the finest duty steps */
+        ret = CCP_PWM_Timing_Calculate(pwm_frequency, CCP_TIMER2_PRESCALER_DIV_BY_1, _timing);
+        if(E_NOT_OK == ret)
+        {
+            ret = CCP_PWM_Timing_Calculate(pwm_frequency, CCP_TIMER2_PRESCALER_DIV_BY_4, _timing);
+        }
+        else { /* Nothing */ }
+        if(E_NOT_OK == ret)
+        {
+            ret = CCP_PWM_Timing_Calculate(pwm_frequency, CCP_TIMER2_PRESCALER_DIV_BY_16, _timing);
+        }
+        else { /* Nothing */ }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType CCP_PWM_Get_Timing(const ccp_t *_ccp_obj, ccp_pwm_timing_t *_timing)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_1;
+    uint16 l_period_ticks = ZERO_INIT;
+    
+    if((NULL == _ccp_obj) || (NULL == _timing))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(TIMER2_PRESCALER_DIV_BY_1 == T2CONbits.T2CKPS)
+        {
+            l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_1;
+        }
+        else if(TIMER2_PRESCALER_DIV_BY_4 == T2CONbits.T2CKPS)
+        {
+            l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_4;
+        }
+        else
+        {
+            l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_16;
+        }
+        l_period_ticks = (uint16)PR2 + 1;
+        
+        _timing->timer2_prescaler_value = l_prescaler;
+        _timing->pr2_value = PR2;
+        _timing->achieved_frequency = ((uint32)_XTAL_FREQ / (4UL * l_prescaler)) / l_period_ticks;
+        _timing->resolution_bits = CCP_PWM_RESOLUTION_BITS_OF(l_period_ticks);
+        ret = E_OK;
+    }
+    
+    return ret;
+}
 #endif
 
 
@@ -361,11 +500,43 @@ void CCP2_ISR(void){
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
-static void CCP_PWM_Mode_Config(const ccp_t *_ccp_obj)
+static Std_ReturnType CCP_PWM_Mode_Config(const ccp_t *_ccp_obj)
 {
-    /* PWM Frequency Initialization */
-    PR2 = (uint8)(((float)_XTAL_FREQ / ((float)_ccp_obj->PWM_Frequency * 4.0 * (float)_ccp_obj->timer2_prescaler_value * 
-                    (float)_ccp_obj->timer2_postscaler_value)) - 1);
+    Std_ReturnType ret = E_NOT_OK;
+    ccp_pwm_timing_t l_timing;
+    
+    /* PWM Frequency Initialization, the period only depends on the Timer2 pre-scaler */
+    if(CCP_TIMER2_PRESCALER_AUTO == _ccp_obj->timer2_prescaler_value)
+    {
+        ret = CCP_PWM_Frequency_Synthesize(_ccp_obj->PWM_Frequency, &l_timing);
+        if(E_OK == ret)
+        {
+            /* Timer2_Init() must run before CCP_Init() or it overwrites the selected pre-scaler */
+            if(CCP_TIMER2_PRESCALER_DIV_BY_1 == l_timing.timer2_prescaler_value)
+            {
+                TIMER2_PRESCALER_SELECT(TIMER2_PRESCALER_DIV_BY_1);
+            }
+            else if(CCP_TIMER2_PRESCALER_DIV_BY_4 == l_timing.timer2_prescaler_value)
+            {
+                TIMER2_PRESCALER_SELECT(TIMER2_PRESCALER_DIV_BY_4);
+            }
+            else
+            {
+                TIMER2_PRESCALER_SELECT(TIMER2_PRESCALER_DIV_BY_16);
+            }
+        }
+        else { /* Nothing */ }
+    }
+    else
+    {
+        ret = CCP_PWM_Timing_Calculate(_ccp_obj->PWM_Frequency, _ccp_obj->timer2_prescaler_value, &l_timing);
+    }
+    
+    if(E_OK == ret)
+    {
+        PR2 = l_timing.pr2_value;
+    }
+    else { /* Nothing */ }
     
     if(CCP1_INST == _ccp_obj->ccp_inst)
     {
@@ -384,6 +555,38 @@ static void CCP_PWM_Mode_Config(const ccp_t *_ccp_obj)
         else {/* Nothing */}
     }
     else{ /* Nothing */ }
+    
+    return ret;
+}
+
+static Std_ReturnType CCP_PWM_Timing_Calculate(uint32 pwm_frequency, uint8 _prescaler, ccp_pwm_timing_t *_timing)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_period_ticks = ZERO_INIT;
+    
+    if((ZERO_INIT == pwm_frequency) || (ZERO_INIT == _prescaler))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Integer rounding to the nearest Timer2 tick, no floating point needed */
+        l_period_ticks = CCP_PWM_PERIOD_TICKS((uint32)pwm_frequency, (uint32)_prescaler);
+        if(CCP_PWM_TICKS_VALID(l_period_ticks))
+        {
+            _timing->timer2_prescaler_value = _prescaler;
+            _timing->pr2_value = (uint8)(l_period_ticks - 1UL);
+            _timing->achieved_frequency = ((uint32)_XTAL_FREQ / (4UL * _prescaler)) / l_period_ticks;
+            _timing->resolution_bits = CCP_PWM_RESOLUTION_BITS_OF(l_period_ticks);
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    
+    return ret;
 }
 #endif
 
@@ -392,56 +595,76 @@ static void CCP_Interrupt_Config(const ccp_t *_ccp_obj)
 {
 /* CCP1 Interrupt Configurations */ 
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    CCP1_InterruptEnable();
-    CCP1_InterruptFlagClear();
-    CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
+    /* The interrupt is only needed when a callback is supplied, 
+       the special event trigger for example runs without any CPU intervention */
+    if((CCP1_INST == _ccp_obj->ccp_inst) && (NULL != _ccp_obj->CCP1_InterruptHandler))
+    {
+        CCP1_InterruptEnable();
+        CCP1_InterruptFlagClear();
+        CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
 /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
-    INTERRUPT_PriorityLevelsEnable();
-    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority)
-    {
-        /* Enables all high-priority interrupts */
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP1_HighPrioritySet();
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority)
+        {
+            /* Enables all high-priority interrupts */
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP1_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority)
+        {
+            /* Enables all unmasked peripheral interrupts */
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP1_LowPrioritySet();
+        }
+        else{ /* Nothing */ }
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif          
     }
-    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority)
+    else if(CCP1_INST == _ccp_obj->ccp_inst)
     {
-        /* Enables all unmasked peripheral interrupts */
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP1_LowPrioritySet();
+        CCP1_InterruptDisable();
+        CCP1_InterruptHandler = NULL;
     }
     else{ /* Nothing */ }
-#else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
-#endif          
 #endif    
         
 /* CCP2 Interrupt Configurations */ 
 #if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    CCP2_InterruptEnable();
-    CCP2_InterruptFlagClear();
-    CCP2_InterruptHandler = _ccp_obj->CCP2_InterruptHandler;
+    if((CCP2_INST == _ccp_obj->ccp_inst) && (NULL != _ccp_obj->CCP2_InterruptHandler))
+    {
+        CCP2_InterruptEnable();
+        CCP2_InterruptFlagClear();
+        CCP2_InterruptHandler = _ccp_obj->CCP2_InterruptHandler;
 /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
-    INTERRUPT_PriorityLevelsEnable();
-    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP2_priority)
-    {
-        /* Enables all high-priority interrupts */
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP2_HighPrioritySet();
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP2_priority)
+        {
+            /* Enables all high-priority interrupts */
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP2_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP2_priority)
+        {
+            /* Enables all unmasked peripheral interrupts */
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP2_LowPrioritySet();
+        }
+        else{ /* Nothing */ }
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif          
     }
-    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP2_priority)
+    else if(CCP2_INST == _ccp_obj->ccp_inst)
     {
-        /* Enables all unmasked peripheral interrupts */
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP2_LowPrioritySet();
+        CCP2_InterruptDisable();
+        CCP2_InterruptHandler = NULL;
     }
     else{ /* Nothing */ }
-#else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
-#endif          
 #endif 
 }
 
@@ -561,6 +784,28 @@ static void CCP_Pin_Config(const ccp_t *_ccp_obj)
 
 
 
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/**
+ * @brief Reads the prescaler of the Timer1/Timer3 time base selected by T3CCP2:T3CCP1 for this module.
+ * @return CCP_TIMER13_PRESCALER_DIV_BY_x
+ */
+static uint8 CCP_Time_Base_Prescaler(const ccp_t *_ccp_obj)
+{
+    uint8 l_prescaler_select = ZERO_INIT;
+    
+    /* 1x : Timer3 for both modules, 01 : Timer3 for CCP2 only, 00 : Timer1 for both */
+    if((1 == T3CONbits.T3CCP2) || ((CCP2_INST == _ccp_obj->ccp_inst) && (1 == T3CONbits.T3CCP1)))
+    {
+        l_prescaler_select = (uint8)T3CONbits.T3CKPS;
+    }
+    else
+    {
+        l_prescaler_select = (uint8)T1CONbits.T1CKPS;
+    }
+    return (uint8)(1U << l_prescaler_select);
+}
+#endif
+
 static void CCP_Mode_Timer_Select(const ccp_t *_ccp_obj)
 {
     if(CCP1_CCP2_TIMER3 == _ccp_obj->ccp_capture_timer)
@@ -654,5 +899,15 @@ static Std_ReturnType CCP_Compare_Mode_Config(const ccp_t *_ccp_obj)
     
     CCP_Mode_Timer_Select(_ccp_obj);
     
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+    /* Periodic special event : the compare register holds the event period */
+    if((E_OK == ret) && (CCP_COMPARE_MODE_GEN_EVENT == _ccp_obj->ccp_mode_variant) && 
+       (ZERO_INIT != _ccp_obj->special_event_frequency))
+    {
+        ret = CCP_Compare_Special_Event_Set_Frequency(_ccp_obj, _ccp_obj->special_event_frequency);
+    }
+    else{ /* Nothing */ }
+#endif
+    
     return ret;
 }
\ No newline at end of file
@@ -67,7 +67,14 @@
 #define CCP_TIMER2_PRESCALER_DIV_BY_1        1
 #define CCP_TIMER2_PRESCALER_DIV_BY_4        4
 #define CCP_TIMER2_PRESCALER_DIV_BY_16       16
+/* Let CCP_Init() select the Timer2 pre-scaler giving the best duty resolution */
+#define CCP_TIMER2_PRESCALER_AUTO            0
 
+/* Timer1/Timer3 Input Clock Pre-scaler (Compare time base) */
+#define CCP_TIMER13_PRESCALER_DIV_BY_1       1
+#define CCP_TIMER13_PRESCALER_DIV_BY_2       2
+#define CCP_TIMER13_PRESCALER_DIV_BY_4       4
+#define CCP_TIMER13_PRESCALER_DIV_BY_8       8
 
 
 /* ----------------- Macro Functions Declarations -----------------*/
@@ -76,6 +83,41 @@
 #define CCP1_SET_MODE(_CONFIG)  (CCP1CONbits.CCP1M = _CONFIG)
 #define CCP2_SET_MODE(_CONFIG)  (CCP2CONbits.CCP2M = _CONFIG)
 
+/**
+ * @brief  Number of Timer1/Timer3 ticks between two compare special events
+ * @note   Rounded to the nearest tick, the achieved event rate is
+ *         (_XTAL_FREQ / 4) / (_PRESCALER_ * ticks).
+ *         Example : CCP_SPECIAL_EVENT_PERIOD_TICKS(1000UL, CCP_TIMER13_PRESCALER_DIV_BY_1)
+ *         gives 2000 ticks (1 KHz) with an 8 MHz oscillator.
+ */
+#define CCP_SPECIAL_EVENT_PERIOD_TICKS(_FREQ_, _PRESCALER_) \
+            ((((uint32)(_XTAL_FREQ) / (4UL * (uint32)(_PRESCALER_))) + ((uint32)(_FREQ_) / 2UL)) / (uint32)(_FREQ_))
+
+/**
+ * @brief  PWM timing of a constant frequency, usable in #if and in initializers
+ * @note   The PWM period is (PR2 + 1) Timer2 ticks, the duty register has 4 * (PR2 + 1) steps.
+ *         The smallest pre-scaler keeping PR2 <= 255 gives the largest PR2, so the best resolution.
+ *         Pass the frequency with the UL suffix, Example with an 8 MHz oscillator :
+ *         CCP_PWM_AUTO_PRESCALER(20000UL) = 1, CCP_PWM_AUTO_PR2(20000UL) = 99,
+ *         CCP_PWM_AUTO_RESOLUTION_BITS(20000UL) = 8, and
+ *         #if !CCP_PWM_AUTO_VALID(PWM_FREQ) / #error ... / #endif rejects unreachable frequencies.
+ */
+#define CCP_PWM_PERIOD_TICKS(_FREQ_, _PRESCALER_) \
+            ((((_XTAL_FREQ) / (4UL * (_PRESCALER_))) + ((_FREQ_) / 2UL)) / (_FREQ_))
+#define CCP_PWM_TICKS_VALID(_TICKS_)          (((_TICKS_) >= 2UL) && ((_TICKS_) <= 256UL))
+#define CCP_PWM_RESOLUTION_BITS_OF(_TICKS_) \
+            ((_TICKS_) >= 256UL ? 10 : (_TICKS_) >= 128UL ? 9 : (_TICKS_) >= 64UL ? 8 : (_TICKS_) >= 32UL ? 7 : \
+             (_TICKS_) >= 16UL ? 6 : (_TICKS_) >= 8UL ? 5 : (_TICKS_) >= 4UL ? 4 : (_TICKS_) >= 2UL ? 3 : 0)
+
+#define CCP_PWM_AUTO_PRESCALER(_FREQ_) \
+            ((CCP_PWM_PERIOD_TICKS(_FREQ_, 1UL) <= 256UL) ? 1UL : ((CCP_PWM_PERIOD_TICKS(_FREQ_, 4UL) <= 256UL) ? 4UL : 16UL))
+#define CCP_PWM_AUTO_TICKS(_FREQ_)            CCP_PWM_PERIOD_TICKS(_FREQ_, CCP_PWM_AUTO_PRESCALER(_FREQ_))
+#define CCP_PWM_AUTO_PR2(_FREQ_)              (CCP_PWM_AUTO_TICKS(_FREQ_) - 1UL)
+#define CCP_PWM_AUTO_ACHIEVED_FREQUENCY(_FREQ_) \
+            (((_XTAL_FREQ) / (4UL * CCP_PWM_AUTO_PRESCALER(_FREQ_))) / CCP_PWM_AUTO_TICKS(_FREQ_))
+#define CCP_PWM_AUTO_RESOLUTION_BITS(_FREQ_)  CCP_PWM_RESOLUTION_BITS_OF(CCP_PWM_AUTO_TICKS(_FREQ_))
+#define CCP_PWM_AUTO_VALID(_FREQ_)            CCP_PWM_TICKS_VALID(CCP_PWM_AUTO_TICKS(_FREQ_))
+
 /* ----------------- Data Type Declarations -----------------*/
 
 /*
@@ -101,6 +143,17 @@ typedef union{
     };
 }CCP_REG_T;
 
+/*
+  @Summary      PWM timing selected for a requested frequency
+  @Description  Filled by CCP_PWM_Frequency_Synthesize() and CCP_PWM_Get_Timing().
+*/
+typedef struct{
+    uint8 timer2_prescaler_value;   /* CCP_TIMER2_PRESCALER_DIV_BY_x */
+    uint8 pr2_value;                /* Timer2 period register */
+    uint32 achieved_frequency;      /* Real PWM frequency in Hz */
+    uint8 resolution_bits;          /* Duty cycle resolution, log2(4 * (PR2 + 1)) */
+}ccp_pwm_timing_t;
+
 typedef enum{
     CCP1_INST = 0,
     CCP2_INST
@@ -129,8 +182,13 @@ typedef struct{
     ccp_capture_timer_t ccp_capture_timer;
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
     uint32 PWM_Frequency;      /* CCP PWM mode frequency */
-    uint8 timer2_postscaler_value;
-    uint8 timer2_prescaler_value;
+    uint8 timer2_postscaler_value;  /* Only scales the TMR2 interrupt, doesn't affect the PWM period */
+    uint8 timer2_prescaler_value;   /* CCP_TIMER2_PRESCALER_DIV_BY_x or CCP_TIMER2_PRESCALER_AUTO */
+#endif
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+    uint32 special_event_frequency;        /* Special event rate in Hz, 0 keeps CCPRx untouched */
+    uint8 special_event_timer_prescaler;   /* Prescaler of the Timer1/Timer3 time base (CCP_TIMER13_PRESCALER_DIV_BY_x),
+                                              checked against T1CKPS/T3CKPS */
 #endif
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     void (* CCP1_InterruptHandler)(void);   /* Call back used for all CCP1 Modes */
@@ -191,6 +249,20 @@ Std_ReturnType CCP_IsCapturedDataReady(const ccp_t *_ccp_obj, uint8 *_capture_st
  *          (E_NOT_OK) : Failed to read the captured value
  */
 Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *capture_value);
+
+/**
+ * @Summary Changes the capture edge of a running capture channel.
+ * @Description Switching the capture mode can set the CCP interrupt flag on its own,
+ *              the flag is cleared after the switch so no false capture is reported.
+ *              Can be called from the CCP interrupt handler to capture both edges of a pulse.
+ * @Preconditions CCP module must be configured in capture mode.
+ * @param _ccp_obj Pointer to the CCP module configuration
+ * @param capture_variant CCP_CAPTURE_MODE_1_FALLING_EDGE or CCP_CAPTURE_MODE_1_RISING_EDGE
+ * @return Status of the function
+ *          (E_OK) : Successfully changed the capture edge
+ *          (E_NOT_OK) : Failed to change the capture edge
+ */
+Std_ReturnType CCP_Capture_Mode_Set_Edge(const ccp_t *_ccp_obj, uint8 capture_variant);
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
@@ -216,6 +288,25 @@ Std_ReturnType CCP_IsCompareComplete(const ccp_t *_ccp_obj, uint8 *_compare_stat
  *          (E_NOT_OK) : Failed to set the compare value
  */
 Std_ReturnType CCP_Compare_Mode_Set_Value(const ccp_t *_ccp_obj, uint16 compare_value);
+
+/**
+ * @Summary Loads the compare register for a periodic special event trigger.
+ * @Description The special event variant (CCP_COMPARE_MODE_GEN_EVENT) resets the Timer1/Timer3
+ *              time base on every match, so CCPRx defines the event period.
+ *              On CCP2 the same event also sets GO/DONE, which starts an A/D conversion
+ *              in hardware when the converter is enabled (see ADC_StartConversion_Triggered()).
+ *              CCP_Init() calls this routine itself when special_event_frequency is not zero.
+ * @Preconditions CCP module must be configured in compare mode with the special event variant,
+ *                Timer1/Timer3 must run in timer mode (or synchronized counter mode) and be
+ *                initialized first, with the prescaler given in special_event_timer_prescaler.
+ * @param _ccp_obj Pointer to the CCP module configuration
+ * @param event_frequency The special event rate in Hz
+ * @return Status of the function
+ *          (E_OK) : Successfully loaded the event period
+ *          (E_NOT_OK) : The rate can't be reached with the selected time base prescaler, or the
+ *                       time base runs with another prescaler than special_event_timer_prescaler
+ */
+Std_ReturnType CCP_Compare_Special_Event_Set_Frequency(const ccp_t *_ccp_obj, uint32 event_frequency);
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
@@ -252,6 +343,34 @@ Std_ReturnType CCP_PWM_Start(const ccp_t *_ccp_obj);
  *          (E_NOT_OK) : Failed to stop PWM output
  */
 Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj);
+
+/**
+ * @Summary Selects the Timer2 pre-scaler and PR2 for a PWM frequency.
+ * @Description Tries the pre-scalers 1, 4 and 16 and keeps the first one where the period
+ *              fits in PR2, which is the setting with the highest duty resolution.
+ *              Only computes the timing, no register is written.
+ *              CCP_Init() uses it when timer2_prescaler_value is CCP_TIMER2_PRESCALER_AUTO,
+ *              see CCP_PWM_AUTO_xxx() for the compile-time equivalent.
+ * @Preconditions None
+ * @param pwm_frequency The requested PWM frequency in Hz
+ * @param _timing Pointer to the selected timing
+ * @return Status of the function
+ *          (E_OK) : The frequency can be generated
+ *          (E_NOT_OK) : The frequency is out of the Timer2 range
+ */
+Std_ReturnType CCP_PWM_Frequency_Synthesize(uint32 pwm_frequency, ccp_pwm_timing_t *_timing);
+
+/**
+ * @Summary Reads back the PWM timing currently programmed in Timer2.
+ * @Description Both CCP modules share the Timer2 time base, so the timing is the same for CCP1 and CCP2.
+ * @Preconditions CCP module must be configured in PWM mode.
+ * @param _ccp_obj Pointer to the CCP module configuration
+ * @param _timing Pointer to the running timing
+ * @return Status of the function
+ *          (E_OK) : Successfully read the timing
+ *          (E_NOT_OK) : Failed to read the timing
+ */
+Std_ReturnType CCP_PWM_Get_Timing(const ccp_t *_ccp_obj, ccp_pwm_timing_t *_timing);
 #endif
 
 
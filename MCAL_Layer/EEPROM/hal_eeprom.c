@@ -81,3 +81,72 @@ Std_ReturnType Data_EEPROM_ReadByte(uint16 bAdd, uint8 *bData){
     }
     return ret;
 }
+
+/**
+ * @Summary Starts writing a data byte to Data EEPROM without waiting for it
+ * @Description The address, the data and the 0x55/0xAA/WR unlock sequence are loaded with the
+ *              interrupts disabled (a few instruction cycles), the write then runs for about 4 ms
+ *              with the interrupts enabled. EEADR/EEDATA must not change until it is done, no
+ *              other Data EEPROM access may run meanwhile, poll Data_EEPROM_Write_Done().
+ * @Preconditions No Data EEPROM write is in progress
+ * @param bAdd - Data EEPROM location to which data to be written
+ * @param bData - Data to be written to Data EEPROM location
+ * @return Status of the function
+ *          (E_OK) : The write was started
+ *          (E_NOT_OK) : A write is still in progress
+ * @Example ret = Data_EEPROM_Write_Start(0x3ff, 0);
+ */
+Std_ReturnType Data_EEPROM_Write_Start(uint16 bAdd, uint8 bData){
+    Std_ReturnType ret = E_NOT_OK;
+    /* Read the Interrupt Status "Enabled or Disabled" */
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+    if(INITIATE_DATA_EEPROM_WRITE_ERASE == EECON1bits.WR){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* An interrupt reading the EEPROM can't move the address between the set up and the unlock */
+        INTERRUPT_GlobalInterruptDisable();
+        EEADRH = (uint8)((bAdd >> 8) & 0x03);
+        EEADR = (uint8)(bAdd & 0xFF);
+        EEDATA = bData;
+        EECON1bits.EEPGD = ACCESS_EEPROM_PROGRAM_MEMORY;
+        EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
+        EECON1bits.WREN = ALLOW_WRITE_CYCLES_FLASH_EEPROM;
+        EECON2 = 0x55;
+        EECON2 = 0xAA;
+        EECON1bits.WR = INITIATE_DATA_EEPROM_WRITE_ERASE;
+        /* Restore the Interrupt Status "Enabled or Disabled" */
+        INTCONbits.GIE = Global_Interrupt_Status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @Summary Checks the end of a write started by Data_EEPROM_Write_Start()
+ * @Description Write cycles are inhibited again once the write is done.
+ * @Preconditions None
+ * @param bDone - 1 when no write is in progress, 0 while the write runs
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @Example ret = Data_EEPROM_Write_Done(&eeprom_write_done);
+ */
+Std_ReturnType Data_EEPROM_Write_Done(uint8 *bDone){
+    Std_ReturnType ret = E_NOT_OK;
+    if(NULL == bDone){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(DATA_EEPROM_WRITE_ERASE_COMPLETED == EECON1bits.WR){
+            /* Inhibits write cycles to Flash program/data EEPROM */
+            EECON1bits.WREN = INHIBTS_WRITE_CYCLES_FLASH_EEPROM;
+            *bDone = 1;
+        }
+        else{
+            *bDone = 0;
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
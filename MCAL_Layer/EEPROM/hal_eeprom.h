@@ -36,6 +36,8 @@
 /* ----------------- Software Interfaces Declarations -----------------*/
 Std_ReturnType Data_EEPROM_WriteByte(uint16 bAdd, uint8 bData);
 Std_ReturnType Data_EEPROM_ReadByte(uint16 bAdd, uint8 *bData);
+Std_ReturnType Data_EEPROM_Write_Start(uint16 bAdd, uint8 bData);
+Std_ReturnType Data_EEPROM_Write_Done(uint8 *bDone);
 
 #endif	/* HAL_EEPROM_H */
 
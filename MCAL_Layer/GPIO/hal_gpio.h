@@ -77,6 +77,9 @@ typedef struct
     uint8 LOGIC      : 1;       /* @ref  logic_t */
 }pin_config_t;
 
+/* Data Latch Registers indexed by @ref PORT_INDEX_t, for drivers writing several pins at once */
+extern volatile uint8 *LAT_REGESTERS[];
+
 /* Section: Function Declarations */
 Std_ReturnType gpio_pin_direction_intialize(const pin_config_t *pin_config);
 Std_ReturnType gpio_pin_get_direction_status(const pin_config_t *pin_config, direction_t *direction_status);
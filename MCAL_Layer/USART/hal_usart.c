@@ -6,20 +6,81 @@
  */
 
 #include "hal_usart.h"
+#include "../mcal_shared_read.h"
 
 
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     static void (*EUSART_TxInterruptHandler)(void) = NULL;
+    /* Transmit ring buffer, the head is moved by the writers and the tail by EUSART_TX_ISR() */
+    static uint8 eusart_tx_buffer[EUSART_TX_BUFFER_SIZE];
+    static volatile uint8 eusart_tx_head = ZERO_INIT;
+    static volatile uint8 eusart_tx_tail = ZERO_INIT;
+    /* 9th bit of each queued byte (TX9D), set for the multi-drop address bytes */
+    static uint8 eusart_tx_ninth_bits[(EUSART_TX_BUFFER_SIZE + 7U) / 8U];
+    /* Set when EUSART_ASYNC_Init() enabled the transmit interrupt */
+    static uint8 eusart_tx_buffered = ZERO_INIT;
+    /* Data sent in place by EUSART_TX_ISR() once the ring buffer is drained */
+    static volatile uint8 eusart_tx_streaming = ZERO_INIT;
+    static const uint8 *eusart_tx_stream_data = NULL;
+    static uint16 eusart_tx_stream_remaining = ZERO_INIT;
+    static const usart_tx_segment_t *eusart_tx_stream_segments = NULL;
+    static uint8 eusart_tx_stream_count = ZERO_INIT;
 #endif
-#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     static void (*EUSART_RxInterruptHandler)(void) = NULL;
     static void (*EUSART_FramingErrorHandler)(void) = NULL;
     static void (*EUSART_OverrunErrorHandler)(void) = NULL;
+    /* Receive ring buffer, the head is moved by EUSART_RX_ISR() and the tail by the readers */
+    static uint8 eusart_rx_buffer[EUSART_RX_BUFFER_SIZE];
+    static volatile uint8 eusart_rx_head = ZERO_INIT;
+    static volatile uint8 eusart_rx_tail = ZERO_INIT;
+    /* Set when EUSART_ASYNC_Init() enabled the receive interrupt */
+    static uint8 eusart_rx_buffered = ZERO_INIT;
+    /* Error counters, only written by EUSART_RX_ISR() */
+    static volatile uint16 eusart_rx_framing_errors = ZERO_INIT;
+    static volatile uint16 eusart_rx_overrun_errors = ZERO_INIT;
+    static volatile uint16 eusart_rx_buffer_overflows = ZERO_INIT;
+    /* Auto-baud acquisition, driven by EUSART_RX_ISR() */
+    static volatile usart_autobaud_status_t eusart_autobaud_status = EUSART_AUTOBAUD_IDLE;
+    static uint8 eusart_autobaud_scan_index = ZERO_INIT;
+    static const uint32 eusart_standard_baudrates[] = {1200UL, 2400UL, 4800UL, 9600UL, 19200UL,
+                                                       38400UL, 57600UL, 115200UL};
+    /* Multi-drop address detect, ADDEN is cleared while the node is selected */
+    static uint8 eusart_rx_address_detect = ZERO_INIT;
+    static uint8 eusart_rx_node_address = ZERO_INIT;
+    static volatile uint8 eusart_rx_selected = ZERO_INIT;
+    static volatile uint8 eusart_rx_selected_address = ZERO_INIT;
+    /* Synchronous mode, the remaining bytes of a read are counted by EUSART_RX_ISR() */
+    static uint8 eusart_sync_enabled = ZERO_INIT;
+    static uint8 eusart_sync_master = ZERO_INIT;
+    static volatile uint16 eusart_sync_rx_remaining = ZERO_INIT;
+    static void (*EUSART_SyncRxDoneHandler)(void) = NULL;
 #endif    
 
-static void EUSART_Baud_Rate_Calculation(const usart_t *_eusart);
+/* Baud rate reached by the selected BRG setting */
+static uint32 eusart_achieved_baudrate = ZERO_INIT;
+static sint32 eusart_baudrate_error_ppm = ZERO_INIT;
+
+static Std_ReturnType EUSART_Baud_Rate_Calculation(uint32 _baudrate, baudrate_gen_t _baudrate_gen);
+static Std_ReturnType EUSART_BRG_Solve(uint32 _baudrate, uint8 _divider, uint16 _brg_max,
+                                       uint16 *_brg, uint32 *_achieved, sint32 *_error_ppm);
 static void EUSART_ASYNC_TX_Init(const usart_t *_eusart);
 static void EUSART_ASYNC_RX_Init(const usart_t *_eusart);
+static uint16 EUSART_TX_Free_Space(void);
+static Std_ReturnType EUSART_TX_Write(uint8 _data, uint8 _ninth_bit);
+static void EUSART_Module_DeInit(void);
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+static Std_ReturnType EUSART_TX_Stream_Start(const uint8 *_data, uint16 _length,
+                                             const usart_tx_segment_t *_segments, uint8 _count);
+static void EUSART_TX_Stream_Next(void);
+#endif
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+static void EUSART_AutoBaud_Step(void);
+static void EUSART_AutoBaud_Measure(void);
+static void EUSART_AutoBaud_Next_Rate(void);
+static void EUSART_SYNC_Receive_Next(void);
+static uint16 EUSART_SYNC_Remaining(void);
+#endif
 
 Std_ReturnType EUSART_ASYNC_Init(const usart_t *_eusart)
 {
@@ -34,11 +95,19 @@ Std_ReturnType EUSART_ASYNC_Init(const usart_t *_eusart)
         RCSTAbits.SPEN = EUSART_MODULE_DISABLE; /* Disable EUSART Module */
         TRISCbits.RC7 = 1;                      /* RX : Input Configuration as needed */
         TRISCbits.RC6 = 1;                      /* TX : Input Configuration as needed */
-        EUSART_Baud_Rate_Calculation(_eusart);
-        EUSART_ASYNC_TX_Init(_eusart);
-        EUSART_ASYNC_RX_Init(_eusart);
-        RCSTAbits.SPEN = EUSART_MODULE_ENABLE;  /* Enable EUSART Module */
-        ret = E_OK;
+        ret = EUSART_Baud_Rate_Calculation(_eusart->baudrate, _eusart->baudrate_gen_gonfig);
+        if(E_OK == ret)
+        {
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            eusart_sync_enabled = ZERO_INIT;
+            eusart_sync_master = ZERO_INIT;
+            eusart_sync_rx_remaining = ZERO_INIT;
+#endif
+            EUSART_ASYNC_TX_Init(_eusart);
+            EUSART_ASYNC_RX_Init(_eusart);
+            RCSTAbits.SPEN = EUSART_MODULE_ENABLE;  /* Enable EUSART Module */
+        }
+        else { /* The rate can't be reached within EUSART_BAUDRATE_MAX_ERROR_PPM, stay disabled */ }
     }
     return ret;
 }
@@ -47,6 +116,24 @@ Std_ReturnType EUSART_ASYNC_DeInit(const usart_t *_eusart)
 {
     Std_ReturnType ret = E_NOT_OK;
     
+    if(NULL == _eusart)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_Module_DeInit();
+        ret = E_OK;
+    }
+    return ret;
+}
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+Std_ReturnType EUSART_SYNC_Init(const usart_sync_t *_eusart)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    usart_t l_eusart;
+    
     if(NULL == _eusart)
     {
         ret = E_NOT_OK;
@@ -54,31 +141,201 @@ Std_ReturnType EUSART_ASYNC_DeInit(const usart_t *_eusart)
     else
     {
         RCSTAbits.SPEN = EUSART_MODULE_DISABLE; /* Disable EUSART Module */
+        TRISCbits.RC7 = 1;                      /* DT : Input Configuration as needed */
+        TRISCbits.RC6 = 1;                      /* CK : Input Configuration as needed */
+        if(EUSART_SYNCHRONOUS_MASTER == _eusart->usart_sync_cfg.usart_sync_master)
+        {
+            /* Sets SYNC, the master clock is Fosc / (4 * (BRG + 1)) */
+            if((BAUDRATE_SYN_8BIT == _eusart->baudrate_gen_gonfig) || (BAUDRATE_SYN_16BIT == _eusart->baudrate_gen_gonfig))
+            {
+                ret = EUSART_Baud_Rate_Calculation(_eusart->clock_rate, _eusart->baudrate_gen_gonfig);
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+        }
+        else
+        {
+            /* The slave runs on the master clock, the baud rate generator is not used */
+            TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
+            ret = E_OK;
+        }
         
-#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-        EUSART_RX_InterruptDisable();
+        if(E_OK == ret)
+        {
+            TXSTAbits.CSRC = _eusart->usart_sync_cfg.usart_sync_master;
+            BAUDCONbits.SCKP = _eusart->usart_sync_cfg.usart_sync_clock_polarity;
+            
+            /* Same ring buffers and interrupts as the asynchronous mode, 8-bit transfers */
+            (void)memset(&l_eusart, 0, sizeof(l_eusart));
+            l_eusart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+            l_eusart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+            l_eusart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+            l_eusart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
+            l_eusart.usart_tx_cfg.usart_tx_int_priority = _eusart->usart_sync_cfg.usart_tx_int_priority;
+            l_eusart.usart_rx_cfg.usart_rx_int_priority = _eusart->usart_sync_cfg.usart_rx_int_priority;
 #endif
+            l_eusart.EUSART_TxDefaultInterruptHandler = _eusart->EUSART_SyncTxDoneHandler;
+            eusart_sync_enabled = 1;
+            eusart_sync_master = _eusart->usart_sync_cfg.usart_sync_master;
+            eusart_sync_rx_remaining = ZERO_INIT;
+            EUSART_SyncRxDoneHandler = _eusart->EUSART_SyncRxDoneHandler;
+            EUSART_ASYNC_TX_Init(&l_eusart);
+            EUSART_ASYNC_RX_Init(&l_eusart);
+            
+            /* Idle bus : CREN set by EUSART_ASYNC_RX_Init() would make a master clock continuously */
+            RCSTAbits.CREN = 0;
+            RCSTAbits.SREN = 0;
+            RCSTAbits.SPEN = EUSART_MODULE_ENABLE;  /* Enable EUSART Module */
+        }
+        else { /* The clock rate can't be reached within EUSART_BAUDRATE_MAX_ERROR_PPM, stay disabled */ }
+    }
+    return ret;
+}
 
-#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+Std_ReturnType EUSART_SYNC_DeInit(const usart_sync_t *_eusart)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _eusart)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_Module_DeInit();
+        TXSTAbits.CSRC = EUSART_SYNCHRONOUS_SLAVE;
+        TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_SYNC_Write(const uint8 *_data, uint16 _length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _data) || (ZERO_INIT == eusart_sync_enabled))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(ZERO_INIT != EUSART_SYNC_Remaining())
+    {
+        /* Half-duplex, DT is still an input */
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* A set CREN or SREN takes precedence over the transmission */
+        RCSTAbits.CREN = 0;
+        RCSTAbits.SREN = 0;
+        ret = EUSART_ASYNC_WriteNonBlocking(_data, _length);
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_SYNC_Read_Start(uint16 _length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_idle = ZERO_INIT;
+    
+    (void)EUSART_ASYNC_TX_Idle(&l_idle);
+    if((ZERO_INIT == eusart_sync_enabled) || (ZERO_INIT == _length))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((ZERO_INIT == l_idle) || (ZERO_INIT != EUSART_SYNC_Remaining()))
+    {
+        /* Setting CREN or SREN now would abort the byte being sent */
+        ret = E_NOT_OK;
+    }
+    else
+    {
         EUSART_RX_InterruptDisable();
-#endif
+        eusart_sync_rx_remaining = _length;
+        if(eusart_sync_master)
+        {
+            EUSART_SYNC_Receive_Next();
+        }
+        else
+        {
+            RCSTAbits.CREN = 1;
+        }
+        EUSART_RX_InterruptEnable();
         ret = E_OK;
     }
     return ret;
 }
 
+Std_ReturnType EUSART_SYNC_Busy(uint8 *_busy)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_idle = ZERO_INIT;
+    
+    if(NULL == _busy)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        (void)EUSART_ASYNC_TX_Idle(&l_idle);
+        *_busy = (uint8)((ZERO_INIT == l_idle) || (ZERO_INIT != EUSART_SYNC_Remaining()));
+        ret = E_OK;
+    }
+    return ret;
+}
+#endif
+
 Std_ReturnType EUSART_ASYNC_ReadByteBlocking(uint8 *_data)
 {
     Std_ReturnType ret = E_NOT_OK;
-    while(!PIR1bits.RCIF);
-    *_data = RCREG;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(E_OK != EUSART_ASYNC_ReadByteNonBlocking(_data));
+        ret = E_OK;
+    }
     return ret;
 }
 
 Std_ReturnType EUSART_ASYNC_ReadByteNonBlocking(uint8 *_data)
 {
     Std_ReturnType ret = E_NOT_OK;
-    if(1 == PIR1bits.RCIF)
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    else if(eusart_rx_buffered)
+    {
+        if(eusart_rx_tail != eusart_rx_head)
+        {
+            *_data = eusart_rx_buffer[eusart_rx_tail];
+            eusart_rx_tail = (uint8)((eusart_rx_tail + 1U) & (EUSART_RX_BUFFER_SIZE - 1U));
+            if(eusart_sync_master)
+            {
+                /* A master read waiting for room goes on */
+                EUSART_RX_InterruptDisable();
+                EUSART_SYNC_Receive_Next();
+                EUSART_RX_InterruptEnable();
+            }
+            else { /* Nothing */ }
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+#endif
+    else if(1 == PIR1bits.RCIF)
     {
         *_data = RCREG;
         ret = E_OK;
@@ -90,6 +347,146 @@ Std_ReturnType EUSART_ASYNC_ReadByteNonBlocking(uint8 *_data)
     return ret;
 }
 
+Std_ReturnType EUSART_ASYNC_RX_Available(uint16 *_count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        if(eusart_rx_buffered)
+        {
+            *_count = (uint16)((uint8)(eusart_rx_head - eusart_rx_tail) & (EUSART_RX_BUFFER_SIZE - 1U));
+        }
+        else
+        {
+            *_count = (uint16)PIR1bits.RCIF;
+        }
+#else
+        *_count = (uint16)PIR1bits.RCIF;
+#endif
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_Read(uint8 *_data, uint16 _length, uint16 *_read_count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_count = ZERO_INIT;
+    
+    if((NULL == _data) || (NULL == _read_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while((l_count < _length) && (E_OK == EUSART_ASYNC_ReadByteNonBlocking(&_data[l_count])))
+        {
+            l_count++;
+        }
+        *_read_count = l_count;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNC_RX_Get_Statistics(usart_rx_statistics_t *_statistics)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _statistics->framing_errors = MCAL_Read_Shared_U16(&eusart_rx_framing_errors);
+        _statistics->overrun_errors = MCAL_Read_Shared_U16(&eusart_rx_overrun_errors);
+        _statistics->buffer_overflows = MCAL_Read_Shared_U16(&eusart_rx_buffer_overflows);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_RX_Clear_Statistics(void)
+{
+    Std_ReturnType ret = E_OK;
+    
+    EUSART_RX_InterruptDisable();
+    eusart_rx_framing_errors = ZERO_INIT;
+    eusart_rx_overrun_errors = ZERO_INIT;
+    eusart_rx_buffer_overflows = ZERO_INIT;
+    if(eusart_rx_buffered)
+    {
+        EUSART_RX_InterruptEnable();
+    }
+    else { /* Nothing */ }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_AutoBaud_Start(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(ZERO_INIT == eusart_rx_buffered)
+    {
+        /* The acquisition runs in EUSART_RX_ISR() */
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_RX_InterruptDisable();
+        eusart_autobaud_scan_index = ZERO_INIT;
+        EUSART_AutoBaud_Measure();
+        EUSART_RX_InterruptEnable();
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_AutoBaud_Status(usart_autobaud_status_t *_status)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_status = eusart_autobaud_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_MultiDrop_Selected(uint8 *_address)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _address)
+    {
+        ret = E_NOT_OK;
+    }
+    else if((eusart_rx_address_detect) && (eusart_rx_selected))
+    {
+        *_address = eusart_rx_selected_address;
+        ret = E_OK;
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+#endif
+
 Std_ReturnType EUSART_ASYNC_RX_Restart(void)
 {
     Std_ReturnType ret = E_OK;
@@ -101,111 +498,370 @@ Std_ReturnType EUSART_ASYNC_RX_Restart(void)
 Std_ReturnType EUSART_ASYNC_WriteByteBlocking(uint8 _data)
 {
     Std_ReturnType ret = E_OK;
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(eusart_tx_buffered)
+    {
+        /* Keep the order with the queued bytes, only wait for one free slot */
+        while(ZERO_INIT == EUSART_TX_Free_Space());
+        ret = EUSART_ASYNC_WriteByteNonBlocking(_data);
+    }
+    else
+    {
+        while(!TXSTAbits.TRMT);
+        EUSART_TX_InterruptEnable();
+        TXSTAbits.TX9D = 0;
+        TXREG = _data;
+    }
+#else
     while(!TXSTAbits.TRMT);
+    TXSTAbits.TX9D = 0;
+    TXREG = _data;
+#endif
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_WriteStringBlocking(const uint8 *_data)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 char_counter = ZERO_INIT;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(_data[char_counter] != '\0')
+        {
+            ret = EUSART_ASYNC_WriteByteBlocking(_data[char_counter]);
+            char_counter++;
+        }
+        
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_WriteByteNonBlocking(uint8 _data)
+{
+    return EUSART_TX_Write(_data, 0U);
+}
+
+Std_ReturnType EUSART_ASYNC_WriteAddressNonBlocking(uint8 _address)
+{
+    return EUSART_TX_Write(_address, 1U);
+}
+
+Std_ReturnType EUSART_ASYNC_WriteStringNonBlocking(const uint8 *_data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = EUSART_ASYNC_WriteNonBlocking(_data, (uint16)strlen((const char *)_data));
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_WriteNonBlocking(const uint8 *_data, uint16 _length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_index = ZERO_INIT;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(_length > EUSART_TX_Free_Space())
+    {
+        /* All or nothing, a message is never cut in the middle */
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        for(l_index = 0; l_index < _length; l_index++)
+        {
+            ret = EUSART_ASYNC_WriteByteNonBlocking(_data[l_index]);
+        }
+    }
+    return ret;
+}
+
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    EUSART_TX_InterruptEnable();
+Std_ReturnType EUSART_ASYNC_StreamStringNonBlocking(const uint8 *_data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = EUSART_TX_Stream_Start(_data, (uint16)strlen((const char *)_data), NULL, 0U);
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_StreamSegmentsNonBlocking(const usart_tx_segment_t *_segments, uint8 _count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == _segments) || (ZERO_INIT == _count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = EUSART_TX_Stream_Start(NULL, 0U, _segments, _count);
+    }
+    return ret;
+}
 #endif
-    TXREG = _data;
+
+Std_ReturnType EUSART_ASYNC_MultiDrop_Write(uint8 _address, const uint8 *_data, uint16 _length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_index = ZERO_INIT;
+    
+    if(NULL == _data)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(((uint32)_length + 1UL) > EUSART_TX_Free_Space())
+    {
+        /* All or nothing, the address is never sent without its data */
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = EUSART_TX_Write(_address, 1U);
+        for(l_index = 0; l_index < _length; l_index++)
+        {
+            ret = EUSART_TX_Write(_data[l_index], 0U);
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_Send_Break(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_idle = ZERO_INIT;
+    
+    (void)EUSART_ASYNC_TX_Idle(&l_idle);
+    if(ZERO_INIT == l_idle)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* The dummy byte goes straight to the shift register, TXREG is free again for the next byte */
+        TXSTAbits.SENDB = 1;
+        TXSTAbits.TX9D = 0;
+        TXREG = 0x00U;
+        ret = E_OK;
+    }
     return ret;
 }
 
-Std_ReturnType EUSART_ASYNC_WriteStringBlocking(uint8 *_data)
+Std_ReturnType EUSART_ASYNC_TX_Free(uint16 *_free)
 {
-    Std_ReturnType ret = E_OK;
-    uint16 char_counter = ZERO_INIT;
+    Std_ReturnType ret = E_NOT_OK;
     
-    if(NULL == _data)
+    if(NULL == _free)
     {
         ret = E_NOT_OK;
     }
     else
     {
-        while(_data[char_counter] != '\0')
-        {
-            ret = EUSART_ASYNC_WriteByteBlocking(_data[char_counter]);
-            char_counter++;
-        }
-        
+        *_free = EUSART_TX_Free_Space();
         ret = E_OK;
     }
     return ret;
 }
 
-Std_ReturnType EUSART_ASYNC_WriteByteNonBlocking(uint8 _data)
+Std_ReturnType EUSART_ASYNC_TX_Idle(uint8 *_idle)
 {
-    Std_ReturnType ret = E_OK;
+    Std_ReturnType ret = E_NOT_OK;
     
-    if(1 == TXSTAbits.TRMT)
+    if(NULL == _idle)
+    {
+        ret = E_NOT_OK;
+    }
+    else
     {
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    EUSART_TX_InterruptEnable();
+        *_idle = (uint8)((eusart_tx_tail == eusart_tx_head) && (ZERO_INIT == eusart_tx_streaming) &&
+                         (1 == TXSTAbits.TRMT));
+#else
+        *_idle = (uint8)(1 == TXSTAbits.TRMT);
 #endif
-        TXREG = _data;
         ret = E_OK;
     }
     return ret;
 }
 
-Std_ReturnType EUSART_ASYNC_WriteStringNonBlocking(uint8 *_data)
+Std_ReturnType EUSART_Get_Baud_Rate(uint32 *_baudrate, sint32 *_error_ppm)
 {
-    Std_ReturnType ret = E_OK;
+    Std_ReturnType ret = E_NOT_OK;
     
-    uint8 char_counter = 0;
-    if(_data != NULL)
+    if((NULL == _baudrate) || (NULL == _error_ppm))
     {
-        while(_data[char_counter] != '\0')
-        {
-            ret = EUSART_ASYNC_WriteByteNonBlocking(_data[char_counter]);
-            char_counter++;
-        }
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *_baudrate = eusart_achieved_baudrate;
+        *_error_ppm = eusart_baudrate_error_ppm;
         ret = E_OK;
     }
     return ret;
 }
 
-static void EUSART_Baud_Rate_Calculation(const usart_t *_eusart)
+static Std_ReturnType EUSART_Baud_Rate_Calculation(uint32 _baudrate, baudrate_gen_t _baudrate_gen)
 {
-    float Baud_Rate_Temp = 0;
-    switch(_eusart->baudrate_gen_gonfig)
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_brg = ZERO_INIT;
+    uint16 l_candidate_brg = ZERO_INIT;
+    uint32 l_achieved = ZERO_INIT;
+    uint32 l_candidate_achieved = ZERO_INIT;
+    sint32 l_error_ppm = ZERO_INIT;
+    sint32 l_candidate_error_ppm = ZERO_INIT;
+    uint8 l_brgh = EUSART_ASYNCHRONOUS_LOW_SPEED;
+    uint8 l_brg16 = EUSART_08BIT_BAUDRATE_GEN;
+    uint8 l_mode = ZERO_INIT;
+    /* BRGH, BRG16 and divider of each asynchronous mode, in the baudrate_gen_t order */
+    static const uint8 l_async_brgh[4] = {EUSART_ASYNCHRONOUS_LOW_SPEED, EUSART_ASYNCHRONOUS_HIGH_SPEED,
+                                          EUSART_ASYNCHRONOUS_LOW_SPEED, EUSART_ASYNCHRONOUS_HIGH_SPEED};
+    static const uint8 l_async_brg16[4] = {EUSART_08BIT_BAUDRATE_GEN, EUSART_08BIT_BAUDRATE_GEN,
+                                           EUSART_16BIT_BAUDRATE_GEN, EUSART_16BIT_BAUDRATE_GEN};
+    static const uint8 l_async_divider[4] = {64U, 16U, 16U, 4U};
+    
+    switch(_baudrate_gen)
     {
         case BAUDRATE_ASYN_8BIT_lOW_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED;
-            BAUDCONbits.BRG16 = EUSART_08BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 64) - 1;
-            break;
         case BAUDRATE_ASYN_8BIT_HIGH_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
-            BAUDCONbits.BRG16 = EUSART_08BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 16) - 1;
-            break;
         case BAUDRATE_ASYN_16BIT_lOW_SPEED:
+        case BAUDRATE_ASYN_16BIT_HIGH_SPEED:
+            l_mode = (uint8)_baudrate_gen;
             TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 16) - 1;
+            l_brgh = l_async_brgh[l_mode];
+            l_brg16 = l_async_brg16[l_mode];
+            ret = EUSART_BRG_Solve(_baudrate, l_async_divider[l_mode],
+                                   (EUSART_16BIT_BAUDRATE_GEN == l_brg16) ? 0xFFFFU : 0xFFU,
+                                   &l_brg, &l_achieved, &l_error_ppm);
             break;
-        case BAUDRATE_ASYN_16BIT_HIGH_SPEED:
+        case BAUDRATE_ASYN_AUTO:
             TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 4) - 1;
+            /* Try every BRGH/BRG16 combination and keep the smallest error,
+               on a tie the later mode wins as it has the finer BRG step */
+            for(l_mode = 0; l_mode < 4U; l_mode++)
+            {
+                if((E_OK == EUSART_BRG_Solve(_baudrate, l_async_divider[l_mode],
+                                             (EUSART_16BIT_BAUDRATE_GEN == l_async_brg16[l_mode]) ? 0xFFFFU : 0xFFU,
+                                             &l_candidate_brg, &l_candidate_achieved, &l_candidate_error_ppm)) &&
+                   ((E_NOT_OK == ret) || (labs(l_candidate_error_ppm) <= labs(l_error_ppm))))
+                {
+                    l_brgh = l_async_brgh[l_mode];
+                    l_brg16 = l_async_brg16[l_mode];
+                    l_brg = l_candidate_brg;
+                    l_achieved = l_candidate_achieved;
+                    l_error_ppm = l_candidate_error_ppm;
+                    ret = E_OK;
+                }
+                else { /* Nothing */ }
+            }
             break;
         case BAUDRATE_SYN_8BIT:
             TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
-            BAUDCONbits.BRG16 = EUSART_08BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 4) - 1;
+            l_brg16 = EUSART_08BIT_BAUDRATE_GEN;
+            ret = EUSART_BRG_Solve(_baudrate, 4U, 0xFFU, &l_brg, &l_achieved, &l_error_ppm);
             break;
         case BAUDRATE_SYN_16BIT:
             TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = ((_XTAL_FREQ / (float)_eusart->baudrate) / 4) - 1;
+            l_brg16 = EUSART_16BIT_BAUDRATE_GEN;
+            ret = EUSART_BRG_Solve(_baudrate, 4U, 0xFFFFU, &l_brg, &l_achieved, &l_error_ppm);
             break;
-        default : ;
+        default : ret = E_NOT_OK;
+    }
+    
+    if((E_OK == ret) && (labs(l_error_ppm) <= (sint32)EUSART_BAUDRATE_MAX_ERROR_PPM))
+    {
+        TXSTAbits.BRGH = l_brgh;
+        BAUDCONbits.BRG16 = l_brg16;
+        SPBRG = (uint8)l_brg;
+        SPBRGH = (uint8)(l_brg >> 8);
+        eusart_baudrate_error_ppm = l_error_ppm;
+        eusart_achieved_baudrate = l_achieved;
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Finds the rounded BRG value for one mode and its error.
+ * @param _baudrate Requested baud rate
+ * @param _divider Clock divider of the mode (64, 16 or 4)
+ * @param _brg_max Largest BRG value of the mode
+ * @param _brg Pointer to the BRG value
+ * @param _achieved Pointer to the reached baud rate
+ * @param _error_ppm Pointer to the error of the achieved rate, in ppm of the requested rate
+ * @return E_NOT_OK when the rate is out of the mode range
+ */
+static Std_ReturnType EUSART_BRG_Solve(uint32 _baudrate, uint8 _divider, uint16 _brg_max,
+                                       uint16 *_brg, uint32 *_achieved, sint32 *_error_ppm)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_step = ZERO_INIT;
+    uint32 l_count = ZERO_INIT;
+    uint32 l_reached = ZERO_INIT;
+    uint32 l_difference = ZERO_INIT;
+    uint32 l_error = ZERO_INIT;
+    
+    if(ZERO_INIT == _baudrate)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* BRG + 1 = Fosc / (divider * baud), rounded to the nearest */
+        l_step = (uint32)_divider * _baudrate;
+        l_count = (_XTAL_FREQ + (l_step / 2UL)) / l_step;
+        
+        if((ZERO_INIT == l_count) || (l_count > ((uint32)_brg_max + 1UL)))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* Error = (Fosc - divider * baud * (BRG + 1)) / (divider * baud * (BRG + 1)) */
+            l_reached = l_step * l_count;
+            l_difference = (_XTAL_FREQ > l_reached) ? (_XTAL_FREQ - l_reached) : (l_reached - _XTAL_FREQ);
+            if(l_difference < (l_reached / 16UL))
+            {
+                l_error = (l_difference * 1000UL) / (l_reached / 1000UL);
+            }
+            else
+            {
+                /* Over 6 percent off, the precision doesn't matter anymore */
+                l_error = (l_difference / (l_reached / 1000UL)) * 1000UL;
+            }
+            *_error_ppm = (_XTAL_FREQ > l_reached) ? (sint32)l_error : -(sint32)l_error;
+            *_brg = (uint16)(l_count - 1UL);
+            *_achieved = (_XTAL_FREQ + (((uint32)_divider * l_count) / 2UL)) / ((uint32)_divider * l_count);
+            ret = E_OK;
+        }
     }
-    SPBRG = (uint8)((uint32)Baud_Rate_Temp);
-    SPBRGH = (uint8)(((uint32)Baud_Rate_Temp) >> 8);
+    return ret;
 }
 
 static void EUSART_ASYNC_TX_Init(const usart_t *_eusart)
@@ -216,11 +872,14 @@ static void EUSART_ASYNC_TX_Init(const usart_t *_eusart)
         /* EUSART Transmit Interrupt Configuration */
         if(EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE == _eusart->usart_tx_cfg.usart_tx_interrupt_enable)
         {
-            PIE1bits.TXIE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
             /* Interrupt Configurations */ 
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
             EUSART_TxInterruptHandler = _eusart->EUSART_TxDefaultInterruptHandler;
-            EUSART_TX_InterruptEnable();
+            /* TXIF is set while TXREG is empty, the interrupt is enabled only when bytes are queued */
+            EUSART_TX_InterruptDisable();
+            eusart_tx_tail = eusart_tx_head;
+            eusart_tx_streaming = ZERO_INIT;
+            eusart_tx_buffered = 1;
             /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
             INTERRUPT_PriorityLevelsEnable();
@@ -241,11 +900,16 @@ static void EUSART_ASYNC_TX_Init(const usart_t *_eusart)
             INTERRUPT_GlobalInterruptEnable();
             INTERRUPT_PeripheralInterruptEnable();
 #endif
+#else
+            PIE1bits.TXIE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
 #endif
         }
         else if(EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE == _eusart->usart_tx_cfg.usart_tx_interrupt_enable)
         {
             PIE1bits.TXIE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE;
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            eusart_tx_buffered = ZERO_INIT;
+#endif
         }
         else{ /* Nothing */}
 
@@ -279,6 +943,8 @@ static void EUSART_ASYNC_RX_Init(const usart_t *_eusart)
             PIE1bits.RCIE = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
             /* Interrupt Configurations */ 
 #if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            eusart_rx_tail = eusart_rx_head;
+            eusart_rx_buffered = 1;
             EUSART_RX_InterruptEnable();
             /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
@@ -305,6 +971,9 @@ static void EUSART_ASYNC_RX_Init(const usart_t *_eusart)
         else if(EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE == _eusart->usart_rx_cfg.usart_rx_interrupt_enable)
         {
             PIE1bits.RCIE = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE;
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            eusart_rx_buffered = ZERO_INIT;
+#endif
         }
         else{ /* Nothing */}
 
@@ -318,6 +987,23 @@ static void EUSART_ASYNC_RX_Init(const usart_t *_eusart)
             RCSTAbits.RX9 = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE;
         }
         else{ /* Nothing */}
+
+        /* EUSART Address Detect Configuration, the address matching runs in EUSART_RX_ISR() */
+        RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        eusart_rx_address_detect = ZERO_INIT;
+        eusart_rx_selected = ZERO_INIT;
+        if((EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE == _eusart->usart_rx_cfg.usart_rx_address_detect) &&
+           (eusart_rx_buffered))
+        {
+            /* Not selected until our address arrives, only the address bytes interrupt */
+            eusart_rx_node_address = _eusart->usart_rx_cfg.usart_rx_node_address;
+            eusart_rx_address_detect = 1;
+            RCSTAbits.RX9 = EUSART_ASYNCHRONOUS_9Bit_RX_ENABLE;
+            RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+        }
+        else { /* Nothing */}
+#endif
     }
     else { /* Nothing */}
 }
@@ -325,10 +1011,36 @@ static void EUSART_ASYNC_RX_Init(const usart_t *_eusart)
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 void EUSART_TX_ISR(void)
 {
-    EUSART_TX_InterruptDisable();
-    if(EUSART_TxInterruptHandler)
+    /* Refill TXREG while it is empty, the index update covers the TXIF latency after the write */
+    while((1 == PIR1bits.TXIF) && ((eusart_tx_tail != eusart_tx_head) || (eusart_tx_streaming)))
+    {
+        if(eusart_tx_tail != eusart_tx_head)
+        {
+            TXSTAbits.TX9D = (uint8)((eusart_tx_ninth_bits[eusart_tx_tail >> 3] >> (eusart_tx_tail & 7U)) & 1U);
+            TXREG = eusart_tx_buffer[eusart_tx_tail];
+            eusart_tx_tail = (uint8)((eusart_tx_tail + 1U) & (EUSART_TX_BUFFER_SIZE - 1U));
+        }
+        else
+        {
+            /* Streamed data after the buffered bytes, read in place (table reads from program memory) */
+            TXSTAbits.TX9D = 0;
+            TXREG = *eusart_tx_stream_data;
+            eusart_tx_stream_data++;
+            eusart_tx_stream_remaining--;
+            EUSART_TX_Stream_Next();
+            eusart_tx_streaming = (uint8)(ZERO_INIT != eusart_tx_stream_remaining);
+        }
+    }
+    
+    if((eusart_tx_tail == eusart_tx_head) && (ZERO_INIT == eusart_tx_streaming))
     {
-        EUSART_TxInterruptHandler();
+        /* Buffer drained, no more interrupts until the next write */
+        EUSART_TX_InterruptDisable();
+        if(EUSART_TxInterruptHandler)
+        {
+            EUSART_TxInterruptHandler();
+        }
+        else { /* Nothing */}
     }
     else { /* Nothing */}
 }
@@ -337,20 +1049,392 @@ void EUSART_TX_ISR(void)
 #if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 void EUSART_RX_ISR(void)
 {
-    if(EUSART_RxInterruptHandler)
+    uint8 l_data = ZERO_INIT;
+    uint8 l_framing_error = ZERO_INIT;
+    uint8 l_ninth_bit = ZERO_INIT;
+    uint8 l_next_head = ZERO_INIT;
+    uint8 l_received = ZERO_INIT;
+    uint8 l_sync_done = ZERO_INIT;
+    
+    /* The sync byte and the scan probes are consumed here, once locked the FIFO drains below */
+    EUSART_AutoBaud_Step();
+    
+    /* Drain the 2-byte receive FIFO, FERR and RX9D belong to the byte on top so they are read before RCREG */
+    while(1 == PIR1bits.RCIF)
     {
-        EUSART_RxInterruptHandler();
+        l_framing_error = (uint8)RCSTAbits.FERR;
+        l_ninth_bit = (uint8)RCSTAbits.RX9D;
+        l_data = RCREG;
+        if(EUSART_FRAMING_ERROR_DETECTED == l_framing_error)
+        {
+            eusart_rx_framing_errors++;
+            if(EUSART_FramingErrorHandler)
+            {
+                EUSART_FramingErrorHandler();
+            }
+            else { /* Nothing */}
+        }
+        else if((eusart_rx_address_detect) && (l_ninth_bit))
+        {
+            /* Address byte : stay selected for our address or the broadcast, otherwise back to ADDEN */
+            eusart_rx_selected = (uint8)((eusart_rx_node_address == l_data) ||
+                                         (EUSART_MULTIDROP_BROADCAST_ADDRESS == l_data));
+            eusart_rx_selected_address = l_data;
+            RCSTAbits.ADDEN = (uint8)(!eusart_rx_selected);
+        }
+        else if((eusart_rx_address_detect) && (ZERO_INIT == eusart_rx_selected))
+        {
+            /* Data byte already in the FIFO when ADDEN was set, not for us */
+        }
+        else
+        {
+            l_next_head = (uint8)((eusart_rx_head + 1U) & (EUSART_RX_BUFFER_SIZE - 1U));
+            if(l_next_head != eusart_rx_tail)
+            {
+                eusart_rx_buffer[eusart_rx_head] = l_data;
+                eusart_rx_head = l_next_head;
+                l_received = 1;
+            }
+            else
+            {
+                eusart_rx_buffer_overflows++;
+            }
+        }
+        
+        if(ZERO_INIT != eusart_sync_rx_remaining)
+        {
+            eusart_sync_rx_remaining--;
+            l_sync_done = (uint8)(ZERO_INIT == eusart_sync_rx_remaining);
+        }
+        else { /* Nothing */}
+    }
+    
+    /* The receiver stops on an overrun, restart it once the FIFO is empty */
+    if(EUSART_OVERRUN_ERROR_DETECTED == RCSTAbits.OERR)
+    {
+        eusart_rx_overrun_errors++;
+        if((eusart_sync_enabled) && ((eusart_sync_master) || (ZERO_INIT == eusart_sync_rx_remaining)))
+        {
+            /* Clearing CREN clears OERR, setting it again would start a continuous reception */
+            RCSTAbits.CREN = 0;
+        }
+        else
+        {
+            EUSART_ASYNC_RX_Restart();
+        }
+        if(EUSART_OverrunErrorHandler)
+        {
+            EUSART_OverrunErrorHandler();
+        }
+        else { /* Nothing */}
     }
     else { /* Nothing */}
-    if(EUSART_FramingErrorHandler)
+    
+    if(1 == l_sync_done)
+    {
+        /* Read complete, a slave stops receiving so the bus can turn around */
+        RCSTAbits.CREN = 0;
+        if(EUSART_SyncRxDoneHandler)
+        {
+            EUSART_SyncRxDoneHandler();
+        }
+        else { /* Nothing */}
+    }
+    else if(eusart_sync_master)
     {
-        EUSART_FramingErrorHandler();
+        /* SREN is cleared by hardware after each byte of a master read */
+        EUSART_SYNC_Receive_Next();
     }
     else { /* Nothing */}
-    if(EUSART_OverrunErrorHandler)
+    
+    if((1 == l_received) && EUSART_RxInterruptHandler)
     {
-        EUSART_OverrunErrorHandler();
+        EUSART_RxInterruptHandler();
     }
     else { /* Nothing */}
 }
-#endif
\ No newline at end of file
+#endif
+
+static uint16 EUSART_TX_Free_Space(void)
+{
+    uint16 l_free = ZERO_INIT;
+    
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(eusart_tx_streaming)
+    {
+        /* The writes wait for the streamed data, the bytes stay in order */
+        l_free = ZERO_INIT;
+    }
+    else if(eusart_tx_buffered)
+    {
+        l_free = (uint16)((EUSART_TX_BUFFER_SIZE - 1U) -
+                 ((uint8)(eusart_tx_head - eusart_tx_tail) & (EUSART_TX_BUFFER_SIZE - 1U)));
+    }
+    else
+    {
+        l_free = (uint16)TXSTAbits.TRMT;
+    }
+#else
+    l_free = (uint16)TXSTAbits.TRMT;
+#endif
+    return l_free;
+}
+
+/**
+ * @brief Queues one byte with its 9th bit, or writes it to TXREG without the transmit buffer.
+ */
+static Std_ReturnType EUSART_TX_Write(uint8 _data, uint8 _ninth_bit)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(eusart_tx_buffered)
+    {
+        if(ZERO_INIT != EUSART_TX_Free_Space())
+        {
+            eusart_tx_buffer[eusart_tx_head] = _data;
+            if(_ninth_bit)
+            {
+                eusart_tx_ninth_bits[eusart_tx_head >> 3] |= (uint8)(1U << (eusart_tx_head & 7U));
+            }
+            else
+            {
+                eusart_tx_ninth_bits[eusart_tx_head >> 3] &= (uint8)~(1U << (eusart_tx_head & 7U));
+            }
+            eusart_tx_head = (uint8)((eusart_tx_head + 1U) & (EUSART_TX_BUFFER_SIZE - 1U));
+            /* TXIF is set while TXREG is empty, the ISR starts (or keeps) draining the buffer */
+            EUSART_TX_InterruptEnable();
+            ret = E_OK;
+        }
+        else { /* Nothing */ }
+    }
+    else if(1 == TXSTAbits.TRMT)
+    {
+        EUSART_TX_InterruptEnable();
+        TXSTAbits.TX9D = _ninth_bit;
+        TXREG = _data;
+        ret = E_OK;
+    }
+    else { /* Nothing */ }
+#else
+    if(1 == TXSTAbits.TRMT)
+    {
+        TXSTAbits.TX9D = _ninth_bit;
+        TXREG = _data;
+        ret = E_OK;
+    }
+    else { /* Nothing */ }
+#endif
+    return ret;
+}
+
+static void EUSART_Module_DeInit(void)
+{
+    RCSTAbits.SPEN = EUSART_MODULE_DISABLE; /* Disable EUSART Module */
+    
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    EUSART_TX_InterruptDisable();
+    eusart_tx_buffered = ZERO_INIT;
+    eusart_tx_tail = eusart_tx_head;
+    eusart_tx_streaming = ZERO_INIT;
+#endif
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    EUSART_RX_InterruptDisable();
+    eusart_rx_buffered = ZERO_INIT;
+    eusart_rx_tail = eusart_rx_head;
+    BAUDCONbits.ABDEN = 0;
+    eusart_autobaud_status = EUSART_AUTOBAUD_IDLE;
+    RCSTAbits.ADDEN = 0;
+    eusart_rx_address_detect = ZERO_INIT;
+    eusart_rx_selected = ZERO_INIT;
+    RCSTAbits.SREN = 0;
+    eusart_sync_enabled = ZERO_INIT;
+    eusart_sync_master = ZERO_INIT;
+    eusart_sync_rx_remaining = ZERO_INIT;
+#endif
+}
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Hands a string or a segment list to EUSART_TX_ISR(), sent after the buffered bytes.
+ */
+static Std_ReturnType EUSART_TX_Stream_Start(const uint8 *_data, uint16 _length,
+                                             const usart_tx_segment_t *_segments, uint8 _count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((ZERO_INIT == eusart_tx_buffered) || (eusart_tx_streaming))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* The 16-bit count and the pointers must be complete before the ISR sees them */
+        EUSART_TX_InterruptDisable();
+        eusart_tx_stream_data = _data;
+        eusart_tx_stream_remaining = _length;
+        eusart_tx_stream_segments = _segments;
+        eusart_tx_stream_count = _count;
+        EUSART_TX_Stream_Next();
+        eusart_tx_streaming = (uint8)(ZERO_INIT != eusart_tx_stream_remaining);
+        if((eusart_tx_streaming) || (eusart_tx_tail != eusart_tx_head))
+        {
+            EUSART_TX_InterruptEnable();
+        }
+        else { /* Empty message, nothing to send */ }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Moves to the next non-empty segment once the current one is sent.
+ */
+static void EUSART_TX_Stream_Next(void)
+{
+    while((ZERO_INIT == eusart_tx_stream_remaining) && (ZERO_INIT != eusart_tx_stream_count))
+    {
+        eusart_tx_stream_data = eusart_tx_stream_segments->data;
+        eusart_tx_stream_remaining = (NULL == eusart_tx_stream_data) ? 0U : eusart_tx_stream_segments->length;
+        eusart_tx_stream_segments++;
+        eusart_tx_stream_count--;
+    }
+}
+#endif
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+static void EUSART_AutoBaud_Step(void)
+{
+    uint8 l_data = ZERO_INIT;
+    uint8 l_framing_error = ZERO_INIT;
+    uint16 l_brg = ZERO_INIT;
+    uint32 l_measured = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_snapped = ZERO_INIT;
+    
+    while((1 == PIR1bits.RCIF) &&
+          ((EUSART_AUTOBAUD_MEASURING == eusart_autobaud_status) || (EUSART_AUTOBAUD_SCANNING == eusart_autobaud_status)))
+    {
+        if(EUSART_AUTOBAUD_MEASURING == eusart_autobaud_status)
+        {
+            /* ABDEN cleared by hardware, SPBRGH:SPBRG counted 8 bit times of the 0x55 sync byte */
+            l_brg = (uint16)(((uint16)SPBRGH << 8) | SPBRG);
+            l_data = RCREG; /* Meaningless, only clears RCIF */
+            if((1 == BAUDCONbits.ABDOVF) || (ZERO_INIT == l_brg))
+            {
+                /* Too slow for the 16-bit counter (or noise), try the standard rates one by one */
+                BAUDCONbits.ABDOVF = 0;
+                BAUDCONbits.ABDEN = 0;
+                eusart_autobaud_scan_index = ZERO_INIT;
+                EUSART_AutoBaud_Next_Rate();
+            }
+            else
+            {
+                /* BRG16 = BRGH = 1 : the count is Fosc / (4 * baud), that is BRG + 1 */
+                l_measured = _XTAL_FREQ / (4UL * (uint32)l_brg);
+                l_snapped = ZERO_INIT;
+                l_index = ZERO_INIT;
+                while((ZERO_INIT == l_snapped) &&
+                      (l_index < (sizeof(eusart_standard_baudrates) / sizeof(eusart_standard_baudrates[0]))))
+                {
+                    /* Lock on the standard rate if the measure is close, the solver gives the exact BRG */
+                    if((labs((sint32)l_measured - (sint32)eusart_standard_baudrates[l_index]) <=
+                        (sint32)((eusart_standard_baudrates[l_index] / 1000UL) * (EUSART_AUTOBAUD_SNAP_PPM / 1000UL))) &&
+                       (E_OK == EUSART_Baud_Rate_Calculation(eusart_standard_baudrates[l_index], BAUDRATE_ASYN_AUTO)))
+                    {
+                        l_snapped = 1;
+                    }
+                    else { /* Nothing */ }
+                    l_index++;
+                }
+                if(ZERO_INIT == l_snapped)
+                {
+                    /* Non standard rate, keep the measured divider */
+                    SPBRG = (uint8)(l_brg - 1U);
+                    SPBRGH = (uint8)((uint16)(l_brg - 1U) >> 8);
+                    eusart_achieved_baudrate = l_measured;
+                    eusart_baudrate_error_ppm = ZERO_INIT;
+                }
+                else { /* Nothing */ }
+                eusart_autobaud_status = EUSART_AUTOBAUD_LOCKED;
+            }
+        }
+        else
+        {
+            /* Scanning : the host keeps sending the sync byte, the first clean one locks the rate */
+            l_framing_error = (uint8)RCSTAbits.FERR;
+            l_data = RCREG;
+            if((EUSART_FRAMING_ERROR_CLEARED == l_framing_error) && (EUSART_AUTOBAUD_SYNC_BYTE == l_data))
+            {
+                eusart_autobaud_status = EUSART_AUTOBAUD_LOCKED;
+            }
+            else
+            {
+                EUSART_AutoBaud_Next_Rate();
+            }
+        }
+    }
+}
+
+static void EUSART_AutoBaud_Measure(void)
+{
+    /* Highest counter resolution, the measurement starts on the next start bit */
+    TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
+    TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
+    BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+    BAUDCONbits.ABDOVF = 0;
+    BAUDCONbits.ABDEN = 1;
+    eusart_autobaud_status = EUSART_AUTOBAUD_MEASURING;
+}
+
+static void EUSART_AutoBaud_Next_Rate(void)
+{
+    uint8 l_programmed = ZERO_INIT;
+    
+    /* Skip the rates the oscillator can't reach within EUSART_BAUDRATE_MAX_ERROR_PPM */
+    while((ZERO_INIT == l_programmed) &&
+          (eusart_autobaud_scan_index < (sizeof(eusart_standard_baudrates) / sizeof(eusart_standard_baudrates[0]))))
+    {
+        if(E_OK == EUSART_Baud_Rate_Calculation(eusart_standard_baudrates[eusart_autobaud_scan_index], BAUDRATE_ASYN_AUTO))
+        {
+            l_programmed = 1;
+        }
+        else { /* Nothing */ }
+        eusart_autobaud_scan_index++;
+    }
+    
+    if(1 == l_programmed)
+    {
+        eusart_autobaud_status = EUSART_AUTOBAUD_SCANNING;
+    }
+    else
+    {
+        /* Whole table tried, measure again */
+        eusart_autobaud_scan_index = ZERO_INIT;
+        EUSART_AutoBaud_Measure();
+    }
+}
+
+/**
+ * @brief Clocks the next byte of a master read in (SREN), only when the receive buffer has room for it.
+ */
+static void EUSART_SYNC_Receive_Next(void)
+{
+    uint8 l_used = (uint8)((uint8)(eusart_rx_head - eusart_rx_tail) & (EUSART_RX_BUFFER_SIZE - 1U));
+    
+    /* A byte still in RCREG is counted in the remaining bytes and needs a slot too */
+    if((eusart_sync_master) && (ZERO_INIT == RCSTAbits.SREN) &&
+       (eusart_sync_rx_remaining > (uint16)PIR1bits.RCIF) &&
+       (((uint16)l_used + (uint16)PIR1bits.RCIF) < (EUSART_RX_BUFFER_SIZE - 1U)))
+    {
+        RCSTAbits.SREN = 1;
+    }
+    else { /* Nothing */ }
+}
+
+static uint16 EUSART_SYNC_Remaining(void)
+{
+    return MCAL_Read_Shared_U16(&eusart_sync_rx_remaining);
+}
+#endif
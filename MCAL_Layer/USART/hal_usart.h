@@ -51,15 +51,44 @@
 /* EUSART 9-Bit Receiver Enable */
 #define EUSART_ASYNCHRONOUS_9Bit_RX_ENABLE   1
 #define EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE  0
+/* EUSART Address Detect (multi-drop), 9-bit reception with the 9th bit marking the address bytes */
+#define EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE   1
+#define EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE  0
 /* EUSART Framing Error */
 #define EUSART_FRAMING_ERROR_DETECTED 1
 #define EUSART_FRAMING_ERROR_CLEARED  0
 /* EUSART Overrun Error */
 #define EUSART_OVERRUN_ERROR_DETECTED 1
 #define EUSART_OVERRUN_ERROR_CLEARED  0
+/* EUSART Synchronous Clock Source (CSRC), the master drives CK from the baud rate generator */
+#define EUSART_SYNCHRONOUS_MASTER            1
+#define EUSART_SYNCHRONOUS_SLAVE             0
+/* EUSART Synchronous Clock Polarity (SCKP), data changes on the edge leaving the idle level */
+#define EUSART_SYNCHRONOUS_CLOCK_IDLE_HIGH   1
+#define EUSART_SYNCHRONOUS_CLOCK_IDLE_LOW    0
+/* Byte sent by the host for the auto-baud acquisition, 4 rising edges over 8 bit times */
+#define EUSART_AUTOBAUD_SYNC_BYTE     0x55U
+
+#if ((EUSART_TX_BUFFER_SIZE & (EUSART_TX_BUFFER_SIZE - 1U)) != 0U) || (EUSART_TX_BUFFER_SIZE > 256U)
+#error "EUSART : EUSART_TX_BUFFER_SIZE must be a power of 2 up to 256"
+#endif
+
+#if ((EUSART_RX_BUFFER_SIZE & (EUSART_RX_BUFFER_SIZE - 1U)) != 0U) || (EUSART_RX_BUFFER_SIZE > 256U)
+#error "EUSART : EUSART_RX_BUFFER_SIZE must be a power of 2 up to 256"
+#endif
 
 /* ----------------- Macro Functions Declarations -----------------*/
 
+/**
+ * Rounded BRG value and reached baud rate for a clock divider (64, 16 or 4),
+ * constant expressions that can check a rate at compile time :
+ * #if EUSART_BRG_BAUDRATE(115200UL, 4UL) > 117000UL
+ */
+#define EUSART_BRG_VALUE(_BAUD_, _DIV_) \
+            (((_XTAL_FREQ + (((_DIV_) * (_BAUD_)) / 2UL)) / ((_DIV_) * (_BAUD_))) - 1UL)
+#define EUSART_BRG_BAUDRATE(_BAUD_, _DIV_) \
+            (_XTAL_FREQ / ((_DIV_) * (EUSART_BRG_VALUE(_BAUD_, _DIV_) + 1UL)))
+
 /* ----------------- Data Type Declarations -----------------*/
 typedef enum{
     BAUDRATE_ASYN_8BIT_lOW_SPEED,
@@ -67,7 +96,8 @@ typedef enum{
     BAUDRATE_ASYN_16BIT_lOW_SPEED,   
     BAUDRATE_ASYN_16BIT_HIGH_SPEED,
     BAUDRATE_SYN_8BIT,
-    BAUDRATE_SYN_16BIT
+    BAUDRATE_SYN_16BIT,
+    BAUDRATE_ASYN_AUTO          /* BRGH/BRG16 combination with the smallest error */
 }baudrate_gen_t;
 
 typedef struct{
@@ -87,7 +117,9 @@ typedef struct{
 	uint8 usart_rx_enable : 1;
 	uint8 usart_rx_interrupt_enable : 1;
 	uint8 usart_rx_9bit_enable : 1;
-    uint8 usart_rx_reserved : 5;
+	uint8 usart_rx_address_detect : 1;
+    uint8 usart_rx_reserved : 4;
+    uint8 usart_rx_node_address;    /* Address answered with usart_rx_address_detect */
 }usart_rx_cfg_t;
 
 typedef union{
@@ -111,6 +143,47 @@ typedef struct{
     void (*EUSART_OverrunErrorHandler)(void);
 }usart_t;
 
+/* One part of a message sent by EUSART_ASYNC_StreamSegmentsNonBlocking(), in RAM or program memory */
+typedef struct{
+    const uint8 *data;
+    uint16 length;
+}usart_tx_segment_t;
+
+typedef struct{
+    uint16 framing_errors;      /* Bytes received with a framing error, discarded */
+    uint16 overrun_errors;      /* Receive FIFO overruns, the receiver was restarted */
+    uint16 buffer_overflows;    /* Bytes dropped because the ring buffer was full */
+}usart_rx_statistics_t;
+
+typedef struct{
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
+    interrupt_priority_cfg usart_tx_int_priority;
+    interrupt_priority_cfg usart_rx_int_priority;
+#endif
+    uint8 usart_sync_master : 1;            /* EUSART_SYNCHRONOUS_MASTER / EUSART_SYNCHRONOUS_SLAVE */
+    uint8 usart_sync_clock_polarity : 1;    /* EUSART_SYNCHRONOUS_CLOCK_IDLE_HIGH / LOW */
+    uint8 usart_sync_reserved : 6;
+}usart_sync_cfg_t;
+
+/*
+ * clock_rate          : CK frequency in Hz, master only
+ * baudrate_gen_gonfig : BAUDRATE_SYN_8BIT or BAUDRATE_SYN_16BIT, master only
+ */
+typedef struct{
+    uint32 clock_rate;
+    baudrate_gen_t baudrate_gen_gonfig;
+    usart_sync_cfg_t usart_sync_cfg;
+    void (*EUSART_SyncTxDoneHandler)(void);     /* Transmit buffer drained, the last byte is still shifting */
+    void (*EUSART_SyncRxDoneHandler)(void);     /* Last byte of EUSART_SYNC_Read_Start() received */
+}usart_sync_t;
+
+typedef enum{
+    EUSART_AUTOBAUD_IDLE,       /* Baud rate from EUSART_ASYNC_Init() */
+    EUSART_AUTOBAUD_MEASURING,  /* ABDEN set, waiting for the sync byte */
+    EUSART_AUTOBAUD_SCANNING,   /* Measure overflowed, trying the standard rates */
+    EUSART_AUTOBAUD_LOCKED      /* Rate acquired, the next frames are received normally */
+}usart_autobaud_status_t;
+
 /* ----------------- Software Interfaces Declarations -----------------*/
 /**
  * @Summary Initializes the EUSART asynchronous mode.
@@ -119,10 +192,25 @@ typedef struct{
  * @param _eusart Pointer to the EUSART configurations
  * @return Status of the function
  *          (E_OK) : The function executed successfully
- *          (E_NOT_OK) : The function encountered an issue during execution
+ *          (E_NOT_OK) : The function encountered an issue during execution, or the baud rate
+ *                       can't be reached within EUSART_BAUDRATE_MAX_ERROR_PPM
  */
 Std_ReturnType EUSART_ASYNC_Init(const usart_t *_eusart);
 
+/**
+ * @Summary Gets the baud rate reached by the baud rate generator.
+ * @Description EUSART_ASYNC_Init() computes SPBRGH:SPBRG with rounded integer arithmetic,
+ *              the selected (or with BAUDRATE_ASYN_AUTO the best) mode is kept only if the
+ *              error is within EUSART_BAUDRATE_MAX_ERROR_PPM, otherwise the initialization fails.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
+ * @param _baudrate Pointer to the reached baud rate
+ * @param _error_ppm Pointer to the error in ppm of the requested rate, positive when faster
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_Get_Baud_Rate(uint32 *_baudrate, sint32 *_error_ppm);
+
 /**
  * @Summary Deinitializes the EUSART asynchronous mode.
  * @Description This function deinitializes the EUSART module previously initialized for asynchronous communication.
@@ -138,7 +226,8 @@ Std_ReturnType EUSART_ASYNC_DeInit(const usart_t *_eusart);
 
 /**
  * @Summary Reads a byte from the EUSART asynchronously in a blocking manner.
- * @Description This function reads a byte from the EUSART buffer in a blocking mode.
+ * @Description This function waits until a byte is received, with the receive interrupt enabled
+ *              the byte is taken from the receive ring buffer.
  * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
  * @param _data Pointer to store the received byte
  * @return Status of the function
@@ -149,7 +238,9 @@ Std_ReturnType EUSART_ASYNC_ReadByteBlocking(uint8 *_data);
 
 /**
  * @Summary Reads a byte from the EUSART asynchronously in a non-blocking manner.
- * @Description This function attempts to read a byte from the EUSART buffer in a non-blocking mode.
+ * @Description With the receive interrupt enabled, EUSART_RX_ISR() drains RCREG into the receive
+ *              ring buffer and this function takes the oldest byte from it.
+ *              Without the interrupt, the byte is read from RCREG if one is pending.
  * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
  * @param _data Pointer to store the received byte
  * @return Status of the function
@@ -158,6 +249,93 @@ Std_ReturnType EUSART_ASYNC_ReadByteBlocking(uint8 *_data);
  */
 Std_ReturnType EUSART_ASYNC_ReadByteNonBlocking(uint8 *_data);
 
+/**
+ * @Summary Gets the number of received bytes waiting to be read.
+ * @Description The bytes in the receive ring buffer, or 1 when RCREG holds a byte without the interrupt.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
+ * @param _count Pointer to the number of available bytes
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_RX_Available(uint16 *_count);
+
+/**
+ * @Summary Reads the received bytes without waiting.
+ * @Description Copies up to _length bytes, stops early when no more bytes are available.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
+ * @param _data Pointer to the destination buffer
+ * @param _length Size of the destination buffer
+ * @param _read_count Pointer to the number of bytes copied
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully, _read_count may be 0
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_Read(uint8 *_data, uint16 _length, uint16 *_read_count);
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @Summary Gets the receive error counters.
+ * @Description EUSART_RX_ISR() checks FERR per byte and OERR per interrupt, a byte with a framing
+ *              error is discarded and an overrun restarts the receiver (CREN cleared and set).
+ * @Preconditions None
+ * @param _statistics Pointer to the error counters
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_RX_Get_Statistics(usart_rx_statistics_t *_statistics);
+
+/**
+ * @Summary Clears the receive error counters.
+ * @Preconditions None
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ */
+Std_ReturnType EUSART_ASYNC_RX_Clear_Statistics(void);
+
+/**
+ * @Summary Starts the auto-baud acquisition.
+ * @Description The hardware auto-baud detect (ABDEN) measures the next 0x55 sync byte with the
+ *              16-bit high speed generator. A measure close to a standard rate is locked on it,
+ *              other rates keep the measured divider. On a counter rollover (ABDOVF) the standard
+ *              rates are tried in turn until a sync byte is received without framing error, then
+ *              the measurement starts again. Everything runs in EUSART_RX_ISR(), the sync bytes
+ *              never reach the receive buffer and the first frame after the lock parses normally.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with the receive interrupt enabled.
+ * @return Status of the function
+ *          (E_OK) : The acquisition started
+ *          (E_NOT_OK) : The receive interrupt is not enabled
+ */
+Std_ReturnType EUSART_ASYNC_AutoBaud_Start(void);
+
+/**
+ * @Summary Gets the auto-baud acquisition status.
+ * @Description Once EUSART_AUTOBAUD_LOCKED, EUSART_Get_Baud_Rate() gives the acquired rate.
+ * @Preconditions None
+ * @param _status Pointer to the acquisition status
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_AutoBaud_Status(usart_autobaud_status_t *_status);
+
+/**
+ * @Summary Gets the multi-drop selection.
+ * @Description With usart_rx_address_detect, the receiver runs with ADDEN set and only address bytes
+ *              (9th bit set) interrupt. An address byte equal to usart_rx_node_address or to
+ *              EUSART_MULTIDROP_BROADCAST_ADDRESS selects the node : ADDEN is cleared and the data
+ *              bytes after it go to the receive buffer, until an address byte for another node sets
+ *              ADDEN again. The address bytes themselves are not buffered.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with the receive interrupt enabled.
+ * @param _address Pointer to the address that selected the node
+ * @return Status of the function
+ *          (E_OK) : The node is selected, the data bytes are received
+ *          (E_NOT_OK) : The node is not selected, or address detect is not enabled
+ */
+Std_ReturnType EUSART_ASYNC_MultiDrop_Selected(uint8 *_address);
+#endif
+
 /**
  * @Summary Restarts the RX operation of the EUSART asynchronously.
  * @Description This function restarts the RX operation of the EUSART module.
@@ -184,37 +362,212 @@ Std_ReturnType EUSART_ASYNC_WriteByteBlocking(uint8 _data);
 /**
  * @Summary Writes a string to the EUSART asynchronously in a blocking manner.
  * @Description This function writes a string to the EUSART buffer in a blocking mode.
+ *              The string can be a constant in program memory, it is read in place.
  * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
  * @param _data Pointer to the string to be transmitted
  * @return Status of the function
  *          (E_OK) : The function executed successfully
  *          (E_NOT_OK) : The function encountered an issue during execution
  */
-Std_ReturnType EUSART_ASYNC_WriteStringBlocking(uint8 *_data);
+Std_ReturnType EUSART_ASYNC_WriteStringBlocking(const uint8 *_data);
 
 /**
  * @Summary Writes a byte to the EUSART asynchronously in a non-blocking manner.
- * @Description This function attempts to write a byte to the EUSART buffer in a non-blocking mode.
+ * @Description With the transmit interrupt enabled, the byte is queued in the transmit ring buffer
+ *              and sent by EUSART_TX_ISR(), the function never waits on the transmitter.
+ *              Without the interrupt, the byte is written to TXREG only if it is empty.
  * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
  * @param _data The byte to be transmitted
  * @return Status of the function
  *          (E_OK) : The byte was successfully queued for transmission
- *          (E_NOT_OK) : The byte could not be queued for transmission
+ *          (E_NOT_OK) : The buffer is full (or TXREG busy), the byte was not queued
  */
 Std_ReturnType EUSART_ASYNC_WriteByteNonBlocking(uint8 _data);
 
 /**
  * @Summary Writes a string to the EUSART asynchronously in a non-blocking manner.
- * @Description This function attempts to write a string to the EUSART buffer in a non-blocking mode.
- * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
+ * @Description The whole string is queued in the transmit ring buffer or nothing is queued,
+ *              a message is never cut in the middle.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function
+ *                with the transmit interrupt enabled.
  * @param _data Pointer to the string to be transmitted
- * @param str_len Length of the string to be transmitted
  * @return Status of the function
  *          (E_OK) : The string was successfully queued for transmission
- *          (E_NOT_OK) : The string could not be queued for transmission
+ *          (E_NOT_OK) : Not enough free space in the buffer, nothing was queued
+ */
+Std_ReturnType EUSART_ASYNC_WriteStringNonBlocking(const uint8 *_data);
+
+/**
+ * @Summary Writes a block of bytes to the EUSART asynchronously in a non-blocking manner.
+ * @Description All the bytes are queued in the transmit ring buffer or none of them.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function
+ *                with the transmit interrupt enabled.
+ * @param _data Pointer to the bytes to be transmitted
+ * @param _length Number of bytes
+ * @return Status of the function
+ *          (E_OK) : The bytes were successfully queued for transmission
+ *          (E_NOT_OK) : Not enough free space in the buffer, nothing was queued
+ */
+Std_ReturnType EUSART_ASYNC_WriteNonBlocking(const uint8 *_data, uint16 _length);
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/**
+ * @Summary Sends a string in place, without copying it to the transmit buffer.
+ * @Description EUSART_TX_ISR() reads the string byte by byte straight from where it is, a constant
+ *              in program memory is read with table reads. The string can be longer than the buffer,
+ *              it must stay unchanged until EUSART_ASYNC_TX_Idle() reports the end. The bytes written
+ *              before go out first, the writes after it wait (or fail) until the string is sent.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with the transmit interrupt enabled.
+ * @param _data Pointer to the string to be transmitted
+ * @return Status of the function
+ *          (E_OK) : The string is being sent
+ *          (E_NOT_OK) : Another string or segment list is still being sent
+ */
+Std_ReturnType EUSART_ASYNC_StreamStringNonBlocking(const uint8 *_data);
+
+/**
+ * @Summary Sends a message made of several segments, without copying them (scatter-gather).
+ * @Description The segments are sent in order as one message, each read in place by EUSART_TX_ISR()
+ *              like EUSART_ASYNC_StreamStringNonBlocking(). Empty segments are skipped. The segment
+ *              array and the data must stay unchanged until EUSART_ASYNC_TX_Idle() reports the end.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with the transmit interrupt enabled.
+ * @param _segments Pointer to the segment array
+ * @param _count Number of segments
+ * @return Status of the function
+ *          (E_OK) : The message is being sent
+ *          (E_NOT_OK) : Another string or segment list is still being sent, or invalid parameters
+ */
+Std_ReturnType EUSART_ASYNC_StreamSegmentsNonBlocking(const usart_tx_segment_t *_segments, uint8 _count);
+#endif
+
+/**
+ * @Summary Writes an address byte to the EUSART in a non-blocking manner.
+ * @Description The byte is sent with the 9th bit set, it selects the multi-drop node with this address.
+ *              The 9th bit of each byte is queued with it, the bytes written before go out first.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with usart_tx_9bit_enable.
+ * @param _address Address of the node
+ * @return Status of the function
+ *          (E_OK) : The address was successfully queued for transmission
+ *          (E_NOT_OK) : The buffer is full (or TXREG busy), the address was not queued
+ */
+Std_ReturnType EUSART_ASYNC_WriteAddressNonBlocking(uint8 _address);
+
+/**
+ * @Summary Sends a multi-drop frame in a non-blocking manner.
+ * @Description The address byte (9th bit set) and the data bytes (9th bit clear) are all queued in the
+ *              transmit ring buffer or none of them.
+ * @Preconditions EUSART_ASYNC_Init() function should have been called with usart_tx_9bit_enable
+ *                and the transmit interrupt enabled.
+ * @param _address Address of the node
+ * @param _data Pointer to the data bytes
+ * @param _length Number of data bytes
+ * @return Status of the function
+ *          (E_OK) : The frame was successfully queued for transmission
+ *          (E_NOT_OK) : Not enough free space in the buffer, nothing was queued
+ */
+Std_ReturnType EUSART_ASYNC_MultiDrop_Write(uint8 _address, const uint8 *_data, uint16 _length);
+
+/**
+ * @Summary Sends a break character.
+ * @Description SENDB is set and a dummy byte written to TXREG, the EUSART sends a start bit, twelve
+ *              0 bits and a stop bit, then clears SENDB. The next bytes can be queued right away,
+ *              they follow the break (LIN header : break, sync 0x55, identifier).
+ * @Preconditions EUSART_ASYNC_Init() function should have been called before calling this function.
+ * @return Status of the function
+ *          (E_OK) : The break is being sent
+ *          (E_NOT_OK) : The transmitter is busy, the break must start from an idle line
  */
-Std_ReturnType EUSART_ASYNC_WriteStringNonBlocking(uint8 *_data);
+Std_ReturnType EUSART_ASYNC_Send_Break(void);
 
+/**
+ * @Summary Gets the free space in the transmit ring buffer.
+ * @Description Lets the application size its next write instead of polling for E_NOT_OK.
+ *              No space while a string or segment list is being streamed.
+ * @Preconditions None
+ * @param _free Pointer to the number of bytes that can still be queued
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_TX_Free(uint16 *_free);
+
+/**
+ * @Summary Checks if the transmission is complete.
+ * @Description The transmission is complete when the ring buffer is empty, no string or segment
+ *              list is being streamed and the last stop bit left the shift register (TRMT set).
+ * @Preconditions None
+ * @param _idle Pointer to the status, 1 when idle
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_ASYNC_TX_Idle(uint8 *_idle);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/**
+ * @Summary Initializes the EUSART synchronous mode.
+ * @Description Half-duplex clocked bus, CK on RC6 and DT on RC7, 8-bit transfers through the
+ *              transmit and receive ring buffers and both interrupts. The line starts idle, neither
+ *              sending nor receiving, the direction is picked by EUSART_SYNC_Write() or
+ *              EUSART_SYNC_Read_Start().
+ * @Preconditions None
+ * @param _eusart Pointer to the EUSART synchronous configurations
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution, or the master clock
+ *                       rate can't be reached within EUSART_BAUDRATE_MAX_ERROR_PPM
+ */
+Std_ReturnType EUSART_SYNC_Init(const usart_sync_t *_eusart);
+
+/**
+ * @Summary Deinitializes the EUSART synchronous mode.
+ * @Preconditions EUSART_SYNC_Init() function should have been called before calling this function.
+ * @param _eusart Pointer to the EUSART synchronous configurations
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_SYNC_DeInit(const usart_sync_t *_eusart);
+
+/**
+ * @Summary Sends a block of bytes on the synchronous bus.
+ * @Description The receiver is turned off and the bytes are queued in the transmit ring buffer, all
+ *              of them or none. A master clocks them out at once, a slave shifts them out on the
+ *              master clock. Bytes can be added while the previous ones are being sent.
+ * @Preconditions EUSART_SYNC_Init() function should have been called before calling this function.
+ * @param _data Pointer to the bytes to be transmitted
+ * @param _length Number of bytes
+ * @return Status of the function
+ *          (E_OK) : The bytes were successfully queued for transmission
+ *          (E_NOT_OK) : A read is in progress, or not enough free space in the buffer
+ */
+Std_ReturnType EUSART_SYNC_Write(const uint8 *_data, uint16 _length);
+
+/**
+ * @Summary Starts receiving a number of bytes on the synchronous bus.
+ * @Description The bytes go to the receive ring buffer, read with EUSART_ASYNC_Read(). A master
+ *              clocks them in one at a time (SREN) and only while the buffer has room, so a read
+ *              can be longer than the buffer. A slave receives continuously (CREN) on the master
+ *              clock and stops after the last byte, the buffer must be drained in time.
+ *              EUSART_SyncRxDoneHandler is called after the last byte.
+ * @Preconditions EUSART_SYNC_Init() function should have been called before calling this function.
+ * @param _length Number of bytes, 1 or more
+ * @return Status of the function
+ *          (E_OK) : The read started
+ *          (E_NOT_OK) : A transfer is in progress, the bus turns around only when idle
+ */
+Std_ReturnType EUSART_SYNC_Read_Start(uint16 _length);
+
+/**
+ * @Summary Checks if a synchronous transfer is in progress.
+ * @Preconditions None
+ * @param _busy Pointer to the status, 1 while bytes are being sent or a read is not complete
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType EUSART_SYNC_Busy(uint8 *_busy);
+#endif
 
 #endif	/* HAL_USART_H */
 
@@ -12,6 +12,21 @@
 
 /* ----------------- Macro Declarations -----------------*/
 
+/* Largest accepted baud rate error, EUSART_ASYNC_Init() fails above it (20000 ppm = 2 %) */
+#define EUSART_BAUDRATE_MAX_ERROR_PPM  20000UL
+
+/* Transmit ring buffer drained by EUSART_TX_ISR(), must be a power of 2 up to 256 */
+#define EUSART_TX_BUFFER_SIZE          32U
+
+/* Receive ring buffer filled by EUSART_RX_ISR(), must be a power of 2 up to 256 */
+#define EUSART_RX_BUFFER_SIZE          32U
+
+/* Multi-drop address selecting every node, on top of usart_rx_node_address */
+#define EUSART_MULTIDROP_BROADCAST_ADDRESS  0xFFU
+
+/* A measured rate this close to a standard rate (1200 .. 115200) is locked on the standard rate */
+#define EUSART_AUTOBAUD_SNAP_PPM       30000UL
+
 /* ----------------- Macro Functions Declarations -----------------*/
 
 /* ----------------- Data Type Declarations -----------------*/
@@ -0,0 +1,500 @@
+/*
+ * File:   hal_usart_lin.c
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 2:30 AM
+ */
+
+#include "hal_usart_lin.h"
+#include "../mcal_shared_read.h"
+
+/* Protocol states, from the break to the end of the response */
+#define LIN_STATE_IDLE                 0x00U
+#define LIN_STATE_SYNC                 0x01U   /* Break received, the sync byte comes next */
+#define LIN_STATE_IDENTIFIER           0x02U
+#define LIN_STATE_PUBLISH              0x03U   /* Reading back the response this node sends */
+#define LIN_STATE_SUBSCRIBE            0x04U   /* Collecting the response of another node */
+
+static lin_t *lin_active = NULL;
+static volatile uint8 lin_state = LIN_STATE_IDLE;
+static lin_frame_t *lin_current_frame = NULL;
+static uint8 lin_current_pid = ZERO_INIT;
+/* Response sent or received, checksum last */
+static uint8 lin_response[LIN_MAX_DATA_LENGTH + 1U];
+static uint8 lin_response_count = ZERO_INIT;
+/* Master schedule */
+static uint8 lin_schedule_index = ZERO_INIT;
+static uint8 lin_slot_timer = ZERO_INIT;
+
+static volatile lin_statistics_t lin_statistics;
+
+static uint8 lin_protected_id(uint8 _frame_id);
+static uint8 lin_checksum(const lin_frame_t *_frame, uint8 _pid, const uint8 *_data);
+static lin_frame_t *lin_find_frame(uint8 _frame_id);
+static void lin_identifier(uint8 _pid);
+static void lin_response_end(void);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+static void LIN_Rx_ISR(void);
+static void LIN_Break_ISR(void);
+
+Std_ReturnType LIN_Init(lin_t *_lin)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _lin)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _lin->lin_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+        _lin->lin_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+        _lin->lin_usart.usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_TX_DISABLE;
+        _lin->lin_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+        _lin->lin_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+        _lin->lin_usart.usart_rx_cfg.usart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE;
+        _lin->lin_usart.usart_rx_cfg.usart_rx_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+        _lin->lin_usart.EUSART_TxDefaultInterruptHandler = NULL;
+        _lin->lin_usart.EUSART_RxDefaultInterruptHandler = LIN_Rx_ISR;
+        /* The break is the only framing error expected on the bus */
+        _lin->lin_usart.EUSART_FramingErrorHandler = LIN_Break_ISR;
+        _lin->lin_usart.EUSART_OverrunErrorHandler = NULL;
+
+        ret = LIN_Select(_lin);
+        if(E_OK == ret)
+        {
+            ret = EUSART_ASYNC_Init(&(_lin->lin_usart));
+        }
+        else { /* Nothing */ }
+    }
+    return ret;
+}
+
+/**
+ * @brief EUSART receive handler, runs the protocol on the buffered bytes.
+ */
+static void LIN_Rx_ISR(void)
+{
+    uint8 l_data = ZERO_INIT;
+
+    while(E_OK == EUSART_ASYNC_ReadByteNonBlocking(&l_data))
+    {
+        (void)LIN_Rx_Byte(l_data);
+    }
+}
+
+/**
+ * @brief EUSART framing error handler, the break field of a header.
+ */
+static void LIN_Break_ISR(void)
+{
+    (void)LIN_Break_Event();
+}
+#endif
+
+Std_ReturnType LIN_Select(lin_t *_lin)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == _lin) || (NULL == _lin->frames) || (ZERO_INIT == _lin->frame_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((LIN_NODE_MASTER == _lin->node) && ((NULL == _lin->schedule) || (ZERO_INIT == _lin->schedule_count)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        for(l_index = 0; l_index < _lin->frame_count; l_index++)
+        {
+            if((LIN_MAX_FRAME_ID < _lin->frames[l_index].frame_id) || (ZERO_INIT == _lin->frames[l_index].length) ||
+               (LIN_MAX_DATA_LENGTH < _lin->frames[l_index].length))
+            {
+                ret = E_NOT_OK;
+            }
+            else { /* Nothing */ }
+            _lin->frames[l_index].updated = ZERO_INIT;
+        }
+        if(LIN_NODE_MASTER == _lin->node)
+        {
+            for(l_index = 0; l_index < _lin->schedule_count; l_index++)
+            {
+                if((LIN_MAX_FRAME_ID < _lin->schedule[l_index].frame_id) || (ZERO_INIT == _lin->schedule[l_index].slot_ticks))
+                {
+                    ret = E_NOT_OK;
+                }
+                else { /* Nothing */ }
+            }
+        }
+        else { /* Nothing */ }
+
+        if(E_OK == ret)
+        {
+            lin_state = LIN_STATE_IDLE;
+            lin_schedule_index = ZERO_INIT;
+            lin_slot_timer = ZERO_INIT;
+            lin_statistics.headers = ZERO_INIT;
+            lin_statistics.responses = ZERO_INIT;
+            lin_statistics.parity_errors = ZERO_INIT;
+            lin_statistics.checksum_errors = ZERO_INIT;
+            lin_statistics.bit_errors = ZERO_INIT;
+            lin_statistics.no_responses = ZERO_INIT;
+            lin_active = _lin;
+        }
+        else
+        {
+            lin_active = NULL;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Break_Event(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == lin_active)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(LIN_STATE_SUBSCRIBE == lin_state)
+        {
+            /* The next header came before the whole response */
+            lin_statistics.no_responses++;
+        }
+        else { /* Nothing */ }
+
+        /* A slave measures the sync field with the auto-baud detect, armed once the break byte
+           is received as the datasheet suggests, and the sync byte never reaches the buffer */
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        if((LIN_NODE_SLAVE == lin_active->node) && (E_OK == EUSART_ASYNC_AutoBaud_Start()))
+        {
+            lin_state = LIN_STATE_IDENTIFIER;
+        }
+        else
+        {
+            lin_state = LIN_STATE_SYNC;
+        }
+#else
+        lin_state = LIN_STATE_SYNC;
+#endif
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Rx_Byte(uint8 _data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == lin_active)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        switch(lin_state)
+        {
+            case LIN_STATE_SYNC :
+                lin_state = (LIN_SYNC_BYTE == _data) ? LIN_STATE_IDENTIFIER : LIN_STATE_IDLE;
+                break;
+
+            case LIN_STATE_IDENTIFIER :
+                lin_identifier(_data);
+                break;
+
+            case LIN_STATE_PUBLISH :
+                /* Single wire : every sent byte comes back, a difference is a collision */
+                if(_data != lin_response[lin_response_count])
+                {
+                    lin_statistics.bit_errors++;
+                    lin_state = LIN_STATE_IDLE;
+                }
+                else
+                {
+                    lin_response_count++;
+                    if(lin_response_count > lin_current_frame->length)
+                    {
+                        lin_statistics.responses++;
+                        lin_state = LIN_STATE_IDLE;
+                    }
+                    else { /* Nothing */ }
+                }
+                break;
+
+            case LIN_STATE_SUBSCRIBE :
+                lin_response[lin_response_count] = _data;
+                lin_response_count++;
+                if(lin_response_count > lin_current_frame->length)
+                {
+                    lin_response_end();
+                }
+                else { /* Nothing */ }
+                break;
+
+            default :
+                /* Bytes outside of a frame are ignored until the next break */
+                break;
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Master_Tick(void)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    const lin_schedule_entry_t *l_entry = NULL;
+    uint8 l_header[2] = {LIN_SYNC_BYTE, 0U};
+
+    if((NULL == lin_active) || (LIN_NODE_MASTER != lin_active->node))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        if(ZERO_INIT != lin_slot_timer)
+        {
+            lin_slot_timer--;
+        }
+        else { /* Nothing */ }
+
+        if(ZERO_INIT == lin_slot_timer)
+        {
+            l_entry = &(lin_active->schedule[lin_schedule_index]);
+            lin_schedule_index++;
+            if(lin_schedule_index >= lin_active->schedule_count)
+            {
+                lin_schedule_index = ZERO_INIT;
+            }
+            else { /* Nothing */ }
+            lin_slot_timer = l_entry->slot_ticks;
+
+            /* Break, sync and identifier, the responses are queued by the receive interrupt */
+            l_header[1] = lin_protected_id(l_entry->frame_id);
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptDisable();
+#endif
+            ret = EUSART_ASYNC_Send_Break();
+            if(E_OK == ret)
+            {
+                ret = EUSART_ASYNC_WriteNonBlocking(l_header, 2U);
+            }
+            else { /* The previous slot overran, this header is skipped */ }
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptEnable();
+#endif
+        }
+        else { /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Read_Frame(uint8 _frame_id, uint8 *_data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    lin_frame_t *l_frame = NULL;
+
+    if((NULL == _data) || (NULL == lin_active))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_frame = lin_find_frame(_frame_id);
+        if((NULL != l_frame) && (l_frame->updated))
+        {
+            /* The receive interrupt writes the whole response at once, keep it out of the copy */
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptDisable();
+#endif
+            memcpy(_data, l_frame->data, l_frame->length);
+            l_frame->updated = ZERO_INIT;
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptEnable();
+#endif
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Write_Frame(uint8 _frame_id, const uint8 *_data)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    lin_frame_t *l_frame = NULL;
+
+    if((NULL == _data) || (NULL == lin_active))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_frame = lin_find_frame(_frame_id);
+        if((NULL != l_frame) && (LIN_FRAME_PUBLISH == l_frame->direction))
+        {
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptDisable();
+#endif
+            memcpy(l_frame->data, _data, l_frame->length);
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptEnable();
+#endif
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType LIN_Get_Statistics(lin_statistics_t *_statistics)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL == _statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _statistics->headers = MCAL_Read_Shared_U16(&(lin_statistics.headers));
+        _statistics->responses = MCAL_Read_Shared_U16(&(lin_statistics.responses));
+        _statistics->parity_errors = MCAL_Read_Shared_U16(&(lin_statistics.parity_errors));
+        _statistics->checksum_errors = MCAL_Read_Shared_U16(&(lin_statistics.checksum_errors));
+        _statistics->bit_errors = MCAL_Read_Shared_U16(&(lin_statistics.bit_errors));
+        _statistics->no_responses = MCAL_Read_Shared_U16(&(lin_statistics.no_responses));
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Protected identifier : P0 = ID0 ^ ID1 ^ ID2 ^ ID4 in bit 6, P1 = !(ID1 ^ ID3 ^ ID4 ^ ID5) in bit 7.
+ */
+static uint8 lin_protected_id(uint8 _frame_id)
+{
+    uint8 l_p0 = (uint8)((_frame_id ^ (_frame_id >> 1) ^ (_frame_id >> 2) ^ (_frame_id >> 4)) & 1U);
+    uint8 l_p1 = (uint8)(~((_frame_id >> 1) ^ (_frame_id >> 3) ^ (_frame_id >> 4) ^ (_frame_id >> 5)) & 1U);
+
+    return (uint8)((_frame_id & LIN_MAX_FRAME_ID) | (uint8)(l_p0 << 6) | (uint8)(l_p1 << 7));
+}
+
+/**
+ * @brief Inverted 8-bit sum with carry wrap-around, over the identifier too for the enhanced checksum.
+ */
+static uint8 lin_checksum(const lin_frame_t *_frame, uint8 _pid, const uint8 *_data)
+{
+    uint16 l_sum = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((LIN_CHECKSUM_ENHANCED == _frame->checksum) &&
+       (LIN_MASTER_REQUEST_ID != _frame->frame_id) && (LIN_SLAVE_RESPONSE_ID != _frame->frame_id))
+    {
+        l_sum = _pid;
+    }
+    else { /* Classic checksum, and always for the diagnostic frames */ }
+
+    for(l_index = 0; l_index < _frame->length; l_index++)
+    {
+        l_sum += _data[l_index];
+        if(l_sum > 0xFFU)
+        {
+            l_sum -= 0xFFU;
+        }
+        else { /* Nothing */ }
+    }
+    return (uint8)(~l_sum);
+}
+
+static lin_frame_t *lin_find_frame(uint8 _frame_id)
+{
+    lin_frame_t *l_frame = NULL;
+    uint8 l_index = ZERO_INIT;
+
+    while((NULL == l_frame) && (l_index < lin_active->frame_count))
+    {
+        if(_frame_id == lin_active->frames[l_index].frame_id)
+        {
+            l_frame = &(lin_active->frames[l_index]);
+        }
+        else { /* Nothing */ }
+        l_index++;
+    }
+    return l_frame;
+}
+
+/**
+ * @brief Checks the protected identifier and starts the response of the frame.
+ */
+static void lin_identifier(uint8 _pid)
+{
+    uint8 l_length = ZERO_INIT;
+
+    lin_state = LIN_STATE_IDLE;
+    if(_pid != lin_protected_id(_pid))
+    {
+        lin_statistics.parity_errors++;
+    }
+    else
+    {
+        lin_statistics.headers++;
+        lin_current_pid = _pid;
+        lin_current_frame = lin_find_frame((uint8)(_pid & LIN_MAX_FRAME_ID));
+        lin_response_count = ZERO_INIT;
+
+        if(NULL == lin_current_frame)
+        {
+            /* Not a frame of this node */
+        }
+        else if(LIN_FRAME_PUBLISH == lin_current_frame->direction)
+        {
+            /* Queued at once, the response space starts right after the identifier */
+            l_length = lin_current_frame->length;
+            memcpy(lin_response, lin_current_frame->data, l_length);
+            lin_response[l_length] = lin_checksum(lin_current_frame, _pid, lin_response);
+            if(E_OK == EUSART_ASYNC_WriteNonBlocking(lin_response, (uint16)(l_length + 1U)))
+            {
+                lin_state = LIN_STATE_PUBLISH;
+            }
+            else { /* Nothing */ }
+        }
+        else
+        {
+            lin_state = LIN_STATE_SUBSCRIBE;
+        }
+    }
+}
+
+/**
+ * @brief Checks the checksum of a subscribed response and publishes it to the frame.
+ */
+static void lin_response_end(void)
+{
+    uint8 l_length = lin_current_frame->length;
+
+    if(lin_response[l_length] == lin_checksum(lin_current_frame, lin_current_pid, lin_response))
+    {
+        memcpy(lin_current_frame->data, lin_response, l_length);
+        lin_current_frame->updated = 1;
+        lin_statistics.responses++;
+    }
+    else
+    {
+        lin_statistics.checksum_errors++;
+    }
+    lin_state = LIN_STATE_IDLE;
+}
@@ -0,0 +1,180 @@
+/*
+ * File:   hal_usart_lin.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 2:30 AM
+ */
+
+#ifndef HAL_USART_LIN_H
+#define	HAL_USART_LIN_H
+
+/* ----------------- Includes -----------------*/
+#include "hal_usart.h"
+
+/* ----------------- Macro Declarations -----------------*/
+
+/* Largest response, LIN 2.x frames carry 1 to 8 data bytes */
+#define LIN_MAX_DATA_LENGTH            8U
+
+/* Sync field of the header, sent after the break */
+#define LIN_SYNC_BYTE                  0x55U
+
+/* Frame identifiers 0 .. 63, the diagnostic frames always use the classic checksum */
+#define LIN_MAX_FRAME_ID               0x3FU
+#define LIN_MASTER_REQUEST_ID          0x3CU
+#define LIN_SLAVE_RESPONSE_ID          0x3DU
+
+/* ----------------- Macro Functions Declarations -----------------*/
+
+/* ----------------- Data Type Declarations -----------------*/
+typedef enum{
+    LIN_NODE_MASTER,            /* Sends the headers from the schedule table */
+    LIN_NODE_SLAVE              /* Answers the headers, synchronizes on the sync field */
+}lin_node_t;
+
+typedef enum{
+    LIN_FRAME_PUBLISH,          /* This node sends the response */
+    LIN_FRAME_SUBSCRIBE         /* This node receives the response */
+}lin_direction_t;
+
+typedef enum{
+    LIN_CHECKSUM_CLASSIC,       /* LIN 1.x, data bytes only */
+    LIN_CHECKSUM_ENHANCED       /* LIN 2.x, protected identifier and data bytes */
+}lin_checksum_t;
+
+typedef struct{
+    uint8 frame_id;                         /* 0 .. LIN_MAX_FRAME_ID */
+    uint8 length;                           /* 1 .. LIN_MAX_DATA_LENGTH */
+    lin_direction_t direction;
+    lin_checksum_t checksum;
+    uint8 data[LIN_MAX_DATA_LENGTH];        /* Response, accessed with LIN_Read_Frame() / LIN_Write_Frame() */
+    uint8 updated;                          /* Subscribed response received and not read yet */
+}lin_frame_t;
+
+typedef struct{
+    uint8 frame_id;             /* Header sent in this slot */
+    uint8 slot_ticks;           /* Slot length in LIN_Master_Tick() periods, header to next header */
+}lin_schedule_entry_t;
+
+typedef struct{
+    uint16 headers;             /* Valid headers seen on the bus, sent or received */
+    uint16 responses;           /* Responses sent or received with a good checksum */
+    uint16 parity_errors;       /* Protected identifiers with bad parity bits */
+    uint16 checksum_errors;
+    uint16 bit_errors;          /* Published bytes read back different from the bus */
+    uint16 no_responses;        /* Subscribed responses missing or incomplete at the end of the slot */
+}lin_statistics_t;
+
+/*
+ * lin_usart : baudrate, baudrate_gen_gonfig and the priorities are used, the rest is set by
+ *             LIN_Init(). A slave starts at this rate and follows the master from the first header.
+ * schedule  : master only, run in a loop by LIN_Master_Tick().
+ */
+typedef struct{
+    usart_t lin_usart;
+    lin_node_t node;
+    lin_frame_t *frames;
+    uint8 frame_count;
+    const lin_schedule_entry_t *schedule;
+    uint8 schedule_count;
+}lin_t;
+
+/* ----------------- Software Interfaces Declarations -----------------*/
+/**
+ * @Summary Handles a break on the bus.
+ * @Description The break is received as a 0x00 byte with a framing error, EUSART_RX_ISR() reports
+ *              it through the framing error handler. A slave arms the auto-baud detect to measure
+ *              the sync field that follows, a master expects the echo of its own sync byte.
+ *              Public so recorded bus traffic can be replayed.
+ * @Preconditions LIN_Init() or LIN_Select() function should have been called.
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : No LIN node selected
+ */
+Std_ReturnType LIN_Break_Event(void);
+
+/**
+ * @Summary Handles one received byte (sync, identifier or response).
+ * @Description The identifier selects the frame of the frame table : a published response is
+ *              queued at once and read back from the bus, a subscribed response is collected and
+ *              checked. A master also receives its own header and responses on the single wire.
+ * @Preconditions LIN_Init() or LIN_Select() function should have been called.
+ * @param _data Received byte
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : No LIN node selected
+ */
+Std_ReturnType LIN_Rx_Byte(uint8 _data);
+
+/**
+ * @Summary Selects the node answered by LIN_Break_Event() / LIN_Rx_Byte().
+ * @Description Called by LIN_Init(), it can be used alone to replay recorded traffic.
+ *              The protocol state and the counters are cleared.
+ * @Preconditions None
+ * @param _lin Pointer to the LIN node configurations
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : Invalid frame table or schedule
+ */
+Std_ReturnType LIN_Select(lin_t *_lin);
+
+/**
+ * @Summary Runs the master schedule table.
+ * @Description To be called periodically, the LIN time base. When the current slot ends the next
+ *              header is sent : break (SENDB), sync and protected identifier. A subscribed response
+ *              still incomplete at that point is counted as missing.
+ * @Preconditions LIN_Init() function should have been called for a master node.
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : Not a master, or the transmitter was still busy and the header was skipped
+ */
+Std_ReturnType LIN_Master_Tick(void);
+
+/**
+ * @Summary Reads the last received response of a subscribed frame.
+ * @Preconditions None
+ * @param _frame_id Frame identifier
+ * @param _data Pointer to the destination, the frame length
+ * @return Status of the function
+ *          (E_OK) : A new response was copied
+ *          (E_NOT_OK) : No response since the last read, or unknown frame
+ */
+Std_ReturnType LIN_Read_Frame(uint8 _frame_id, uint8 *_data);
+
+/**
+ * @Summary Updates the response of a published frame.
+ * @Description The next header with this identifier sends the new data.
+ * @Preconditions None
+ * @param _frame_id Frame identifier
+ * @param _data Pointer to the data, the frame length
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : Unknown frame or invalid parameters
+ */
+Std_ReturnType LIN_Write_Frame(uint8 _frame_id, const uint8 *_data);
+
+/**
+ * @Summary Gets the bus counters.
+ * @Preconditions None
+ * @param _statistics Pointer to the counters
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType LIN_Get_Statistics(lin_statistics_t *_statistics);
+
+#if (EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE) && (EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE)
+/**
+ * @Summary Initializes the EUSART as a LIN node.
+ * @Description 8N1 with both EUSART interrupts, the whole protocol runs from them. Only one LIN
+ *              node can run, it owns the EUSART.
+ * @Preconditions None
+ * @param _lin Pointer to the LIN node configurations
+ * @return Status of the function
+ *          (E_OK) : The function executed successfully
+ *          (E_NOT_OK) : The function encountered an issue during execution
+ */
+Std_ReturnType LIN_Init(lin_t *_lin);
+#endif
+
+#endif	/* HAL_USART_LIN_H */
@@ -0,0 +1,42 @@
+/*
+ * File:   mcal_shared_read.h
+ * Author: Abdelrahman Aref
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#ifndef MCAL_SHARED_READ_H
+#define	MCAL_SHARED_READ_H
+
+/* Section : Includes */
+#include "mcal_std_types.h"
+
+/* Section: Macro Declarations */
+
+/* Section: Macro Functions Declarations */
+
+/* Section: Data Type Declarations */
+
+/* Section: Function Declarations */
+
+/**
+ * @brief Reads a 16-bit variable written by an interrupt, with the interrupts enabled.
+ * @details The PIC18 reads it one byte at a time, an interrupt between the two bytes gives
+ *          a value that never existed. It's read again until two reads agree, which only
+ *          repeats when the interrupt wrote it in between.
+ * @param _value Pointer to the variable.
+ * @return The value.
+ */
+static inline uint16 MCAL_Read_Shared_U16(const volatile uint16 *_value)
+{
+    uint16 l_value = ZERO_INIT;
+
+    do
+    {
+        l_value = *_value;
+    }while(l_value != *_value);
+
+    return l_value;
+}
+
+#endif	/* MCAL_SHARED_READ_H */
@@ -20,8 +20,8 @@ typedef unsigned char    uint8;
 typedef unsigned short   uint16; 
 typedef unsigned long    uint32; 
 
-typedef unsigned char    sint8; 
-typedef unsigned short   sint16; 
+typedef signed char      sint8; 
+typedef signed short     sint16; 
 typedef signed long      sint32;
 
 typedef uint8            Std_ReturnType;
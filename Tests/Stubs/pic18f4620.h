@@ -0,0 +1,149 @@
+/*
+ * File:   pic18f4620.h
+ * Author: Abdelrahman Aref
+ *
+ * Host build stand-in for the XC8 device header : the SFRs used by the drivers
+ * become plain variables (defined in pic18f4620_regs.c) so the tests can drive them.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#ifndef PIC18F4620_STUB_H
+#define PIC18F4620_STUB_H
+typedef struct { unsigned ADON:8; unsigned CHS:8; unsigned GODONE:8; unsigned GO_nDONE:8; } ADCON0bits_t; extern volatile ADCON0bits_t ADCON0bits;
+typedef struct { unsigned PCFG:8; unsigned VCFG0:8; unsigned VCFG1:8; } ADCON1bits_t; extern volatile ADCON1bits_t ADCON1bits;
+typedef struct { unsigned ACQT:8; unsigned ADCS:8; unsigned ADFM:8; } ADCON2bits_t; extern volatile ADCON2bits_t ADCON2bits;
+typedef struct { unsigned ABDEN:8; unsigned ABDOVF:8; unsigned BRG16:8; unsigned SCKP:8; } BAUDCONbits_t; extern volatile BAUDCONbits_t BAUDCONbits;
+typedef struct { unsigned CCP1M:8; unsigned DC1B:8; } CCP1CONbits_t; extern volatile CCP1CONbits_t CCP1CONbits;
+typedef struct { unsigned CCP2M:8; unsigned DC2B:8; } CCP2CONbits_t; extern volatile CCP2CONbits_t CCP2CONbits;
+typedef struct { unsigned CFGS:8; unsigned EEPGD:8; unsigned RD:8; unsigned WR:8; unsigned WREN:8; } EECON1bits_t; extern volatile EECON1bits_t EECON1bits;
+typedef struct { unsigned GIE:8; unsigned GIEH:8; unsigned GIEL:8; unsigned INT0IE:8; unsigned INT0IF:8; unsigned PEIE:8; unsigned RBIE:8; unsigned RBIF:8; unsigned TMR0IE:8; unsigned TMR0IF:8; } INTCONbits_t; extern volatile INTCONbits_t INTCONbits;
+typedef struct { unsigned INTEDG0:8; unsigned INTEDG1:8; unsigned INTEDG2:8; unsigned RBIP:8; unsigned TMR0IP:8; } INTCON2bits_t; extern volatile INTCON2bits_t INTCON2bits;
+typedef struct { unsigned INT1E:8; unsigned INT1F:8; unsigned INT1IE:8; unsigned INT1IF:8; unsigned INT1IP:8; unsigned INT2IE:8; unsigned INT2IF:8; unsigned INT2IP:8; } INTCON3bits_t; extern volatile INTCON3bits_t INTCON3bits;
+typedef struct { unsigned ADIP:8; unsigned CCP1IP:8; unsigned RCIP:8; unsigned SSPIP:8; unsigned TMR1IP:8; unsigned TMR2IP:8; unsigned TXIP:8; } IPR1bits_t; extern volatile IPR1bits_t IPR1bits;
+typedef struct { unsigned BCLIP:8; unsigned CCP2IP:8; unsigned TMR3IP:8; } IPR2bits_t; extern volatile IPR2bits_t IPR2bits;
+typedef struct { unsigned ADIE:8; unsigned CCP1IE:8; unsigned RCIE:8; unsigned SSPIE:8; unsigned TMR1IE:8; unsigned TMR2IE:8; unsigned TXIE:8; } PIE1bits_t; extern volatile PIE1bits_t PIE1bits;
+typedef struct { unsigned BCLIE:8; unsigned CCP2IE:8; unsigned TMR3IE:8; } PIE2bits_t; extern volatile PIE2bits_t PIE2bits;
+typedef struct { unsigned ADIF:8; unsigned CCP1IF:8; unsigned RCIF:8; unsigned SSPIF:8; unsigned TMR1IF:8; unsigned TMR2IF:8; unsigned TXIF:8; } PIR1bits_t; extern volatile PIR1bits_t PIR1bits;
+typedef struct { unsigned BCLIF:8; unsigned CCP2IF:8; unsigned TMR3IF:8; } PIR2bits_t; extern volatile PIR2bits_t PIR2bits;
+typedef struct { unsigned RB4:8; unsigned RB5:8; unsigned RB6:8; unsigned RB7:8; } PORTBbits_t; extern volatile PORTBbits_t PORTBbits;
+typedef struct { unsigned IPEN:8; } RCONbits_t; extern volatile RCONbits_t RCONbits;
+typedef struct { unsigned ADDEN:8; unsigned CREN:8; unsigned FERR:8; unsigned OERR:8; unsigned RX9:8; unsigned RX9D:8; unsigned SPEN:8; unsigned SREN:8; } RCSTAbits_t; extern volatile RCSTAbits_t RCSTAbits;
+typedef struct { unsigned CKP:8; unsigned SSPEN:8; unsigned SSPM:8; unsigned SSPOV:8; unsigned WCOL:8; } SSPCON1bits_t; extern volatile SSPCON1bits_t SSPCON1bits;
+typedef struct { unsigned ACKDT:8; unsigned ACKEN:8; unsigned ACKSTAT:8; unsigned GCEN:8; unsigned PEN:8; unsigned RCEN:8; unsigned RSEN:8; unsigned SEN:8; } SSPCON2bits_t; extern volatile SSPCON2bits_t SSPCON2bits;
+typedef struct { unsigned BF:8; unsigned CKE:8; unsigned P:8; unsigned S:8; unsigned SMP:8; } SSPSTATbits_t; extern volatile SSPSTATbits_t SSPSTATbits;
+typedef struct { unsigned PSA:8; unsigned T08BIT:8; unsigned T0CS:8; unsigned T0PS:8; unsigned T0SE:8; unsigned TMR0ON:8; } T0CONbits_t; extern volatile T0CONbits_t T0CONbits;
+typedef struct { unsigned RD16:8; unsigned T1CKPS:8; unsigned T1OSCEN:8; unsigned T1RUN:8; unsigned T1SYNC:8; unsigned TMR1CS:8; unsigned TMR1ON:8; } T1CONbits_t; extern volatile T1CONbits_t T1CONbits;
+typedef struct { unsigned T2CKPS:8; unsigned TMR2ON:8; unsigned TOUTPS:8; } T2CONbits_t; extern volatile T2CONbits_t T2CONbits;
+typedef struct { unsigned RD16:8; unsigned T3CCP1:8; unsigned T3CCP2:8; unsigned T3CKPS:8; unsigned T3SYNC:8; unsigned TMR3CS:8; unsigned TMR3ON:8; } T3CONbits_t; extern volatile T3CONbits_t T3CONbits;
+typedef struct { unsigned RC6:8; unsigned RC7:8; unsigned TRISC3:8; unsigned TRISC4:8; } TRISCbits_t; extern volatile TRISCbits_t TRISCbits;
+typedef struct { unsigned BRGH:8; unsigned CSRC:8; unsigned SENDB:8; unsigned SYNC:8; unsigned TRMT:8; unsigned TX9:8; unsigned TX9D:8; unsigned TXEN:8; } TXSTAbits_t; extern volatile TXSTAbits_t TXSTAbits;
+extern volatile unsigned char PORTA;
+extern volatile unsigned char PORTB;
+extern volatile unsigned char PORTC;
+extern volatile unsigned char PORTD;
+extern volatile unsigned char PORTE;
+extern volatile unsigned char LATA;
+extern volatile unsigned char LATB;
+extern volatile unsigned char LATC;
+extern volatile unsigned char LATD;
+extern volatile unsigned char LATE;
+extern volatile unsigned char TRISA;
+extern volatile unsigned char TRISB;
+extern volatile unsigned char TRISC;
+extern volatile unsigned char TRISD;
+extern volatile unsigned char TRISE;
+extern volatile unsigned char ADRESH;
+extern volatile unsigned char ADRESL;
+extern volatile unsigned char ADCON0;
+extern volatile unsigned char ADCON1;
+extern volatile unsigned char ADCON2;
+#ifdef TEST_TXREG_CAPTURE
+/* Each TXREG write lands in the slot given by the test, as if the byte was shifted out at once */
+volatile unsigned char *Test_Txreg_Slot(void);
+#define TXREG (*Test_Txreg_Slot())
+#else
+extern volatile unsigned char TXREG;
+#endif
+#ifdef TEST_RCREG_FEED
+/* Each RCREG read takes the received byte from the test, which also updates RCIF, FERR and RX9D */
+unsigned char Test_Rcreg_Read(void);
+#define RCREG (Test_Rcreg_Read())
+#else
+extern volatile unsigned char RCREG;
+#endif
+extern volatile unsigned char SPBRG;
+extern volatile unsigned char SPBRGH;
+extern volatile unsigned char TXSTA;
+extern volatile unsigned char RCSTA;
+extern volatile unsigned char BAUDCON;
+extern volatile unsigned char PR2;
+extern volatile unsigned char TMR0;
+extern volatile unsigned char TMR0H;
+extern volatile unsigned char TMR0L;
+extern volatile unsigned char TMR1H;
+extern volatile unsigned char TMR1L;
+extern volatile unsigned char TMR2;
+extern volatile unsigned char TMR3H;
+extern volatile unsigned char TMR3L;
+extern volatile unsigned char CCPR1;
+extern volatile unsigned char CCPR1H;
+extern volatile unsigned char CCPR1L;
+extern volatile unsigned char CCPR2;
+extern volatile unsigned char CCPR2H;
+extern volatile unsigned char CCPR2L;
+extern volatile unsigned char T0CON;
+extern volatile unsigned char T1CON;
+extern volatile unsigned char T2CON;
+extern volatile unsigned char T3CON;
+extern volatile unsigned char CCP1CON;
+extern volatile unsigned char CCP2CON;
+extern volatile unsigned char SSPBUF;
+extern volatile unsigned char SSPADD;
+extern volatile unsigned char SSPCON1;
+extern volatile unsigned char SSPCON2;
+extern volatile unsigned char SSPSTAT;
+extern volatile unsigned char EEADR;
+extern volatile unsigned char EEADRH;
+extern volatile unsigned char EEDATA;
+extern volatile unsigned char EECON1;
+extern volatile unsigned char EECON2;
+extern volatile unsigned char INTCON;
+extern volatile unsigned char INTCON2;
+extern volatile unsigned char INTCON3;
+extern volatile unsigned char PIR1;
+extern volatile unsigned char PIR2;
+extern volatile unsigned char PIE1;
+extern volatile unsigned char PIE2;
+extern volatile unsigned char IPR1;
+extern volatile unsigned char IPR2;
+extern volatile unsigned char RCON;
+extern volatile unsigned char STATUS;
+extern volatile unsigned char WREG;
+extern volatile unsigned char TBLPTR;
+extern volatile unsigned char TBLPTRL;
+extern volatile unsigned char TBLPTRH;
+extern volatile unsigned char TBLPTRU;
+extern volatile unsigned char TABLAT;
+extern volatile unsigned char OSCCON;
+#define _TRISA_RA0_POSN 0
+#define _TRISA_RA1_POSN 0
+#define _TRISA_RA2_POSN 0
+#define _TRISA_RA3_POSN 0
+#define _TRISA_RA5_POSN 0
+#define _TRISB_RB0_POSN 0
+#define _TRISB_RB1_POSN 0
+#define _TRISB_RB2_POSN 0
+#define _TRISB_RB3_POSN 0
+#define _TRISB_RB4_POSN 0
+#define _TRISE_RE0_POSN 0
+#define _TRISE_RE1_POSN 0
+#define _TRISE_RE2_POSN 0
+#define NOP() ((void)0)
+#define ei() ((void)0)
+#define di() ((void)0)
+#define __interrupt(x)
+#define __delay_ms(x) ((void)0)
+#define __delay_us(x) ((void)0)
+#define _delay(x) ((void)0)
+#endif
@@ -0,0 +1,119 @@
+/*
+ * File:   pic18f4620_regs.c
+ * Author: Abdelrahman Aref
+ *
+ * SFR storage of the host build device header.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "pic18f4620.h"
+
+volatile ADCON0bits_t ADCON0bits;
+volatile ADCON1bits_t ADCON1bits;
+volatile ADCON2bits_t ADCON2bits;
+volatile BAUDCONbits_t BAUDCONbits;
+volatile CCP1CONbits_t CCP1CONbits;
+volatile CCP2CONbits_t CCP2CONbits;
+volatile EECON1bits_t EECON1bits;
+volatile INTCONbits_t INTCONbits;
+volatile INTCON2bits_t INTCON2bits;
+volatile INTCON3bits_t INTCON3bits;
+volatile IPR1bits_t IPR1bits;
+volatile IPR2bits_t IPR2bits;
+volatile PIE1bits_t PIE1bits;
+volatile PIE2bits_t PIE2bits;
+volatile PIR1bits_t PIR1bits;
+volatile PIR2bits_t PIR2bits;
+volatile PORTBbits_t PORTBbits;
+volatile RCONbits_t RCONbits;
+volatile RCSTAbits_t RCSTAbits;
+volatile SSPCON1bits_t SSPCON1bits;
+volatile SSPCON2bits_t SSPCON2bits;
+volatile SSPSTATbits_t SSPSTATbits;
+volatile T0CONbits_t T0CONbits;
+volatile T1CONbits_t T1CONbits;
+volatile T2CONbits_t T2CONbits;
+volatile T3CONbits_t T3CONbits;
+volatile TRISCbits_t TRISCbits;
+volatile TXSTAbits_t TXSTAbits;
+volatile unsigned char PORTA;
+volatile unsigned char PORTB;
+volatile unsigned char PORTC;
+volatile unsigned char PORTD;
+volatile unsigned char PORTE;
+volatile unsigned char LATA;
+volatile unsigned char LATB;
+volatile unsigned char LATC;
+volatile unsigned char LATD;
+volatile unsigned char LATE;
+volatile unsigned char TRISA;
+volatile unsigned char TRISB;
+volatile unsigned char TRISC;
+volatile unsigned char TRISD;
+volatile unsigned char TRISE;
+volatile unsigned char ADRESH;
+volatile unsigned char ADRESL;
+volatile unsigned char ADCON0;
+volatile unsigned char ADCON1;
+volatile unsigned char ADCON2;
+#ifndef TEST_TXREG_CAPTURE
+volatile unsigned char TXREG;
+#endif
+#ifndef TEST_RCREG_FEED
+volatile unsigned char RCREG;
+#endif
+volatile unsigned char SPBRG;
+volatile unsigned char SPBRGH;
+volatile unsigned char TXSTA;
+volatile unsigned char RCSTA;
+volatile unsigned char BAUDCON;
+volatile unsigned char PR2;
+volatile unsigned char TMR0;
+volatile unsigned char TMR0H;
+volatile unsigned char TMR0L;
+volatile unsigned char TMR1H;
+volatile unsigned char TMR1L;
+volatile unsigned char TMR2;
+volatile unsigned char TMR3H;
+volatile unsigned char TMR3L;
+volatile unsigned char CCPR1;
+volatile unsigned char CCPR1H;
+volatile unsigned char CCPR1L;
+volatile unsigned char CCPR2;
+volatile unsigned char CCPR2H;
+volatile unsigned char CCPR2L;
+volatile unsigned char T0CON;
+volatile unsigned char T1CON;
+volatile unsigned char T2CON;
+volatile unsigned char T3CON;
+volatile unsigned char CCP1CON;
+volatile unsigned char CCP2CON;
+volatile unsigned char SSPBUF;
+volatile unsigned char SSPADD;
+volatile unsigned char SSPCON1;
+volatile unsigned char SSPCON2;
+volatile unsigned char SSPSTAT;
+volatile unsigned char EEADR;
+volatile unsigned char EEADRH;
+volatile unsigned char EEDATA;
+volatile unsigned char EECON1;
+volatile unsigned char EECON2;
+volatile unsigned char INTCON;
+volatile unsigned char INTCON2;
+volatile unsigned char INTCON3;
+volatile unsigned char PIR1;
+volatile unsigned char PIR2;
+volatile unsigned char PIE1;
+volatile unsigned char PIE2;
+volatile unsigned char IPR1;
+volatile unsigned char IPR2;
+volatile unsigned char RCON;
+volatile unsigned char STATUS;
+volatile unsigned char WREG;
+volatile unsigned char TBLPTR;
+volatile unsigned char TBLPTRL;
+volatile unsigned char TBLPTRH;
+volatile unsigned char TBLPTRU;
+volatile unsigned char TABLAT;
+volatile unsigned char OSCCON;
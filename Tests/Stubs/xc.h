@@ -0,0 +1,15 @@
+/*
+ * File:   xc.h
+ * Author: Abdelrahman Aref
+ *
+ * Host build stand-in for the XC8 compiler header.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#ifndef XC_H
+#define	XC_H
+
+#include "pic18f4620.h"
+
+#endif	/* XC_H */
@@ -0,0 +1,135 @@
+/*
+ * File:   test_adc_burst_model.c
+ * Author: Abdelrahman Aref
+ *
+ * Timing model of the 8-bit burst, not a measurement. The burst runs through ADC_ISR() on a
+ * simulated converter which charges each conversion with the timing programmed in ADCON2
+ * (ACQT + 11 TAD) plus ISR_CYCLES_ESTIMATE, so the modelled rate follows the driver settings.
+ * ISR_CYCLES_ESTIMATE (interrupt entry, dispatch, adc_burst_step() and exit) is hand counted,
+ * not read from the XC8 output : the rates printed are only as good as that guess, the
+ * checks on the ADCON2 settings are exact.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/ADC/hal_adc.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+#define BURST_LENGTH                      512U
+#define ISR_CYCLES_ESTIMATE               70UL
+
+/* FOSC periods of each ADCS setting (0 : FRC, about 1.2 us in the datasheet) and TADs of each ACQT setting */
+static const uint32 clock_dividers[8] = {2UL, 8UL, 32UL, 0UL, 4UL, 16UL, 64UL, 0UL};
+static const uint32 acquisition_tads[8] = {0UL, 2UL, 4UL, 6UL, 8UL, 12UL, 16UL, 20UL};
+
+static uint8 burst_buffer[BURST_LENGTH];
+static uint8 burst_complete = 0U;
+
+/* Acquisition of the first conversion, in FOSC periods */
+static uint32 first_acquisition_cycles = 0UL;
+
+static void Burst_Complete(void)
+{
+    burst_complete = 1U;
+}
+
+static uint32 TAD_Cycles(void)
+{
+    return (0UL != clock_dividers[ADCON2bits.ADCS]) ? clock_dividers[ADCON2bits.ADCS] : ((12UL * _XTAL_FREQ) / 10000000UL);
+}
+
+/* Runs the burst, returns its length in FOSC periods */
+static uint32 Run_Burst(const adc_conf_t *_adc, const adc_burst_cfg_t *_burst)
+{
+    uint32 l_cycles = 0UL;
+    uint16 l_sample = 0U;
+
+    burst_complete = 0U;
+    TEST_CHECK(E_OK == ADC_Burst_Start_8Bit(_adc, _burst));
+    first_acquisition_cycles = acquisition_tads[ADCON2bits.ACQT] * TAD_Cycles();
+    while(0U == burst_complete)
+    {
+        TEST_CHECK(1U == ADCON0bits.GODONE);
+        /* Acquisition, 11 TAD of conversion, then the interrupt starts the next one */
+        l_cycles += (acquisition_tads[ADCON2bits.ACQT] + 11UL) * TAD_Cycles();
+        l_cycles += 4UL * ISR_CYCLES_ESTIMATE;
+        ADCON0bits.GODONE = 0U;
+        ADRESH = (uint8)l_sample;
+        l_sample++;
+        ADC_ISR();
+    }
+    return l_cycles;
+}
+
+int main(void)
+{
+    adc_conf_t l_adc = {0};
+    adc_burst_cfg_t l_burst = {0};
+    uint32 l_cycles = 0UL;
+    uint32 l_rate = 0UL;
+    uint16 l_count = 0U;
+
+    l_burst.ADC_BurstCompleteHandler = Burst_Complete;
+    l_burst.buffer = burst_buffer;
+    l_burst.length = BURST_LENGTH;
+    l_burst.channel = ADC_CHANNEL_AN2;
+
+    /* Automatic timing : fastest TAD from the start */
+    l_adc.adc_channel = ADC_CHANNEL_AN0;
+    l_adc.result_format = ADC_RESULT_RIGHT;
+    l_adc.manual_timing = ADC_TIMING_AUTO;
+    TEST_CHECK(E_OK == ADC_Init(&l_adc));
+    l_cycles = Run_Burst(&l_adc, &l_burst);
+    l_rate = (uint32)(((unsigned long long)BURST_LENGTH * _XTAL_FREQ) / l_cycles);
+    printf("model, burst at %lu Hz, TAD %lu ns : %lu samples/s (%lu instruction cycles per sample)\n",
+           (unsigned long)_XTAL_FREQ, (unsigned long)ADC_AUTO_TAD_NS, (unsigned long)l_rate,
+           (unsigned long)(l_cycles / (4UL * BURST_LENGTH)));
+    TEST_CHECK(E_OK == ADC_Burst_Get_Count(&l_adc, &l_count));
+    TEST_CHECK(BURST_LENGTH == l_count);
+    TEST_CHECK((0x00U == burst_buffer[0]) && (0xFFU == burst_buffer[255]) && (0xFFU == burst_buffer[BURST_LENGTH - 1U]));
+    TEST_CHECK(l_rate > 15000UL);
+    /* Settings of _adc back after the burst */
+    TEST_CHECK((ADC_AUTO_CONVERSION_CLOCK == ADCON2bits.ADCS) && (ADC_AUTO_ACQUISITION_TIME == ADCON2bits.ACQT));
+    TEST_CHECK(1U == ADCON2bits.ADFM);
+
+    /* Manual FOSC/32 with 4 TAD (16 us) : the first acquisition is recomputed in fast TADs */
+    l_adc.manual_timing = ADC_TIMING_MANUAL;
+    l_adc.conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_32;
+    l_adc.acquisition_time = ADC_4_TAD;
+    TEST_CHECK(E_OK == ADC_Init(&l_adc));
+    l_cycles = Run_Burst(&l_adc, &l_burst);
+    TEST_CHECK(first_acquisition_cycles >= (4UL * 32UL));
+    TEST_CHECK(first_acquisition_cycles < (4UL * 32UL) + (4UL * ADC_FASTEST_CONVERSION_DIVIDER));
+    l_rate = (uint32)(((unsigned long long)BURST_LENGTH * _XTAL_FREQ) / l_cycles);
+    printf("model, manual FOSC/32 4 TAD : first acquisition %lu cycles, %lu samples/s\n",
+           (unsigned long)first_acquisition_cycles, (unsigned long)l_rate);
+    TEST_CHECK(l_rate > 15000UL);
+    TEST_CHECK((ADC_CONVERSION_CLOCK_FOSC_DIV_32 == ADCON2bits.ADCS) && (ADC_4_TAD == ADCON2bits.ACQT));
+
+    /* Manual FOSC/64 with 20 TAD : too long for 20 fast TADs, the configured clock is kept */
+    l_adc.conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_64;
+    l_adc.acquisition_time = ADC_20_TAD;
+    TEST_CHECK(E_OK == ADC_Init(&l_adc));
+    l_cycles = Run_Burst(&l_adc, &l_burst);
+    TEST_CHECK(first_acquisition_cycles == (20UL * 64UL));
+    l_rate = (uint32)(((unsigned long long)BURST_LENGTH * _XTAL_FREQ) / l_cycles);
+    printf("model, manual FOSC/64 20 TAD : first acquisition %lu cycles, %lu samples/s\n",
+           (unsigned long)first_acquisition_cycles, (unsigned long)l_rate);
+
+    /* Single conversions : acquisition after ADC_Init() and on a channel change only */
+    TEST_CHECK(E_OK == ADC_Init(&l_adc));
+    TEST_CHECK(E_OK == ADC_StartConversion_Interrupt(&l_adc, ADC_CHANNEL_AN0));
+    TEST_CHECK(ADC_20_TAD == ADCON2bits.ACQT);
+    TEST_CHECK(E_OK == ADC_StartConversion_Interrupt(&l_adc, ADC_CHANNEL_AN0));
+    TEST_CHECK(ADC_0_TAD == ADCON2bits.ACQT);
+    TEST_CHECK(E_OK == ADC_StartConversion_Interrupt(&l_adc, ADC_CHANNEL_AN1));
+    TEST_CHECK((ADC_20_TAD == ADCON2bits.ACQT) && (ADC_CHANNEL_AN1 == ADCON0bits.CHS));
+    /* A channel change through the plain API gets the acquisition back */
+    TEST_CHECK(E_OK == ADC_StartConversion_Interrupt(&l_adc, ADC_CHANNEL_AN1));
+    TEST_CHECK(E_OK == ADC_SelectChannel(&l_adc, ADC_CHANNEL_AN2));
+    TEST_CHECK(ADC_20_TAD == ADCON2bits.ACQT);
+    ADCON0bits.GODONE = 0U;
+
+    return TEST_RESULT("test_adc_burst_model");
+}
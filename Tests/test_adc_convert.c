@@ -0,0 +1,143 @@
+/*
+ * File:   test_adc_convert.c
+ * Author: Abdelrahman Aref
+ *
+ * Checks the 32-bit integer conversions against a double precision reference over
+ * every conversion result : linear gains (Q16) and a thermistor calibration table.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <math.h>
+#include "test_common.h"
+#include "../MCAL_Layer/ADC/hal_adc_convert.h"
+
+/* NTC divider, 0.1 Celsius per unit, raw increasing with the temperature */
+static const adc_convert_point_t ntc_table[] =
+{
+    {  58U, -400}, { 120U, -200}, { 228U,    0}, { 383U,  200},
+    { 562U,  400}, { 726U,  600}, { 847U,  800}, { 926U, 1000},
+    { 972U, 1250}
+};
+
+/* Largest |integer - reference| over raw 0 .. raw_max */
+static double Linear_Max_Error(sint32 offset, double units_per_count, sint32 gain, uint16 raw_max)
+{
+    adc_convert_t l_convert = {0};
+    sint32 l_value = 0;
+    double l_error = 0.0;
+    double l_max_error = 0.0;
+    uint16 l_raw = 0U;
+
+    l_convert.convert_type = ADC_CONVERT_LINEAR;
+    l_convert.offset = offset;
+    l_convert.gain = gain;
+    for(l_raw = 0U; l_raw <= raw_max; l_raw++)
+    {
+        TEST_CHECK(E_OK == ADC_Convert(&l_convert, l_raw, &l_value));
+        l_error = fabs((double)l_value - ((double)offset + ((double)l_raw * units_per_count)));
+        l_max_error = (l_error > l_max_error) ? l_error : l_max_error;
+    }
+    return l_max_error;
+}
+
+static double Table_Reference(adc_result_t raw)
+{
+    uint8 l_index = 1U;
+    double l_value = 0.0;
+    uint8 l_last = (uint8)((sizeof(ntc_table) / sizeof(ntc_table[0])) - 1U);
+
+    if(raw <= ntc_table[0].raw)
+    {
+        l_value = ntc_table[0].value;
+    }
+    else if(raw >= ntc_table[l_last].raw)
+    {
+        l_value = ntc_table[l_last].value;
+    }
+    else
+    {
+        while(raw >= ntc_table[l_index].raw)
+        {
+            l_index++;
+        }
+        l_value = ntc_table[l_index - 1U].value +
+                  ((double)(ntc_table[l_index].value - ntc_table[l_index - 1U].value) *
+                   (double)(raw - ntc_table[l_index - 1U].raw) /
+                   (double)(ntc_table[l_index].raw - ntc_table[l_index - 1U].raw));
+    }
+    return l_value;
+}
+
+int main(void)
+{
+    adc_convert_t l_convert = {0};
+    sint32 l_value = 0;
+    double l_error = 0.0;
+    double l_max_error = 0.0;
+    uint16 l_raw = 0U;
+
+    /* Millivolts of a 10-bit result : rounding to nearest plus the Q16 gain quantization */
+    l_error = Linear_Max_Error(0, 5000.0 / 1024.0, ADC_CONVERT_MV_GAIN, 1023U);
+    printf("linear mV          : max error %.3f units\n", l_error);
+    TEST_CHECK(l_error <= 0.51);
+
+    /* 13-bit oversampled results, full scale 5000 mV over 8192 counts */
+    l_error = Linear_Max_Error(0, 5000.0 / 8192.0, ADC_CONVERT_GAIN_Q(5000UL, 8192UL), ADC_RESULT_MAX_VALUE);
+    printf("linear mV 13-bit   : max error %.3f units\n", l_error);
+    TEST_CHECK(l_error <= 0.51);
+
+    /* Negative slope with an offset, 0.1 Celsius : 1500 at raw 0, -3.5 per count */
+    l_error = Linear_Max_Error(1500, -3.5, -ADC_CONVERT_GAIN_Q(7UL, 2UL), 1023U);
+    printf("linear negative    : max error %.3f units\n", l_error);
+    TEST_CHECK(l_error <= 0.51);
+
+    /* Largest output the 32-bit product allows, 32767 units full scale */
+    l_error = Linear_Max_Error(0, 32767.0 / 1024.0, ADC_CONVERT_GAIN_Q(32767UL, 1024UL), 1023U);
+    printf("linear full range  : max error %.3f units\n", l_error);
+    TEST_CHECK(l_error <= 0.51);
+
+    /* Table : the integer division truncates, less than one unit from the interpolation */
+    l_convert.convert_type = ADC_CONVERT_TABLE;
+    l_convert.table = ntc_table;
+    l_convert.table_size = (uint8)(sizeof(ntc_table) / sizeof(ntc_table[0]));
+    for(l_raw = 0U; l_raw <= 1023U; l_raw++)
+    {
+        TEST_CHECK(E_OK == ADC_Convert(&l_convert, l_raw, &l_value));
+        l_error = fabs((double)l_value - Table_Reference(l_raw));
+        l_max_error = (l_error > l_max_error) ? l_error : l_max_error;
+    }
+    printf("table              : max error %.3f units\n", l_max_error);
+    TEST_CHECK(l_max_error < 1.0);
+
+    /* Attached to a channel */
+    TEST_CHECK(E_NOT_OK == ADC_Convert_Channel(ADC_CHANNEL_AN3, 100U, &l_value));
+    TEST_CHECK(E_OK == ADC_Convert_Attach(ADC_CHANNEL_AN3, &l_convert));
+    TEST_CHECK(E_OK == ADC_Convert_Channel(ADC_CHANNEL_AN3, 228U, &l_value));
+    TEST_CHECK(0 == l_value);
+    TEST_CHECK(E_OK == ADC_Convert_Channel(ADC_CHANNEL_AN3, 1023U, &l_value));
+    TEST_CHECK(1250 == l_value);
+
+    /* Segments whose interpolation product doesn't fit 32 bits are rejected, and flat raw steps */
+    {
+        static const adc_convert_point_t l_widest[] = {{0U, 0L}, {1023U, 2099200L}, {1024U, -2000000000L}};
+        static const adc_convert_point_t l_too_wide[] = {{0U, 0L}, {1023U, 2099300L}};
+        static const adc_convert_point_t l_full_range[] = {{0U, -2000000000L}, {2U, 2000000000L}};
+        static const adc_convert_point_t l_flat[] = {{0U, 0L}, {100U, 10L}, {100U, 20L}};
+        adc_convert_t l_check = {ADC_CONVERT_TABLE, 0, 0, l_widest, 3U};
+        TEST_CHECK(E_OK == ADC_Convert_Attach(ADC_CHANNEL_AN4, &l_check));
+        TEST_CHECK(E_OK == ADC_Convert_Channel(ADC_CHANNEL_AN4, 1022U, &l_value));
+        TEST_CHECK(2097147L == l_value);
+        l_check.table = l_too_wide;
+        l_check.table_size = 2U;
+        TEST_CHECK(E_NOT_OK == ADC_Convert_Attach(ADC_CHANNEL_AN4, &l_check));
+        l_check.table = l_full_range;
+        TEST_CHECK(E_NOT_OK == ADC_Convert_Attach(ADC_CHANNEL_AN4, &l_check));
+        l_check.table = l_flat;
+        l_check.table_size = 3U;
+        TEST_CHECK(E_NOT_OK == ADC_Convert_Attach(ADC_CHANNEL_AN4, &l_check));
+        TEST_CHECK(E_OK == ADC_Convert_Attach(ADC_CHANNEL_AN4, NULL));
+    }
+
+    return TEST_RESULT("test_adc_convert");
+}
@@ -0,0 +1,77 @@
+/*
+ * File:   test_adc_filter.c
+ * Author: Abdelrahman Aref
+ *
+ * Runs the filters on full scale oversampled (13-bit) results, the range the scan
+ * sequencer feeds them with ADC_OVERSAMPLING_X64.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/ADC/hal_adc_filter.h"
+
+static adc_result_t Run(adc_filter_type_t type, uint8 parameter, adc_result_t first, adc_result_t next, uint16 count)
+{
+    adc_filter_t l_filter = {0};
+    adc_result_t l_value = 0U;
+    uint16 l_index = 0U;
+
+    l_filter.filter_type = type;
+    l_filter.ma_length = parameter;
+    l_filter.iir_shift = parameter;
+    TEST_CHECK(E_OK == ADC_Filter_Init(&l_filter));
+    TEST_CHECK(E_OK == ADC_Filter_Update(&l_filter, first));
+    for(l_index = 0U; l_index < count; l_index++)
+    {
+        TEST_CHECK(E_OK == ADC_Filter_Update(&l_filter, next));
+    }
+    TEST_CHECK(E_OK == ADC_Filter_Read(&l_filter, &l_value));
+    return l_value;
+}
+
+int main(void)
+{
+    adc_result_t l_value = 0U;
+
+    /* Steady full scale : the running sum and the IIR state hold 13-bit results without wrapping */
+    l_value = Run(ADC_FILTER_MOVING_AVERAGE, ADC_FILTER_MA_MAX_LENGTH, ADC_RESULT_MAX_VALUE, ADC_RESULT_MAX_VALUE, 100U);
+    TEST_CHECK(ADC_RESULT_MAX_VALUE == l_value);
+    l_value = Run(ADC_FILTER_IIR, 8U, ADC_RESULT_MAX_VALUE, ADC_RESULT_MAX_VALUE, 100U);
+    TEST_CHECK(ADC_RESULT_MAX_VALUE == l_value);
+
+    /* Steps between 0 and full scale settle on the new value */
+    l_value = Run(ADC_FILTER_MOVING_AVERAGE, ADC_FILTER_MA_MAX_LENGTH, 0U, ADC_RESULT_MAX_VALUE, ADC_FILTER_MA_MAX_LENGTH);
+    TEST_CHECK(ADC_RESULT_MAX_VALUE == l_value);
+    l_value = Run(ADC_FILTER_MOVING_AVERAGE, 4U, ADC_RESULT_MAX_VALUE, 1000U, 2U);
+    TEST_CHECK(((2U * ADC_RESULT_MAX_VALUE) + (2U * 1000U)) / 4U == l_value);
+    l_value = Run(ADC_FILTER_IIR, 4U, 0U, ADC_RESULT_MAX_VALUE, 400U);
+    TEST_CHECK(ADC_RESULT_MAX_VALUE == l_value);
+    l_value = Run(ADC_FILTER_IIR, 1U, ADC_RESULT_MAX_VALUE, 0U, 1U);
+    TEST_CHECK((ADC_RESULT_MAX_VALUE / 2U) == l_value);
+    /* The truncated step stalls once the error is below 2^iir_shift state units */
+    l_value = Run(ADC_FILTER_IIR, 8U, ADC_RESULT_MAX_VALUE, 0U, 4000U);
+    TEST_CHECK(l_value <= (1U << (8U - ADC_FILTER_IIR_FRACTION_BITS)));
+
+    /* Boxcar lengths are powers of 2, the average is a shift */
+    {
+        adc_filter_t l_filter = {0};
+        l_filter.filter_type = ADC_FILTER_MOVING_AVERAGE;
+        l_filter.ma_length = 10U;
+        TEST_CHECK(E_NOT_OK == ADC_Filter_Init(&l_filter));
+        l_filter.ma_length = 0U;
+        TEST_CHECK(E_NOT_OK == ADC_Filter_Init(&l_filter));
+        l_filter.ma_length = 2U * ADC_FILTER_MA_MAX_LENGTH;
+        TEST_CHECK(E_NOT_OK == ADC_Filter_Init(&l_filter));
+    }
+    l_value = Run(ADC_FILTER_MOVING_AVERAGE, 1U, 100U, 1234U, 1U);
+    TEST_CHECK(1234U == l_value);
+    l_value = Run(ADC_FILTER_MOVING_AVERAGE, 8U, 0U, 1001U, 3U);
+    TEST_CHECK(((3U * 1001U) / 8U) == l_value);
+
+    /* Medians are sample selections, only checked for the range */
+    l_value = Run(ADC_FILTER_MEDIAN_5, 0U, ADC_RESULT_MAX_VALUE, ADC_RESULT_MAX_VALUE, 4U);
+    TEST_CHECK(ADC_RESULT_MAX_VALUE == l_value);
+
+    return TEST_RESULT("test_adc_filter");
+}
@@ -0,0 +1,152 @@
+/*
+ * File:   test_adc_oversampling.c
+ * Author: Abdelrahman Aref
+ *
+ * Feeds a noisy synthetic input to the scan sequencer through ADC_ISR() and checks the
+ * resolution gain of the oversampled channel against a plain channel on the same input.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <math.h>
+#include "test_common.h"
+#include "../MCAL_Layer/ADC/hal_adc.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+#define FRAMES_PER_LEVEL                  32U
+#define LEVEL_STEPS                       8U
+
+/* Input in 10-bit LSBs and rms noise added before the quantizer */
+static double input_lsb = 0.0;
+static double noise_rms_lsb = 0.0;
+static uint32 noise_seed = 12345UL;
+static uint8 frame_complete = 0U;
+
+static const adc_channel_select_t scan_channels[2] = {ADC_CHANNEL_AN0, ADC_CHANNEL_AN1};
+static const adc_oversampling_t scan_ratios[2] = {ADC_OVERSAMPLING_X64, ADC_OVERSAMPLING_NONE};
+
+/* Uniform in [-0.5, 0.5) */
+static double Noise_Uniform(void)
+{
+    noise_seed = (noise_seed * 1103515245UL) + 12345UL;
+    return ((double)((noise_seed >> 8) & 0xFFFFUL) / 65536.0) - 0.5;
+}
+
+/* Sum of 12 uniforms, close to a unit gaussian */
+static double Noise_Gaussian(void)
+{
+    double l_sum = 0.0;
+    uint8 l_index = 0U;
+
+    for(l_index = 0U; l_index < 12U; l_index++)
+    {
+        l_sum += Noise_Uniform();
+    }
+    return l_sum;
+}
+
+/* One 10-bit conversion of the input, right justified in ADRESH:ADRESL */
+static void Convert(void)
+{
+    long l_code = lround(input_lsb + (noise_rms_lsb * Noise_Gaussian()));
+
+    l_code = (l_code < 0L) ? 0L : ((l_code > 1023L) ? 1023L : l_code);
+    ADRESH = (uint8)(l_code >> 8);
+    ADRESL = (uint8)l_code;
+}
+
+static void Frame_Complete(void)
+{
+    frame_complete = 1U;
+}
+
+/* Runs the ADC interrupt until the next frame is published */
+static void Next_Frame(const adc_conf_t *_adc, adc_result_t *results)
+{
+    frame_complete = 0U;
+    while(0U == frame_complete)
+    {
+        Convert();
+        ADC_ISR();
+    }
+    (void)ADC_Scan_Read_Frame(_adc, results, NULL);
+}
+
+/* rms error in 10-bit LSBs of single frames, oversampled (13-bit) and plain channel */
+static void Sweep(const adc_conf_t *_adc, double *error_x64, double *error_plain, uint8 *monotonic)
+{
+    adc_result_t l_results[2];
+    double l_sum_x64 = 0.0;
+    double l_sum_plain = 0.0;
+    double l_mean = 0.0;
+    double l_last_mean = -1.0;
+    uint8 l_step = 0U;
+    uint8 l_frame = 0U;
+    uint32 l_count = 0UL;
+
+    *monotonic = 1U;
+    for(l_step = 0U; l_step <= LEVEL_STEPS; l_step++)
+    {
+        /* 1/8 LSB steps over one 10-bit code */
+        input_lsb = 600.0 + ((double)l_step / LEVEL_STEPS);
+        l_mean = 0.0;
+        for(l_frame = 0U; l_frame < FRAMES_PER_LEVEL; l_frame++)
+        {
+            Next_Frame(_adc, l_results);
+            l_sum_x64 += pow(((double)l_results[0] / 8.0) - input_lsb, 2);
+            l_sum_plain += pow((double)l_results[1] - input_lsb, 2);
+            l_mean += (double)l_results[0] / FRAMES_PER_LEVEL;
+            l_count++;
+        }
+        if(l_mean <= l_last_mean)
+        {
+            *monotonic = 0U;
+        }
+        else { /* Nothing */ }
+        l_last_mean = l_mean;
+    }
+    *error_x64 = sqrt(l_sum_x64 / l_count);
+    *error_plain = sqrt(l_sum_plain / l_count);
+}
+
+int main(void)
+{
+    adc_conf_t l_adc = {0};
+    adc_scan_cfg_t l_scan = {0};
+    adc_result_t l_results[2];
+    double l_error_x64 = 0.0;
+    double l_error_plain = 0.0;
+    uint8 l_monotonic = 0U;
+
+    l_adc.adc_channel = ADC_CHANNEL_AN0;
+    l_adc.result_format = ADC_RESULT_RIGHT;
+    l_adc.manual_timing = ADC_TIMING_AUTO;
+    TEST_CHECK(E_OK == ADC_Init(&l_adc));
+
+    l_scan.ADC_ScanCompleteHandler = Frame_Complete;
+    l_scan.channels = scan_channels;
+    l_scan.oversampling = scan_ratios;
+    l_scan.channel_count = 2U;
+    l_scan.scan_mode = ADC_SCAN_CONTINUOUS;
+    TEST_CHECK(E_OK == ADC_Scan_Start(&l_adc, &l_scan));
+
+    /* 0.6 LSB rms of noise dithers the quantizer, 64 samples : 1/8 LSB steps are resolved */
+    noise_rms_lsb = 0.6;
+    Sweep(&l_adc, &l_error_x64, &l_error_plain, &l_monotonic);
+    printf("noisy input : rms error x64 %.3f LSB, plain %.3f LSB, gain %.2f bits\n",
+           l_error_x64, l_error_plain, log2(l_error_plain / l_error_x64));
+    TEST_CHECK(1U == l_monotonic);
+    TEST_CHECK(l_error_x64 < 0.15);
+    TEST_CHECK((l_error_plain / l_error_x64) > 4.0);
+
+    /* A steady input keeps its 10-bit steps, the extra bits stay at the quantizer level */
+    noise_rms_lsb = 0.0;
+    input_lsb = 600.3;
+    Next_Frame(&l_adc, l_results);
+    TEST_CHECK((600U * 8U) == l_results[0]);
+    TEST_CHECK(600U == l_results[1]);
+
+    TEST_CHECK(E_OK == ADC_Scan_Stop(&l_adc));
+
+    return TEST_RESULT("test_adc_oversampling");
+}
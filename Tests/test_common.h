@@ -0,0 +1,41 @@
+/*
+ * File:   test_common.h
+ * Author: Abdelrahman Aref
+ *
+ * Minimal checks shared by the host tests, each test is a plain executable
+ * returning the number of failed checks.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#ifndef TEST_COMMON_H
+#define	TEST_COMMON_H
+
+/* Section : Includes */
+#include <stdio.h>
+
+/* Section: Macro Declarations */
+
+/* Section: Macro Functions Declarations */
+
+#define TEST_CHECK(_COND_) \
+            do { \
+                if(!(_COND_)) \
+                { \
+                    test_failures++; \
+                    printf("%s:%d: check failed : %s\n", __FILE__, __LINE__, #_COND_); \
+                } \
+                else { /* Nothing */ } \
+            } while(0)
+
+#define TEST_RESULT(_NAME_) \
+            (printf("%s : %s (%u failed)\n", (_NAME_), (0U == test_failures) ? "PASS" : "FAIL", test_failures), \
+             (int)test_failures)
+
+/* Section: Data Type Declarations */
+
+static unsigned int test_failures = 0U;
+
+/* Section: Function Declarations */
+
+#endif	/* TEST_COMMON_H */
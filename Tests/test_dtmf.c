@@ -0,0 +1,142 @@
+/*
+ * File:   test_dtmf.c
+ * Author: Abdelrahman Aref
+ *
+ * Feeds DTMF_Sample_Event() with synthesized 10-bit samples at DTMF_CFG_SAMPLE_RATE and runs
+ * DTMF_Process() like the main loop : the 16 digits, invalid tone pairs, and the tone mode with
+ * a user table, then back to the digits. A block left waiting is dropped.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <math.h>
+#include "test_common.h"
+#include "../ECU_Layer/DTMF/ecu_dtmf.h"
+
+#define PI                                3.14159265358979
+
+static const double row_tones[4] = {697.0, 770.0, 852.0, 941.0};
+static const double column_tones[4] = {1209.0, 1336.0, 1477.0, 1633.0};
+static const uint8 digits[16] = {'1', '2', '3', 'A', '4', '5', '6', 'B', '7', '8', '9', 'C', '*', '0', '#', 'D'};
+
+static const sint16 user_tones[3] = {DTMF_GOERTZEL_COEFF(440), DTMF_GOERTZEL_COEFF(1000), DTMF_GOERTZEL_COEFF(2000)};
+
+static uint32 noise_seed = 7UL;
+static uint32 sample_index = 0UL;
+
+/* +-2 counts of 10-bit noise */
+static double Noise(void)
+{
+    noise_seed = (noise_seed * 1103515245UL) + 12345UL;
+    return (((double)((noise_seed >> 8) & 0xFFFFUL) / 65536.0) - 0.5) * 4.0;
+}
+
+/* Amplitudes in 10-bit counts around mid-scale, phases run on across the calls */
+static void Feed(uint32 samples, double freq_a, double amplitude_a, double freq_b, double amplitude_b)
+{
+    uint32 l_count = 0UL;
+    double l_t = 0.0;
+
+    for(l_count = 0UL; l_count < samples; l_count++)
+    {
+        l_t = (double)sample_index / (double)DTMF_CFG_SAMPLE_RATE;
+        (void)DTMF_Sample_Event((adc_result_t)lround(512.0 + (amplitude_a * sin(2.0 * PI * freq_a * l_t)) +
+                                                     (amplitude_b * sin(2.0 * PI * freq_b * l_t)) + Noise()));
+        (void)DTMF_Process();
+        sample_index++;
+    }
+}
+
+static uint8 Count_Events(dtmf_event_type_t type, uint8 value, uint8 *_others)
+{
+    dtmf_event_t l_event;
+    uint8 l_count = 0U;
+
+    while(E_OK == DTMF_Read_Event(&l_event))
+    {
+        if((l_event.type == type) && (l_event.value == value))
+        {
+            l_count++;
+        }
+        else
+        {
+            (*_others)++;
+        }
+    }
+    return l_count;
+}
+
+/* 4 blocks of the digit then 2 blocks of silence : exactly one event */
+static void Check_Digit(uint8 row, uint8 column, double row_amplitude, double column_amplitude, uint8 expected)
+{
+    uint8 l_others = 0U;
+    uint8 l_count = 0U;
+
+    Feed(4UL * DTMF_CFG_BLOCK_SIZE, row_tones[row], row_amplitude, column_tones[column], column_amplitude);
+    Feed(2UL * DTMF_CFG_BLOCK_SIZE, 0.0, 0.0, 0.0, 0.0);
+    l_count = Count_Events(DTMF_EVENT_DIGIT, digits[(row * 4U) + column], &l_others);
+    if((expected != l_count) || (0U != l_others))
+    {
+        printf("digit %c : %u events, %u others, expected %u\n", digits[(row * 4U) + column], l_count, l_others, expected);
+    }
+    else { /* Nothing */ }
+    TEST_CHECK(expected == l_count);
+    TEST_CHECK(0U == l_others);
+}
+
+int main(void)
+{
+    uint8 l_row = 0U;
+    uint8 l_column = 0U;
+    uint8 l_others = 0U;
+    uint32 l_index = 0UL;
+
+    TEST_CHECK(E_OK == DTMF_Reset());
+
+    /* The 16 digits, 1/4 full scale per tone */
+    for(l_row = 0U; l_row < 4U; l_row++)
+    {
+        for(l_column = 0U; l_column < 4U; l_column++)
+        {
+            Check_Digit(l_row, l_column, 128.0, 128.0, 1U);
+        }
+    }
+
+    /* 6 dB twist is accepted, 12 dB isn't */
+    Check_Digit(1U, 2U, 64.0, 128.0, 1U);
+    Check_Digit(1U, 2U, 256.0, 64.0, 0U);
+
+    /* A single tone, and a tone too weak to pass the noise */
+    Check_Digit(2U, 1U, 200.0, 0.0, 0U);
+    Check_Digit(2U, 1U, 4.0, 4.0, 0U);
+
+    /* Tone mode : on and off events of the user table */
+    TEST_CHECK(E_NOT_OK == DTMF_Set_Tones(user_tones, 0U));
+    TEST_CHECK(E_NOT_OK == DTMF_Set_Tones(user_tones, DTMF_MAX_TONES + 1U));
+    TEST_CHECK(E_OK == DTMF_Set_Tones(user_tones, 3U));
+    Feed(2UL * DTMF_CFG_BLOCK_SIZE, 1000.0, 200.0, 0.0, 0.0);
+    TEST_CHECK(1U == Count_Events(DTMF_EVENT_TONE_ON, 1U, &l_others));
+    Feed(2UL * DTMF_CFG_BLOCK_SIZE, 440.0, 150.0, 2000.0, 150.0);
+    TEST_CHECK(1U == Count_Events(DTMF_EVENT_TONE_OFF, 1U, &l_others));
+    TEST_CHECK(2U == l_others);
+    l_others = 0U;
+    Feed(2UL * DTMF_CFG_BLOCK_SIZE, 0.0, 0.0, 0.0, 0.0);
+    TEST_CHECK(0U == Count_Events(DTMF_EVENT_TONE_ON, 0U, &l_others));
+    TEST_CHECK(2U == l_others);
+
+    /* Back to the 8 digit tones after a 3 tone table */
+    TEST_CHECK(E_OK == DTMF_Set_Tones(NULL, 0U));
+    Check_Digit(3U, 3U, 128.0, 128.0, 1U);
+    Check_Digit(0U, 0U, 128.0, 128.0, 1U);
+
+    /* Nothing processed during 3 blocks : the first one waits, the others are dropped */
+    TEST_CHECK(E_NOT_OK == DTMF_Process());
+    for(l_index = 0U; l_index < (3UL * DTMF_CFG_BLOCK_SIZE); l_index++)
+    {
+        (void)DTMF_Sample_Event(512U);
+    }
+    TEST_CHECK(E_OK == DTMF_Process());
+    TEST_CHECK(E_NOT_OK == DTMF_Process());
+
+    return TEST_RESULT("test_dtmf");
+}
@@ -0,0 +1,210 @@
+/*
+ * File:   test_ir_receiver.c
+ * Author: Abdelrahman Aref
+ *
+ * Replays edge timestamp traces through IR_Receiver_Edge_Event() :
+ * a recorded NEC frame (jittered, wraps the 16-bit time base), the NEC repeat code,
+ * RC5 frames with the toggle bit, and half received frames dropped by the gap timeout.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../ECU_Layer/IR_Receiver/ecu_ir_receiver.h"
+
+/* Pin levels of the active low receiver */
+#define MARK                              0U
+#define SPACE                             1U
+
+/* NEC address 0x00, command 0x45, captured at 1 tick = 1 us, the first edge starts the leader mark */
+static const uint16 nec_recorded_trace[] =
+{
+    0x3A10U, 0x5D25U, 0x6E90U, 0x70B8U, 0x7301U, 0x74FDU, 0x76FCU, 0x795BU,
+    0x7B95U, 0x7D97U, 0x7FBBU, 0x81FBU, 0x83F8U, 0x8662U, 0x8898U, 0x8AA9U,
+    0x8CA3U, 0x8EA4U, 0x90D1U, 0x92FCU, 0x995FU, 0x9B73U, 0xA1D9U, 0xA415U,
+    0xAAA6U, 0xACA3U, 0xB367U, 0xB5A5U, 0xBC0FU, 0xBE21U, 0xC4CCU, 0xC712U,
+    0xCDB7U, 0xCFB4U, 0xD658U, 0xD898U, 0xDF25U, 0xE121U, 0xE333U, 0xE52EU,
+    0xEBD0U, 0xEE33U, 0xF03AU, 0xF255U, 0xF480U, 0xF688U, 0xF8C3U, 0xFAC8U,
+    0x016CU, 0x0389U, 0x05C6U, 0x0824U, 0x0A71U, 0x0C7EU, 0x12E6U, 0x1526U,
+    0x1765U, 0x19ACU, 0x201FU, 0x2244U, 0x28ABU, 0x2AE7U, 0x319DU, 0x339BU,
+    0x35D9U, 0x37D6U, 0x3E80U, 0x4090U
+};
+
+/* Time of the last replayed edge and level of the line after it */
+static uint16 trace_time = 0U;
+static uint8 trace_level = SPACE;
+
+static void Trace_Start(uint16 time)
+{
+    trace_time = time;
+    trace_level = SPACE;
+}
+
+/* The line switches to level, duration_us after the previous edge */
+static void Trace_Edge(uint16 duration_us, uint8 level)
+{
+    trace_time = (uint16)(trace_time + duration_us);
+    trace_level = level;
+    IR_Receiver_Edge_Event(trace_time, level);
+}
+
+static void Trace_NEC_Frame(uint8 address, uint8 command, uint16 count_bits)
+{
+    uint32 l_data = (uint32)address | ((uint32)(uint8)~address << 8) |
+                    ((uint32)command << 16) | ((uint32)(uint8)~command << 24);
+    uint16 l_bit = 0U;
+
+    Trace_Edge(2000U, MARK);
+    Trace_Edge(9000U, SPACE);
+    Trace_Edge(4500U, MARK);
+    for(l_bit = 0U; l_bit < count_bits; l_bit++)
+    {
+        Trace_Edge(562U, SPACE);
+        Trace_Edge(((l_data >> l_bit) & 1UL) ? 1687U : 562U, MARK);
+    }
+    if(32U == count_bits)
+    {
+        /* Stop bit */
+        Trace_Edge(562U, SPACE);
+    }
+    else { /* Nothing */ }
+}
+
+/* RC5 : S1, S2 (inverted command bit 6), toggle, 5 address bits, 6 command bits, 889 us half bits */
+static void Trace_RC5_Frame(uint8 toggle, uint8 address, uint8 command)
+{
+    uint16 l_frame = (uint16)(0x2000U | ((command & 0x40U) ? 0U : 0x1000U) | ((uint16)(toggle & 1U) << 11) |
+                              ((uint16)(address & 0x1FU) << 6) | (command & 0x3FU));
+    uint8 l_halves[28];
+    uint8 l_index = 0U;
+    uint16 l_run = 889U;
+
+    for(l_index = 0U; l_index < 14U; l_index++)
+    {
+        /* A 1 is a space to mark transition in the middle of the bit */
+        uint8 l_one = (uint8)((l_frame >> (13U - l_index)) & 1U);
+        l_halves[2U * l_index] = l_one ? SPACE : MARK;
+        l_halves[(2U * l_index) + 1U] = l_one ? MARK : SPACE;
+    }
+
+    /* The first half of S1 is the idle line */
+    Trace_Edge(3000U, MARK);
+    for(l_index = 2U; l_index < 28U; l_index++)
+    {
+        if(l_halves[l_index] == l_halves[l_index - 1U])
+        {
+            l_run += 889U;
+        }
+        else
+        {
+            Trace_Edge(l_run, l_halves[l_index]);
+            l_run = 889U;
+        }
+    }
+    if(MARK == trace_level)
+    {
+        Trace_Edge(l_run, SPACE);
+    }
+    else { /* Nothing */ }
+}
+
+static void Test_Recorded_NEC(void)
+{
+    ir_command_t l_command;
+    uint8 l_index = 0U;
+    Std_ReturnType l_ret = E_OK;
+
+    IR_Receiver_Reset();
+    for(l_index = 0U; l_index < (sizeof(nec_recorded_trace) / sizeof(nec_recorded_trace[0])); l_index++)
+    {
+        l_ret |= IR_Receiver_Edge_Event(nec_recorded_trace[l_index], (l_index & 1U) ? SPACE : MARK);
+        if(0xFAC8U == nec_recorded_trace[l_index])
+        {
+            /* The time base wraps once before the next edge */
+            IR_Receiver_Timer_Overflow();
+        }
+        else { /* Nothing */ }
+    }
+    TEST_CHECK(E_OK == l_ret);
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK(IR_PROTOCOL_NEC == l_command.protocol);
+    TEST_CHECK(0x00U == l_command.address);
+    TEST_CHECK(0x45U == l_command.command);
+    TEST_CHECK(0U == l_command.repeat);
+
+    /* Repeat code 108 ms after the frame start : leader mark, 2.25 ms space, stop mark */
+    Trace_Start(0x4090U);
+    IR_Receiver_Timer_Overflow();
+    Trace_Edge(40000U, MARK);
+    Trace_Edge(9000U, SPACE);
+    Trace_Edge(2250U, MARK);
+    Trace_Edge(562U, SPACE);
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK((0x45U == l_command.command) && (1U == l_command.repeat));
+    TEST_CHECK(E_NOT_OK == IR_Receiver_Read(&l_command));
+}
+
+static void Test_RC5(void)
+{
+    ir_command_t l_command;
+
+    IR_Receiver_Reset();
+    Trace_Start(0xFC00U);
+    Trace_RC5_Frame(0U, 0x05U, 0x35U);
+    Trace_RC5_Frame(0U, 0x05U, 0x35U);
+    Trace_RC5_Frame(1U, 0x1FU, 0x41U);
+
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK((IR_PROTOCOL_RC5 == l_command.protocol) && (0x05U == l_command.address) && (0x35U == l_command.command));
+    TEST_CHECK(0U == l_command.repeat);
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK((0x35U == l_command.command) && (1U == l_command.repeat));
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK((0x1FU == l_command.address) && (0x41U == l_command.command) && (0U == l_command.repeat));
+    TEST_CHECK(E_NOT_OK == IR_Receiver_Read(&l_command));
+}
+
+static void Test_Gap_Timeout(void)
+{
+    ir_command_t l_command;
+    uint16 l_stale_time = 0U;
+
+    /* A frame cut after 31 bits, the mark of the last bit has started */
+    IR_Receiver_Reset();
+    Trace_Start(0x1000U);
+    Trace_NEC_Frame(0x10U, 0x20U, 31U);
+    l_stale_time = trace_time;
+
+    /* Two wraps later the edges alias to a bit mark end and a one space */
+    IR_Receiver_Timer_Overflow();
+    IR_Receiver_Timer_Overflow();
+    IR_Receiver_Edge_Event((uint16)(l_stale_time + 562U), SPACE);
+    IR_Receiver_Edge_Event((uint16)(l_stale_time + 562U + 1687U), MARK);
+    TEST_CHECK(E_NOT_OK == IR_Receiver_Read(&l_command));
+
+    /* Single wrap with the next edge at a later timer value : still more than 65536 ticks */
+    IR_Receiver_Reset();
+    Trace_Start(0x2000U);
+    Trace_NEC_Frame(0x10U, 0x20U, 31U);
+    l_stale_time = trace_time;
+    IR_Receiver_Timer_Overflow();
+    IR_Receiver_Edge_Event((uint16)(l_stale_time + 562U), SPACE);
+    IR_Receiver_Edge_Event((uint16)(l_stale_time + 562U + 1687U), MARK);
+    TEST_CHECK(E_NOT_OK == IR_Receiver_Read(&l_command));
+
+    /* The decoder is idle again and takes the next full frame */
+    Trace_Start((uint16)(l_stale_time + 562U + 1687U));
+    Trace_NEC_Frame(0x10U, 0x20U, 32U);
+    TEST_CHECK(E_OK == IR_Receiver_Read(&l_command));
+    TEST_CHECK((0x10U == l_command.address) && (0x20U == l_command.command) && (0U == l_command.repeat));
+    TEST_CHECK(E_NOT_OK == IR_Receiver_Read(&l_command));
+}
+
+int main(void)
+{
+    Test_Recorded_NEC();
+    Test_RC5();
+    Test_Gap_Timeout();
+
+    return TEST_RESULT("test_ir_receiver");
+}
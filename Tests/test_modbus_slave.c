@@ -0,0 +1,369 @@
+/*
+ * File:   test_modbus_slave.c
+ * Author: Abdelrahman Aref
+ *
+ * Drives request frames through Modbus_Slave_Rx_Byte() / Modbus_Slave_Frame_End() and checks
+ * the responses captured from TXREG : RAM, EEPROM, GPIO and ADC register blocks, the
+ * exceptions, CRC and address filtering, broadcasts and the EEPROM write queue. The EEPROM
+ * (a write ends two polls after it starts) and the ADC filters are stubbed here, the CRC is
+ * checked against a bitwise one.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../ECU_Layer/Modbus_Slave/ecu_modbus_slave.h"
+
+#define SLAVE_ADDRESS                     17U
+#define WIRE_CAPACITY                     512U
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+
+static uint8 eeprom[256];
+static uint16 eeprom_writes = 0U;
+/* Write in progress : polls left before it ends, its address and data */
+static uint8 eeprom_write_polls = 0U;
+static uint16 eeprom_write_address = 0U;
+static uint8 eeprom_write_data = 0U;
+/* EEPROM accesses while a write runs, EEADR / EEDATA would be corrupted */
+static uint16 eeprom_conflicts = 0U;
+
+static uint16 holding[10];
+static uint16 inputs[2];
+static uint16 large[100];
+static adc_filter_t filters[2];
+static const pin_config_t pins[2] = {
+    {.PORT = PORTC_INDEX, .PIN = PIN0, .DIRECTION = GPIO_DIRECTION_OUTPUT, .LOGIC = GPIO_LOW},
+    {.PORT = PORTC_INDEX, .PIN = PIN1, .DIRECTION = GPIO_DIRECTION_OUTPUT, .LOGIC = GPIO_LOW}
+};
+
+static const modbus_register_block_t blocks[6] = {
+    {MODBUS_TABLE_HOLDING, MODBUS_SOURCE_RAM,    0U,   10U,  holding, NULL, NULL,    0U},
+    {MODBUS_TABLE_HOLDING, MODBUS_SOURCE_EEPROM, 10U,  4U,   NULL,    NULL, NULL,    0x20U},
+    {MODBUS_TABLE_HOLDING, MODBUS_SOURCE_GPIO,   100U, 2U,   NULL,    pins, NULL,    0U},
+    {MODBUS_TABLE_INPUT,   MODBUS_SOURCE_ADC,    0U,   2U,   NULL,    NULL, filters, 0U},
+    {MODBUS_TABLE_INPUT,   MODBUS_SOURCE_RAM,    2U,   2U,   inputs,  NULL, NULL,    0U},
+    {MODBUS_TABLE_HOLDING, MODBUS_SOURCE_RAM,    300U, 100U, large,   NULL, NULL,    0U}
+};
+
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    return l_slot;
+}
+
+/* The write ends on the second Data_EEPROM_Write_Done() call */
+Std_ReturnType Data_EEPROM_Write_Start(uint16 bAdd, uint8 bData)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(0U != eeprom_write_polls)
+    {
+        eeprom_conflicts++;
+    }
+    else
+    {
+        eeprom_write_polls = 2U;
+        eeprom_write_address = bAdd;
+        eeprom_write_data = bData;
+        eeprom_writes++;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType Data_EEPROM_Write_Done(uint8 *bDone)
+{
+    if(0U != eeprom_write_polls)
+    {
+        eeprom_write_polls--;
+        if(0U == eeprom_write_polls)
+        {
+            eeprom[eeprom_write_address & 0xFFU] = eeprom_write_data;
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+    *bDone = (uint8)(0U == eeprom_write_polls);
+    return E_OK;
+}
+
+Std_ReturnType Data_EEPROM_ReadByte(uint16 bAdd, uint8 *bData)
+{
+    if(0U != eeprom_write_polls)
+    {
+        eeprom_conflicts++;
+    }
+    else { /* Nothing */ }
+    *bData = eeprom[bAdd & 0xFFU];
+    return E_OK;
+}
+
+Std_ReturnType ADC_Filter_Read(const adc_filter_t *_filter, adc_result_t *value)
+{
+    *value = _filter->output;
+    return E_OK;
+}
+
+/* CRC-16/MODBUS bit by bit, independent of the table in the driver */
+static uint16 Crc16(const uint8 *_data, uint16 length)
+{
+    uint16 l_crc = 0xFFFFU;
+    uint16 l_index = 0U;
+    uint8 l_bit = 0U;
+
+    for(l_index = 0U; l_index < length; l_index++)
+    {
+        l_crc ^= _data[l_index];
+        for(l_bit = 0U; l_bit < 8U; l_bit++)
+        {
+            l_crc = (l_crc & 1U) ? (uint16)((l_crc >> 1) ^ 0xA001U) : (uint16)(l_crc >> 1);
+        }
+    }
+    return l_crc;
+}
+
+/* Sends the response from the transmit interrupt, then the Timer0 end of the last stop bit */
+static void Transmit(void)
+{
+    PIR1bits.TXIF = 1;
+    while(PIE1bits.TXIE)
+    {
+        EUSART_TX_ISR();
+    }
+    TXSTAbits.TRMT = 1;
+    INTCONbits.TMR0IF = 1;
+    TMR0_ISR();
+}
+
+/* Feeds a request (CRC appended when add_crc is 1) and returns the response length */
+static uint16 Request(const uint8 *_request, uint16 length, uint8 add_crc, uint8 *_response)
+{
+    uint8 l_frame[MODBUS_CFG_MAX_FRAME + 2U];
+    uint16 l_crc = 0U;
+    uint16 l_index = 0U;
+    uint16 l_length = length;
+
+    memcpy(l_frame, _request, length);
+    if(add_crc)
+    {
+        l_crc = Crc16(l_frame, length);
+        l_frame[l_length] = (uint8)l_crc;
+        l_frame[l_length + 1U] = (uint8)(l_crc >> 8);
+        l_length += 2U;
+    }
+    else { /* Nothing */ }
+
+    wire_length = 0U;
+    for(l_index = 0U; l_index < l_length; l_index++)
+    {
+        (void)Modbus_Slave_Rx_Byte(l_frame[l_index]);
+    }
+    (void)Modbus_Slave_Frame_End();
+    Transmit();
+    for(l_index = 0U; l_index < wire_length; l_index++)
+    {
+        _response[l_index] = wire[l_index];
+    }
+    return wire_length;
+}
+
+/* The response is the expected PDU with a valid CRC */
+static uint8 Response_Is(const uint8 *_response, uint16 length, const uint8 *_expected, uint16 expected_length)
+{
+    return (uint8)((length == (expected_length + 2U)) && (0 == memcmp(_response, _expected, expected_length)) &&
+                   (0U == Crc16(_response, length)));
+}
+
+int main(void)
+{
+    modbus_slave_t l_slave;
+    modbus_statistics_t l_statistics;
+    uint8 l_response[WIRE_CAPACITY];
+    uint16 l_length = 0U;
+    uint8 l_index = 0U;
+
+    memset(&l_slave, 0, sizeof(l_slave));
+    l_slave.modbus_usart.baudrate = 9600UL;
+    l_slave.modbus_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_slave.slave_address = SLAVE_ADDRESS;
+    l_slave.blocks = blocks;
+    l_slave.block_count = 6U;
+    TEST_CHECK(E_OK == Modbus_Slave_Init(&l_slave));
+
+    for(l_index = 0U; l_index < 10U; l_index++)
+    {
+        holding[l_index] = (uint16)(0x1000U + l_index);
+    }
+    for(l_index = 0U; l_index < 100U; l_index++)
+    {
+        large[l_index] = (uint16)(l_index * 257U);
+    }
+    filters[0].output = 512U;
+    filters[1].output = 1023U;
+    inputs[0] = 0xBEEFU;
+    inputs[1] = 7U;
+    eeprom[0x20] = 0x12U;
+    eeprom[0x21] = 0x34U;
+
+    /* Function 3, then across the RAM and EEPROM blocks */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x00, 0x00, 0x03};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x03, 0x06, 0x10, 0x00, 0x10, 0x01, 0x10, 0x02};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+    }
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x08, 0x00, 0x03};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x03, 0x06, 0x10, 0x08, 0x10, 0x09, 0x12, 0x34};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+    }
+
+    /* Function 4 across the ADC and RAM input blocks */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x04, 0x00, 0x00, 0x00, 0x04};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x04, 0x08, 0x02, 0x00, 0x03, 0xFF, 0xBE, 0xEF, 0x00, 0x07};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+    }
+
+    /* Function 6 echoes the request */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x06, 0x00, 0x05, 0xAB, 0xCD};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_request, sizeof(l_request)));
+        TEST_CHECK(0xABCDU == holding[5]);
+    }
+
+    /* Function 16 to the EEPROM : queued, read back before the commit, written by Process */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x10, 0x00, 0x0A, 0x00, 0x02, 0x04, 0xCA, 0x34, 0xBA, 0xBE};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x10, 0x00, 0x0A, 0x00, 0x02};
+        const uint8 l_read[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x0A, 0x00, 0x02};
+        const uint8 l_read_expected[] = {SLAVE_ADDRESS, 0x03, 0x04, 0xCA, 0x34, 0xBA, 0xBE};
+        const uint8 l_read_busy[] = {SLAVE_ADDRESS, 0x83, MODBUS_EXCEPTION_SLAVE_BUSY};
+        const uint8 l_read_ram[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x00, 0x00, 0x01};
+        const uint8 l_read_ram_expected[] = {SLAVE_ADDRESS, 0x03, 0x02, 0x10, 0x00};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+        TEST_CHECK(0U == eeprom_writes);
+        l_length = Request(l_read, sizeof(l_read), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_read_expected, sizeof(l_read_expected)));
+
+        /* The first call starts the first byte and returns, the slave keeps answering */
+        TEST_CHECK(E_OK == Modbus_Slave_Process());
+        TEST_CHECK((1U == eeprom_writes) && (0U != eeprom_write_polls) && (0x12U == eeprom[0x20]));
+        l_length = Request(l_read, sizeof(l_read), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_read_busy, sizeof(l_read_busy)));
+        l_length = Request(l_read_ram, sizeof(l_read_ram), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_read_ram_expected, sizeof(l_read_ram_expected)));
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+
+        /* 0x34 is already stored and isn't written again, the repeated request changes nothing */
+        for(l_index = 0U; l_index < 20U; l_index++)
+        {
+            TEST_CHECK(E_OK == Modbus_Slave_Process());
+        }
+        TEST_CHECK(3U == eeprom_writes);
+        TEST_CHECK((0xCAU == eeprom[0x20]) && (0x34U == eeprom[0x21]) && (0xBAU == eeprom[0x22]) && (0xBEU == eeprom[0x23]));
+        l_length = Request(l_read, sizeof(l_read), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_read_expected, sizeof(l_read_expected)));
+    }
+
+    /* GPIO register : 0 or 1 only */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x06, 0x00, 0x64, 0x00, 0x01};
+        const uint8 l_invalid[] = {SLAVE_ADDRESS, 0x06, 0x00, 0x64, 0x00, 0x02};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x86, MODBUS_EXCEPTION_ILLEGAL_VALUE};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_request, sizeof(l_request)));
+        TEST_CHECK(0x01U == (LATC & 0x03U));
+        l_length = Request(l_invalid, sizeof(l_invalid), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+    }
+
+    /* Exceptions : unmapped address, unsupported function, zero quantity, past the block end, too long */
+    {
+        const uint8 l_unmapped[] = {SLAVE_ADDRESS, 0x06, 0x00, 0x32, 0x00, 0x01};
+        const uint8 l_unmapped_expected[] = {SLAVE_ADDRESS, 0x86, MODBUS_EXCEPTION_ILLEGAL_ADDRESS};
+        const uint8 l_function[] = {SLAVE_ADDRESS, 0x05, 0x00, 0x00, 0xFF, 0x00};
+        const uint8 l_function_expected[] = {SLAVE_ADDRESS, 0x85, MODBUS_EXCEPTION_ILLEGAL_FUNCTION};
+        const uint8 l_zero[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x00, 0x00, 0x00};
+        const uint8 l_zero_expected[] = {SLAVE_ADDRESS, 0x83, MODBUS_EXCEPTION_ILLEGAL_VALUE};
+        const uint8 l_past_end[] = {SLAVE_ADDRESS, 0x04, 0x00, 0x03, 0x00, 0x02};
+        const uint8 l_past_end_expected[] = {SLAVE_ADDRESS, 0x84, MODBUS_EXCEPTION_ILLEGAL_ADDRESS};
+        const uint8 l_too_long[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x00, 0x00, 62U};
+        l_length = Request(l_unmapped, sizeof(l_unmapped), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_unmapped_expected, sizeof(l_unmapped_expected)));
+        l_length = Request(l_function, sizeof(l_function), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_function_expected, sizeof(l_function_expected)));
+        l_length = Request(l_zero, sizeof(l_zero), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_zero_expected, sizeof(l_zero_expected)));
+        l_length = Request(l_past_end, sizeof(l_past_end), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_past_end_expected, sizeof(l_past_end_expected)));
+        /* 62 registers don't fit in a 128 byte response */
+        l_length = Request(l_too_long, sizeof(l_too_long), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_zero_expected, sizeof(l_zero_expected)));
+    }
+
+    /* The longest read, 61 registers of the large block */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x03, 0x01, 0x2C, 0x00, 61U};
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK((3U + (61U * 2U) + 2U) == l_length);
+        TEST_CHECK((122U == l_response[2]) && (0U == Crc16(l_response, l_length)));
+        TEST_CHECK((0x3CU == l_response[3U + 120U]) && (0x3CU == l_response[3U + 121U]));
+    }
+
+    /* Silent : bad CRC, another slave, broadcast (executed) */
+    {
+        const uint8 l_bad_crc[] = {SLAVE_ADDRESS, 0x03, 0x00, 0x00, 0x00, 0x03, 0x12, 0x34};
+        const uint8 l_other[] = {SLAVE_ADDRESS + 1U, 0x03, 0x00, 0x00, 0x00, 0x03};
+        const uint8 l_broadcast[] = {MODBUS_BROADCAST_ADDRESS, 0x06, 0x00, 0x01, 0x55, 0xAA};
+        TEST_CHECK(0U == Request(l_bad_crc, sizeof(l_bad_crc), 0U, l_response));
+        TEST_CHECK(0U == Request(l_other, sizeof(l_other), 1U, l_response));
+        TEST_CHECK(0U == Request(l_broadcast, sizeof(l_broadcast), 1U, l_response));
+        TEST_CHECK(0x55AAU == holding[1]);
+    }
+
+    /* The EEPROM queue keeps one entry empty : 3 pairs of writes fit, the 4th one is busy */
+    {
+        const uint8 l_request[] = {SLAVE_ADDRESS, 0x10, 0x00, 0x0C, 0x00, 0x02, 0x04, 0x01, 0x02, 0x03, 0x04};
+        const uint8 l_expected[] = {SLAVE_ADDRESS, 0x10, 0x00, 0x0C, 0x00, 0x02};
+        const uint8 l_busy[] = {SLAVE_ADDRESS, 0x90, MODBUS_EXCEPTION_SLAVE_BUSY};
+        for(l_index = 0U; l_index < ((MODBUS_CFG_EEPROM_QUEUE_SIZE - 1U) / 2U); l_index++)
+        {
+            l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+            TEST_CHECK(Response_Is(l_response, l_length, l_expected, sizeof(l_expected)));
+        }
+        l_length = Request(l_request, sizeof(l_request), 1U, l_response);
+        TEST_CHECK(Response_Is(l_response, l_length, l_busy, sizeof(l_busy)));
+        for(l_index = 0U; l_index < 50U; l_index++)
+        {
+            TEST_CHECK(E_OK == Modbus_Slave_Process());
+        }
+        TEST_CHECK((0x01U == eeprom[0x24]) && (0x02U == eeprom[0x25]) && (0x03U == eeprom[0x26]) &&
+                   (0x04U == eeprom[0x27]) && (0U == eeprom_write_polls));
+    }
+
+    TEST_CHECK(E_OK == Modbus_Slave_Get_Statistics(&l_statistics));
+    printf("bus %u, CRC errors %u, exceptions %u, slave %u\n", l_statistics.bus_messages,
+           l_statistics.crc_errors, l_statistics.exceptions, l_statistics.slave_messages);
+    TEST_CHECK(1U == l_statistics.crc_errors);
+    TEST_CHECK(8U == l_statistics.exceptions);
+    TEST_CHECK(0U == eeprom_conflicts);
+
+    return TEST_RESULT("test_modbus_slave");
+}
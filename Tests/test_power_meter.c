@@ -0,0 +1,113 @@
+/*
+ * File:   test_power_meter.c
+ * Author: Abdelrahman Aref
+ *
+ * Feeds Power_Meter_Add_Sample() with the sample timing of the triggered scan : the voltage
+ * at 2k / 3200 s and the current one conversion later, and checks the readings of resistive,
+ * lagging and leading loads against the exact values, and a cycle right after a DC offset step.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <math.h>
+#include "test_common.h"
+#include "../ECU_Layer/Power_Meter/ecu_power_meter.h"
+
+#define PI                                3.14159265358979
+#define CYCLES                            20U
+
+/* 230 V rms = 400 counts peak, 0.1 V per count : 5.75 V/count, gain Q10 */
+#define VOLTAGE_PEAK_COUNTS               400.0
+#define VOLTAGE_RMS_01V                   2300.0
+#define CURRENT_PEAK_COUNTS               300.0
+#define CURRENT_RMS_MA                    5000.0
+
+static uint32 noise_seed = 99UL;
+
+/* +-0.5 count uniform dither, the quantizer rounds */
+static double Noise(void)
+{
+    noise_seed = (noise_seed * 1103515245UL) + 12345UL;
+    return ((double)((noise_seed >> 8) & 0xFFFFUL) / 65536.0) - 0.5;
+}
+
+static adc_result_t Sample(double offset, double peak, double phase)
+{
+    return (adc_result_t)lround(offset + (peak * sin(phase)) + Noise());
+}
+
+/* Runs CYCLES mains cycles with the current lagging the voltage by phi (radians) */
+static void Run(const power_meter_t *_meter, double phi, power_meter_reading_t *_reading)
+{
+    double l_omega = 2.0 * PI * (double)POWER_METER_CFG_MAINS_FREQUENCY;
+    double l_period = 1.0 / (double)POWER_METER_CFG_SAMPLE_RATE;
+    uint32 l_pair = 0UL;
+
+    for(l_pair = 0UL; l_pair < (CYCLES * POWER_METER_SAMPLES_PER_CYCLE); l_pair++)
+    {
+        double l_t_voltage = (double)(2UL * l_pair) * l_period;
+        double l_t_current = l_t_voltage + l_period;
+
+        (void)Power_Meter_Add_Sample(Sample(515.0, VOLTAGE_PEAK_COUNTS, l_omega * l_t_voltage),
+                                     Sample(508.0, CURRENT_PEAK_COUNTS, (l_omega * l_t_current) - phi));
+    }
+    TEST_CHECK(E_OK == Power_Meter_Get_Reading(_meter, _reading));
+}
+
+static void Check(const power_meter_t *_meter, double power_factor)
+{
+    power_meter_reading_t l_reading;
+    double l_real_power = (VOLTAGE_RMS_01V * CURRENT_RMS_MA / 1000.0) * power_factor;
+
+    Run(_meter, acos(power_factor) * ((power_factor < 0.0) ? -1.0 : 1.0), &l_reading);
+    printf("PF %+.3f : V %u (0.1 V), I %u mA, PF %ld per mille, P %ld (0.1 W), expected %.0f\n",
+           power_factor, l_reading.voltage_rms, l_reading.current_rms, (long)l_reading.power_factor,
+           (long)l_reading.real_power, l_real_power);
+    TEST_CHECK(fabs((double)l_reading.voltage_rms - VOLTAGE_RMS_01V) < (VOLTAGE_RMS_01V * 0.005));
+    TEST_CHECK(fabs((double)l_reading.current_rms - CURRENT_RMS_MA) < (CURRENT_RMS_MA * 0.005));
+    /* 1 % of the apparent power */
+    TEST_CHECK(fabs((double)l_reading.power_factor - (1000.0 * power_factor)) <= 10.0);
+    TEST_CHECK(fabs((double)l_reading.real_power - l_real_power) <= (VOLTAGE_RMS_01V * CURRENT_RMS_MA / 100000.0));
+}
+
+int main(void)
+{
+    power_meter_t l_meter = {0};
+    power_meter_reading_t l_reading;
+
+    /* Gains in Q10 : 0.1 V and mA per count */
+    l_meter.voltage_gain = (uint32)lround((VOLTAGE_RMS_01V / (VOLTAGE_PEAK_COUNTS / sqrt(2.0))) * 1024.0);
+    l_meter.current_gain = (uint32)lround((CURRENT_RMS_MA / (CURRENT_PEAK_COUNTS / sqrt(2.0))) * 1024.0);
+
+    TEST_CHECK(E_NOT_OK == Power_Meter_Get_Reading(&l_meter, &l_reading));
+
+    /* Resistive, lagging (inductive) PF 0.5 and 0.8, quadrature */
+    Check(&l_meter, 1.0);
+    Check(&l_meter, 0.5);
+    Check(&l_meter, 0.8);
+    Check(&l_meter, 0.0);
+
+    /* Leading (capacitive) load : the current phase is ahead, same PF magnitude */
+    Run(&l_meter, -acos(0.5), &l_reading);
+    printf("PF 0.5 leading : PF %ld per mille\n", (long)l_reading.power_factor);
+    TEST_CHECK(fabs((double)l_reading.power_factor - 500.0) <= 10.0);
+
+    /* A 300 count voltage offset step : the first cycle after it removes a large sum(v)^2 / N */
+    {
+        double l_period = 1.0 / (double)POWER_METER_CFG_SAMPLE_RATE;
+        double l_omega = 2.0 * PI * (double)POWER_METER_CFG_MAINS_FREQUENCY;
+        uint32 l_pair = 0UL;
+
+        for(l_pair = 0UL; l_pair < POWER_METER_SAMPLES_PER_CYCLE; l_pair++)
+        {
+            (void)Power_Meter_Add_Sample(Sample(815.0, VOLTAGE_PEAK_COUNTS / 2.0, l_omega * (double)(2UL * l_pair) * l_period),
+                                         Sample(508.0, CURRENT_PEAK_COUNTS, l_omega * (double)((2UL * l_pair) + 1UL) * l_period));
+        }
+        TEST_CHECK(E_OK == Power_Meter_Get_Reading(&l_meter, &l_reading));
+        printf("offset step : V %u (0.1 V), PF %ld per mille\n", l_reading.voltage_rms, (long)l_reading.power_factor);
+        TEST_CHECK(fabs((double)l_reading.voltage_rms - (VOLTAGE_RMS_01V / 2.0)) < (VOLTAGE_RMS_01V * 0.005));
+        TEST_CHECK(fabs((double)l_reading.power_factor - 1000.0) <= 10.0);
+    }
+
+    return TEST_RESULT("test_power_meter");
+}
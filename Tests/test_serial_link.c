@@ -0,0 +1,204 @@
+/*
+ * File:   test_serial_link.c
+ * Author: Abdelrahman Aref
+ *
+ * Loops the link back on itself : the bytes written to TXREG by the transmit interrupt are fed
+ * to Serial_Link_Rx_Byte(), acknowledges included. Checks the delivered payloads, a corrupted
+ * frame and its retransmission, and measures the payload throughput on the wire and the host
+ * CPU time per payload byte (encoder, decoder and EUSART driver).
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <string.h>
+#include <time.h>
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../ECU_Layer/Serial_Link/ecu_serial_link.h"
+
+#define BAUDRATE                          57600UL
+#define WIRE_CAPACITY                     1024U
+#define TIMING_FRAMES                     100000UL
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static volatile unsigned char wire_overflow = 0U;
+static uint32 random_seed = 3UL;
+
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else
+    {
+        wire_overflow = 1U;
+    }
+    return l_slot;
+}
+
+static uint8 Random(void)
+{
+    random_seed = (random_seed * 1103515245UL) + 12345UL;
+    return (uint8)(random_seed >> 16);
+}
+
+/* TXREG is always empty : the transmit interrupt runs until the link has nothing left */
+static uint16 Transmit(void)
+{
+    uint16 l_sent = 0U;
+
+    PIR1bits.TXIF = 1;
+    while(PIE1bits.TXIE)
+    {
+        EUSART_TX_ISR();
+    }
+    l_sent = wire_length;
+    return l_sent;
+}
+
+/* Delivers the captured bytes, flipping one bit of the byte at corrupt_index if it is in range */
+static void Receive(uint16 corrupt_index)
+{
+    uint8 l_bytes[WIRE_CAPACITY];
+    uint16 l_count = wire_length;
+    uint16 l_index = 0U;
+
+    for(l_index = 0U; l_index < l_count; l_index++)
+    {
+        l_bytes[l_index] = wire[l_index];
+    }
+    if(corrupt_index < l_count)
+    {
+        l_bytes[corrupt_index] ^= 0x40U;
+    }
+    else { /* Nothing */ }
+    wire_length = 0U;
+    for(l_index = 0U; l_index < l_count; l_index++)
+    {
+        (void)Serial_Link_Rx_Byte(l_bytes[l_index]);
+    }
+}
+
+static uint8 Delivered(const uint8 *_payload, uint8 length)
+{
+    const uint8 *l_payload = NULL;
+    uint8 l_length = 0U;
+    uint8 l_ok = 0U;
+
+    if(E_OK == Serial_Link_Receive(&l_payload, &l_length))
+    {
+        l_ok = (uint8)((l_length == length) && (0 == memcmp(l_payload, _payload, length)));
+        (void)Serial_Link_Release();
+    }
+    else { /* Nothing */ }
+    return l_ok;
+}
+
+static serial_link_tx_status_t Tx_Status(void)
+{
+    serial_link_tx_status_t l_status = SERIAL_LINK_TX_FAILED;
+
+    (void)Serial_Link_Tx_Status(&l_status);
+    return l_status;
+}
+
+int main(void)
+{
+    serial_link_t l_link;
+    serial_link_statistics_t l_statistics;
+    uint8 l_payload[SERIAL_LINK_CFG_MAX_PAYLOAD];
+    uint16 l_data_bytes = 0U;
+    uint16 l_ack_bytes = 0U;
+    uint32 l_frame = 0UL;
+    uint32 l_delivered = 0UL;
+    uint8 l_length = 0U;
+    uint8 l_index = 0U;
+    clock_t l_start;
+    double l_seconds = 0.0;
+
+    memset(&l_link, 0, sizeof(l_link));
+    l_link.link_usart.baudrate = BAUDRATE;
+    l_link.link_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    TEST_CHECK(E_OK == Serial_Link_Init(&l_link));
+
+    /* Random lengths and contents, zero runs and no zeros at all, with and without acknowledge */
+    for(l_frame = 0UL; l_frame < 2000UL; l_frame++)
+    {
+        l_length = (uint8)(Random() % (SERIAL_LINK_CFG_MAX_PAYLOAD + 1U));
+        for(l_index = 0U; l_index < l_length; l_index++)
+        {
+            l_payload[l_index] = (0UL == (l_frame % 3UL)) ? Random() : ((1UL == (l_frame % 3UL)) ? 0U : (uint8)(l_index + 1U));
+        }
+        TEST_CHECK(E_OK == Serial_Link_Send(l_payload, l_length, (uint8)(l_frame & 1UL)));
+        l_data_bytes = Transmit();
+        /* Control, sequence, CRC, one COBS code per 254 bytes and the delimiter */
+        TEST_CHECK(l_data_bytes <= (l_length + SERIAL_LINK_FRAME_OVERHEAD + 2U));
+        Receive(WIRE_CAPACITY);
+        l_delivered += Delivered(l_payload, l_length);
+        (void)Transmit();
+        Receive(WIRE_CAPACITY);
+        TEST_CHECK(SERIAL_LINK_TX_IDLE == Tx_Status());
+    }
+    TEST_CHECK(2000UL == l_delivered);
+
+    /* A corrupted byte is dropped on the CRC, the sender retries after the timeout */
+    TEST_CHECK(E_OK == Serial_Link_Send(l_payload, 16U, 1U));
+    (void)Transmit();
+    Receive(5U);
+    TEST_CHECK(SERIAL_LINK_TX_WAIT_ACK == Tx_Status());
+    for(l_index = 0U; l_index < SERIAL_LINK_CFG_ACK_TIMEOUT; l_index++)
+    {
+        (void)Serial_Link_Tick();
+    }
+    (void)Transmit();
+    Receive(WIRE_CAPACITY);
+    TEST_CHECK(1U == Delivered(l_payload, 16U));
+    (void)Transmit();
+    Receive(WIRE_CAPACITY);
+    TEST_CHECK(SERIAL_LINK_TX_IDLE == Tx_Status());
+    TEST_CHECK(E_OK == Serial_Link_Get_Statistics(&l_statistics));
+    TEST_CHECK(1U == l_statistics.crc_errors);
+    TEST_CHECK(1U == l_statistics.retransmissions);
+    TEST_CHECK(0U == wire_overflow);
+
+    /* Throughput of full frames : back to back without acknowledge, one frame in flight with it */
+    for(l_index = 0U; l_index < SERIAL_LINK_CFG_MAX_PAYLOAD; l_index++)
+    {
+        l_payload[l_index] = Random();
+    }
+    (void)Serial_Link_Send(l_payload, SERIAL_LINK_CFG_MAX_PAYLOAD, 1U);
+    l_data_bytes = Transmit();
+    Receive(WIRE_CAPACITY);
+    (void)Serial_Link_Release();
+    l_ack_bytes = Transmit();
+    Receive(WIRE_CAPACITY);
+    printf("%u byte payload : %u bytes on the wire, acknowledge %u bytes\n",
+           SERIAL_LINK_CFG_MAX_PAYLOAD, l_data_bytes, l_ack_bytes);
+    printf("at %lu baud : %.0f payload bytes/s streaming, %.0f with acknowledge (no turnaround delay)\n",
+           BAUDRATE, (double)BAUDRATE / 10.0 * SERIAL_LINK_CFG_MAX_PAYLOAD / l_data_bytes,
+           (double)BAUDRATE / 10.0 * SERIAL_LINK_CFG_MAX_PAYLOAD / (l_data_bytes + l_ack_bytes));
+    /* 90 % of the wire carries payload with 64 byte frames */
+    TEST_CHECK((SERIAL_LINK_CFG_MAX_PAYLOAD * 10U) >= (l_data_bytes * 9U));
+
+    /* Host CPU time of the encoder, the decoder and the EUSART driver per payload byte */
+    l_start = clock();
+    for(l_frame = 0UL; l_frame < TIMING_FRAMES; l_frame++)
+    {
+        (void)Serial_Link_Send(l_payload, SERIAL_LINK_CFG_MAX_PAYLOAD, 0U);
+        (void)Transmit();
+        Receive(WIRE_CAPACITY);
+        (void)Serial_Link_Release();
+    }
+    l_seconds = (double)(clock() - l_start) / (double)CLOCKS_PER_SEC;
+    printf("host : %.1f ns per payload byte, transmit and receive\n",
+           (l_seconds * 1e9) / ((double)TIMING_FRAMES * SERIAL_LINK_CFG_MAX_PAYLOAD));
+    TEST_CHECK(E_OK == Serial_Link_Get_Statistics(&l_statistics));
+    TEST_CHECK(1U == l_statistics.crc_errors);
+
+    return TEST_RESULT("test_serial_link");
+}
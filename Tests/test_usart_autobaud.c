@@ -0,0 +1,154 @@
+/*
+ * File:   test_usart_autobaud.c
+ * Author: Abdelrahman Aref
+ *
+ * Drives the auto-baud acquisition of EUSART_RX_ISR() through the register stubs : the count
+ * left in SPBRGH:SPBRG by the hardware measure, ABDOVF and the bytes read from RCREG.
+ * Checks the snap on a standard rate, a non standard rate kept as measured, the scan of the
+ * standard rates after a counter rollover, and the first byte received after the lock.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+static unsigned char rx_byte = 0U;
+
+unsigned char Test_Rcreg_Read(void)
+{
+    PIR1bits.RCIF = 0;
+    RCSTAbits.FERR = 0;
+    return rx_byte;
+}
+
+/* One byte in the receive FIFO, then the receive interrupt */
+static void Receive(uint8 data, uint8 framing_error)
+{
+    rx_byte = data;
+    RCSTAbits.FERR = framing_error;
+    PIR1bits.RCIF = 1;
+    EUSART_RX_ISR();
+}
+
+/* End of the hardware measure : ABDEN cleared and the count of 8 bit times in SPBRGH:SPBRG */
+static void Measure(uint16 count, uint8 overflow)
+{
+    BAUDCONbits.ABDEN = 0;
+    BAUDCONbits.ABDOVF = overflow;
+    SPBRG = (uint8)count;
+    SPBRGH = (uint8)(count >> 8);
+    Receive(0x00U, 0U);
+}
+
+static usart_autobaud_status_t Status(void)
+{
+    usart_autobaud_status_t l_status = EUSART_AUTOBAUD_IDLE;
+
+    (void)EUSART_ASYNC_AutoBaud_Status(&l_status);
+    return l_status;
+}
+
+static uint32 Baud_Rate(sint32 *_error_ppm)
+{
+    uint32 l_baudrate = 0UL;
+
+    (void)EUSART_Get_Baud_Rate(&l_baudrate, _error_ppm);
+    return l_baudrate;
+}
+
+static uint16 Available(void)
+{
+    uint16 l_count = 0U;
+
+    (void)EUSART_ASYNC_RX_Available(&l_count);
+    return l_count;
+}
+
+int main(void)
+{
+    usart_t l_usart = {0};
+    sint32 l_error_ppm = 0L;
+    uint8 l_data = 0U;
+    uint8 l_index = 0U;
+
+    /* The acquisition runs in the receive interrupt */
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_AutoBaud_Start());
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(EUSART_AUTOBAUD_IDLE == Status());
+
+    /* 19200 baud : 8 MHz / (4 * 19200) = 104.2 counts, 19230 measured is locked on 19200 */
+    TEST_CHECK(E_OK == EUSART_ASYNC_AutoBaud_Start());
+    TEST_CHECK(EUSART_AUTOBAUD_MEASURING == Status());
+    TEST_CHECK(1U == BAUDCONbits.ABDEN);
+    TEST_CHECK(1U == TXSTAbits.BRGH);
+    TEST_CHECK(1U == BAUDCONbits.BRG16);
+    Measure(104U, 0U);
+    TEST_CHECK(EUSART_AUTOBAUD_LOCKED == Status());
+    TEST_CHECK(19231UL == Baud_Rate(&l_error_ppm));
+    TEST_CHECK(1602L == l_error_ppm);
+    TEST_CHECK(103U == SPBRG);
+    TEST_CHECK(0U == SPBRGH);
+    /* The sync byte is not buffered, the first frame after the lock is received normally */
+    TEST_CHECK(0U == Available());
+    Receive('A', 0U);
+    TEST_CHECK(1U == Available());
+    TEST_CHECK((E_OK == EUSART_ASYNC_ReadByteNonBlocking(&l_data)) && ('A' == l_data));
+
+    /* 31250 baud (MIDI) : 64 counts, 20 % from 38400, the measured divider is kept */
+    TEST_CHECK(E_OK == EUSART_ASYNC_AutoBaud_Start());
+    Measure(64U, 0U);
+    TEST_CHECK(EUSART_AUTOBAUD_LOCKED == Status());
+    TEST_CHECK(31250UL == Baud_Rate(&l_error_ppm));
+    TEST_CHECK(0L == l_error_ppm);
+    TEST_CHECK(63U == SPBRG);
+    TEST_CHECK(0U == SPBRGH);
+    TEST_CHECK(1U == TXSTAbits.BRGH);
+    TEST_CHECK(1U == BAUDCONbits.BRG16);
+    TEST_CHECK(0U == Available());
+
+    /* Counter rollover : the standard rates are tried from 1200 up (2401, 4796 reached at 8 MHz) */
+    TEST_CHECK(E_OK == EUSART_ASYNC_AutoBaud_Start());
+    Measure(0U, 1U);
+    TEST_CHECK(EUSART_AUTOBAUD_SCANNING == Status());
+    TEST_CHECK(0U == BAUDCONbits.ABDOVF);
+    TEST_CHECK(1200UL == Baud_Rate(&l_error_ppm));
+    /* A framing error or another byte than the sync byte moves to the next rate */
+    Receive(0x00U, 1U);
+    TEST_CHECK(2401UL == Baud_Rate(&l_error_ppm));
+    Receive(0xF8U, 0U);
+    TEST_CHECK(EUSART_AUTOBAUD_SCANNING == Status());
+    TEST_CHECK(4796UL == Baud_Rate(&l_error_ppm));
+    Receive(EUSART_AUTOBAUD_SYNC_BYTE, 0U);
+    TEST_CHECK(EUSART_AUTOBAUD_LOCKED == Status());
+    TEST_CHECK(4796UL == Baud_Rate(&l_error_ppm));
+    TEST_CHECK(0U == Available());
+    Receive('B', 0U);
+    TEST_CHECK((E_OK == EUSART_ASYNC_ReadByteNonBlocking(&l_data)) && ('B' == l_data));
+
+    /* No clean sync byte up to 57600, 115200 is out of reach at 8 MHz : measure again */
+    TEST_CHECK(E_OK == EUSART_ASYNC_AutoBaud_Start());
+    Measure(0U, 1U);
+    for(l_index = 0U; l_index < 6U; l_index++)
+    {
+        Receive(0x00U, 1U);
+    }
+    TEST_CHECK(EUSART_AUTOBAUD_SCANNING == Status());
+    TEST_CHECK(57143UL == Baud_Rate(&l_error_ppm));
+    Receive(0x00U, 1U);
+    TEST_CHECK(EUSART_AUTOBAUD_MEASURING == Status());
+    TEST_CHECK(1U == BAUDCONbits.ABDEN);
+    /* A zero count is noise, it scans like a rollover */
+    Measure(0U, 0U);
+    TEST_CHECK(EUSART_AUTOBAUD_SCANNING == Status());
+    TEST_CHECK(0U == Available());
+
+    return TEST_RESULT("test_usart_autobaud");
+}
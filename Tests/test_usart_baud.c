@@ -0,0 +1,185 @@
+/*
+ * File:   test_usart_baud.c
+ * Author: Abdelrahman Aref
+ *
+ * Checks the baud rate generator settings of EUSART_ASYNC_Init() against a floating point
+ * reference at _XTAL_FREQ : SPBRGH:SPBRG, BRGH and BRG16 of each mode, the reached rate, the
+ * error in ppm, the rejection above EUSART_BAUDRATE_MAX_ERROR_PPM, and the BAUDRATE_ASYN_AUTO
+ * choice with its tie-break on the later mode. The rates sweep 300 baud to 1 Mbaud.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <math.h>
+#include "test_common.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define MODE_COUNT                        4U
+#define RATE_COUNT                        16U
+
+typedef struct{
+    uint8 valid;            /* In the mode range and within EUSART_BAUDRATE_MAX_ERROR_PPM */
+    uint8 in_range;
+    uint16 brg;
+    uint32 achieved;
+    double error_ppm;
+}reference_t;
+
+static const uint32 rates[RATE_COUNT] = {300UL, 1200UL, 2400UL, 4800UL, 9600UL, 14400UL, 19200UL, 28800UL,
+                                         31250UL, 38400UL, 57600UL, 76800UL, 115200UL, 250000UL, 500000UL,
+                                         1000000UL};
+/* Divider, BRGH and BRG16 in the baudrate_gen_t order */
+static const uint32 dividers[MODE_COUNT] = {64UL, 16UL, 16UL, 4UL};
+static const uint8 brgh[MODE_COUNT] = {0U, 1U, 0U, 1U};
+static const uint8 brg16[MODE_COUNT] = {0U, 0U, 1U, 1U};
+
+static reference_t Reference(uint32 baudrate, uint8 mode)
+{
+    reference_t l_reference = {0};
+    double l_exact = (double)_XTAL_FREQ / ((double)dividers[mode] * (double)baudrate);
+    double l_count = floor(l_exact + 0.5);
+    double l_brg_max = (1U == brg16[mode]) ? 65535.0 : 255.0;
+
+    l_reference.in_range = (uint8)((l_count >= 1.0) && (l_count <= (l_brg_max + 1.0)));
+    if(l_reference.in_range)
+    {
+        l_reference.brg = (uint16)(l_count - 1.0);
+        l_reference.achieved = (uint32)floor(((double)_XTAL_FREQ / ((double)dividers[mode] * l_count)) + 0.5);
+        l_reference.error_ppm = (((double)_XTAL_FREQ / ((double)dividers[mode] * (double)baudrate * l_count)) - 1.0) * 1e6;
+        l_reference.valid = (uint8)(fabs(l_reference.error_ppm) <= (double)EUSART_BAUDRATE_MAX_ERROR_PPM);
+    }
+    else { /* Nothing */ }
+    return l_reference;
+}
+
+/* The driver truncates Fosc / 1000 on the way, a few ppm at most in the accepted range */
+static uint8 Same_Error(sint32 error_ppm, double reference_ppm)
+{
+    return (uint8)(fabs((double)error_ppm - reference_ppm) <= (1.0 + (fabs(reference_ppm) / 4000.0)));
+}
+
+/* Runs EUSART_ASYNC_Init() and compares the registers and the reported rate with the mode reference */
+static uint8 Check(uint32 baudrate, baudrate_gen_t gen, uint8 mode, const reference_t *_reference)
+{
+    usart_t l_usart = {0};
+    Std_ReturnType l_ret = E_NOT_OK;
+    uint32 l_achieved = 0UL;
+    sint32 l_error_ppm = 0L;
+    uint8 l_ok = 0U;
+
+    l_usart.baudrate = baudrate;
+    l_usart.baudrate_gen_gonfig = gen;
+    SPBRG = 0U;
+    SPBRGH = 0U;
+    l_ret = EUSART_ASYNC_Init(&l_usart);
+    (void)EUSART_Get_Baud_Rate(&l_achieved, &l_error_ppm);
+    if(_reference->valid)
+    {
+        l_ok = (uint8)((E_OK == l_ret) && (1U == RCSTAbits.SPEN) && (0U == TXSTAbits.SYNC) &&
+                       (brgh[mode] == TXSTAbits.BRGH) && (brg16[mode] == BAUDCONbits.BRG16) &&
+                       (_reference->brg == (uint16)(((uint16)SPBRGH << 8) | SPBRG)) &&
+                       (_reference->achieved == l_achieved) && Same_Error(l_error_ppm, _reference->error_ppm));
+    }
+    else
+    {
+        /* Rejected, the module stays disabled and the generator untouched */
+        l_ok = (uint8)((E_NOT_OK == l_ret) && (0U == RCSTAbits.SPEN) && (0U == SPBRG) && (0U == SPBRGH));
+    }
+    if(0U == l_ok)
+    {
+        printf("%lu baud, mode %u : ret %u BRGH %u BRG16 %u BRG %u, %lu baud %+ld ppm, expected BRG %u %lu baud %+.0f ppm%s\n",
+               baudrate, (unsigned)gen, l_ret, TXSTAbits.BRGH, BAUDCONbits.BRG16, (((unsigned)SPBRGH << 8) | SPBRG),
+               l_achieved, l_error_ppm, _reference->brg, _reference->achieved, _reference->error_ppm,
+               _reference->valid ? "" : " (rejected)");
+    }
+    else { /* Nothing */ }
+    return l_ok;
+}
+
+int main(void)
+{
+    reference_t l_references[MODE_COUNT];
+    usart_t l_usart = {0};
+    uint32 l_achieved = 0UL;
+    sint32 l_error_ppm = 0L;
+    uint8 l_rate = 0U;
+    uint8 l_mode = 0U;
+    uint8 l_best = 0U;
+    uint8 l_found = 0U;
+
+    for(l_rate = 0U; l_rate < RATE_COUNT; l_rate++)
+    {
+        l_found = 0U;
+        l_best = 0U;
+        for(l_mode = 0U; l_mode < MODE_COUNT; l_mode++)
+        {
+            /* Each mode alone */
+            l_references[l_mode] = Reference(rates[l_rate], l_mode);
+            TEST_CHECK(1U == Check(rates[l_rate], (baudrate_gen_t)l_mode, l_mode, &l_references[l_mode]));
+            /* Automatic : smallest error, the later mode on a tie (same divider * count) */
+            if((l_references[l_mode].in_range) &&
+               ((0U == l_found) || (fabs(l_references[l_mode].error_ppm) <= (fabs(l_references[l_best].error_ppm) + 1e-6))))
+            {
+                l_best = l_mode;
+                l_found = 1U;
+            }
+            else { /* Nothing */ }
+        }
+        TEST_CHECK(1U == Check(rates[l_rate], BAUDRATE_ASYN_AUTO, l_best, &l_references[l_best]));
+        if(l_references[l_best].valid)
+        {
+            printf("%7lu baud : BRGH %u BRG16 %u BRG %5u, %7lu baud %+6.0f ppm\n", rates[l_rate], brgh[l_best],
+                   brg16[l_best], l_references[l_best].brg, l_references[l_best].achieved, l_references[l_best].error_ppm);
+        }
+        else
+        {
+            printf("%7lu baud : rejected, best %+.0f ppm\n", rates[l_rate], l_references[l_best].error_ppm);
+        }
+    }
+
+    /* 9600 : 16-bit high speed (BRG 207) ties 16-bit low speed (BRG 51), the finer step wins */
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK((1U == TXSTAbits.BRGH) && (1U == BAUDCONbits.BRG16) && (207U == SPBRG) && (0U == SPBRGH));
+    TEST_CHECK(E_OK == EUSART_Get_Baud_Rate(&l_achieved, &l_error_ppm));
+    TEST_CHECK((9615UL == l_achieved) && (1602L == l_error_ppm));
+    TEST_CHECK(207UL == EUSART_BRG_VALUE(9600UL, 4UL));
+    TEST_CHECK(9615UL == EUSART_BRG_BAUDRATE(9600UL, 4UL));
+
+    /* 300 : out of the 8-bit range at Fosc / 64, 16-bit BRG 6666 */
+    l_usart.baudrate = 300UL;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK((0x0AU == SPBRG) && (0x1AU == SPBRGH));
+    TEST_CHECK(E_OK == EUSART_Get_Baud_Rate(&l_achieved, &l_error_ppm));
+    TEST_CHECK((300UL == l_achieved) && (-50L == l_error_ppm));
+
+    /* 115200 at 8 MHz : 2.1 % off at best, rejected */
+    l_usart.baudrate = 115200UL;
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(0U == RCSTAbits.SPEN);
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_16BIT_HIGH_SPEED;
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_Init(&l_usart));
+    /* The last accepted rate is still reported */
+    TEST_CHECK(E_OK == EUSART_Get_Baud_Rate(&l_achieved, &l_error_ppm));
+    TEST_CHECK(300UL == l_achieved);
+
+    /* 1 Mbaud : Fosc / (4 * 2), exact */
+    l_usart.baudrate = 1000000UL;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK((1U == SPBRG) && (0U == SPBRGH));
+    TEST_CHECK(E_OK == EUSART_Get_Baud_Rate(&l_achieved, &l_error_ppm));
+    TEST_CHECK((1000000UL == l_achieved) && (0L == l_error_ppm));
+
+    /* Invalid parameters */
+    l_usart.baudrate = 0UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_Init(&l_usart));
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = (baudrate_gen_t)(BAUDRATE_ASYN_AUTO + 1);
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_Init(NULL));
+    TEST_CHECK(E_NOT_OK == EUSART_Get_Baud_Rate(NULL, &l_error_ppm));
+
+    return TEST_RESULT("test_usart_baud");
+}
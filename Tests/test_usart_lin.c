@@ -0,0 +1,295 @@
+/*
+ * File:   test_usart_lin.c
+ * Author: Abdelrahman Aref
+ *
+ * Loops a LIN master back on itself like the single wire bus : the bytes written to TXREG by
+ * the EUSART driver are fed to LIN_Rx_Byte(), the break (SENDB) to LIN_Break_Event(), and a
+ * slave response is injected after a given identifier. Checks a published and a subscribed
+ * frame, a bad checksum, a bad parity, a missing response, a collision, a slave node replay
+ * and the protected identifier of the 64 frame identifiers.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart_lin.h"
+
+#define WIRE_CAPACITY                     256U
+#define NO_CORRUPTION                     0xFFFFU
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint8 wire_break[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static uint16 wire_fed = 0U;
+static uint16 corrupt_index = NO_CORRUPTION;
+
+/* A byte written with SENDB set is the break, the EUSART clears SENDB once it is sent */
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        wire_break[wire_length] = (uint8)TXSTAbits.SENDB;
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    TXSTAbits.SENDB = 0;
+    return l_slot;
+}
+
+static void Wire_Clear(void)
+{
+    wire_length = 0U;
+    wire_fed = 0U;
+}
+
+/* Reference parity : P0 = ID0 ^ ID1 ^ ID2 ^ ID4, P1 = !(ID1 ^ ID3 ^ ID4 ^ ID5) */
+static uint8 Reference_Pid(uint8 frame_id)
+{
+    uint8 l_bit[6];
+    uint8 l_index = 0U;
+
+    for(l_index = 0U; l_index < 6U; l_index++)
+    {
+        l_bit[l_index] = (uint8)((frame_id >> l_index) & 1U);
+    }
+    return (uint8)(frame_id | ((l_bit[0] ^ l_bit[1] ^ l_bit[2] ^ l_bit[4]) << 6) |
+                   ((1U ^ l_bit[1] ^ l_bit[3] ^ l_bit[4] ^ l_bit[5]) << 7));
+}
+
+/* Inverted sum with carry wrap-around, starting from the identifier for the enhanced checksum */
+static uint8 Reference_Checksum(uint8 start, const uint8 *_data, uint8 length)
+{
+    uint16 l_sum = start;
+    uint8 l_index = 0U;
+
+    for(l_index = 0U; l_index < length; l_index++)
+    {
+        l_sum += _data[l_index];
+        if(l_sum > 0xFFU)
+        {
+            l_sum -= 0xFFU;
+        }
+        else { /* Nothing */ }
+    }
+    return (uint8)~l_sum;
+}
+
+/* Sends what the driver queued and reads it back, the slave answers after the identifier after_pid */
+static void Bus(const uint8 *_slave, uint8 slave_length, uint8 after_pid)
+{
+    uint8 l_data = 0U;
+    uint8 l_index = 0U;
+
+    do
+    {
+        PIR1bits.TXIF = 1;
+        while(PIE1bits.TXIE)
+        {
+            EUSART_TX_ISR();
+        }
+        while(wire_fed < wire_length)
+        {
+            l_data = (wire_fed == corrupt_index) ? (uint8)(wire[wire_fed] ^ 0x01U) : wire[wire_fed];
+            if(wire_break[wire_fed])
+            {
+                (void)LIN_Break_Event();
+            }
+            else
+            {
+                (void)LIN_Rx_Byte(l_data);
+                if((NULL != _slave) && (after_pid == l_data))
+                {
+                    for(l_index = 0U; l_index < slave_length; l_index++)
+                    {
+                        (void)LIN_Rx_Byte(_slave[l_index]);
+                    }
+                    _slave = NULL;
+                }
+                else { /* Nothing */ }
+            }
+            wire_fed++;
+        }
+    }while(PIE1bits.TXIE);
+}
+
+static uint8 Wire_Is(const uint8 *_bytes, uint16 length)
+{
+    uint8 l_same = (uint8)(length == wire_length);
+    uint16 l_index = 0U;
+
+    for(l_index = 0U; (l_same) && (l_index < length); l_index++)
+    {
+        /* The break is sent as a 0x00 byte */
+        l_same = (uint8)((_bytes[l_index] == wire[l_index]) && ((0U == l_index) == (1U == wire_break[l_index])));
+    }
+    return l_same;
+}
+
+static lin_statistics_t Statistics(void)
+{
+    lin_statistics_t l_statistics;
+
+    (void)LIN_Get_Statistics(&l_statistics);
+    return l_statistics;
+}
+
+int main(void)
+{
+    lin_frame_t l_frames[4] = {
+        {0x10U, 2U, LIN_FRAME_PUBLISH, LIN_CHECKSUM_ENHANCED, {0x4AU, 0x55U}},
+        {0x20U, 4U, LIN_FRAME_SUBSCRIBE, LIN_CHECKSUM_CLASSIC},
+        {0x3CU, 2U, LIN_FRAME_SUBSCRIBE, LIN_CHECKSUM_ENHANCED},
+        {0x21U, 1U, LIN_FRAME_SUBSCRIBE, LIN_CHECKSUM_ENHANCED}
+    };
+    const lin_schedule_entry_t l_schedule[4] = {{0x10U, 1U}, {0x20U, 1U}, {0x3CU, 1U}, {0x21U, 1U}};
+    lin_schedule_entry_t l_id_schedule[LIN_MAX_FRAME_ID + 1U];
+    lin_t l_lin;
+    lin_t l_slave;
+    lin_statistics_t l_statistics;
+    uint8 l_expected[12];
+    uint8 l_response[5] = {0x01U, 0x02U, 0x03U, 0x04U, 0x00U};
+    uint8 l_data[LIN_MAX_DATA_LENGTH];
+    uint16 l_value = 0U;
+    uint8 l_id = 0U;
+    uint8 l_pid_ok = 1U;
+
+    memset(&l_lin, 0, sizeof(l_lin));
+    l_lin.lin_usart.baudrate = 19200UL;
+    l_lin.lin_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_lin.node = LIN_NODE_MASTER;
+    l_lin.frames = l_frames;
+    l_lin.frame_count = 4U;
+    l_lin.schedule = l_schedule;
+    l_lin.schedule_count = 4U;
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(E_OK == LIN_Init(&l_lin));
+
+    /* Published frame : break, sync, identifier 0x50, then the response read back from the bus */
+    TEST_CHECK(E_OK == LIN_Master_Tick());
+    Bus(NULL, 0U, 0U);
+    l_expected[0] = 0x00U;
+    l_expected[1] = LIN_SYNC_BYTE;
+    l_expected[2] = 0x50U;
+    l_expected[3] = 0x4AU;
+    l_expected[4] = 0x55U;
+    l_expected[5] = Reference_Checksum(0x50U, &l_expected[3], 2U);
+    TEST_CHECK(0x10U == l_expected[5]);
+    TEST_CHECK(Wire_Is(l_expected, 6U));
+    l_statistics = Statistics();
+    TEST_CHECK((1U == l_statistics.headers) && (1U == l_statistics.responses));
+
+    /* Subscribed frame, classic checksum : 0x20 has both parity bits clear */
+    Wire_Clear();
+    l_response[4] = Reference_Checksum(0U, l_response, 4U);
+    TEST_CHECK(E_OK == LIN_Master_Tick());
+    Bus(l_response, 5U, 0x20U);
+    TEST_CHECK(3U == wire_length);
+    TEST_CHECK(0x20U == wire[2]);
+    TEST_CHECK(E_OK == LIN_Read_Frame(0x20U, l_data));
+    TEST_CHECK(0 == memcmp(l_data, l_response, 4U));
+    TEST_CHECK(E_NOT_OK == LIN_Read_Frame(0x20U, l_data));
+    TEST_CHECK(2U == Statistics().responses);
+
+    /* Master request 0x3C with a bad checksum : counted, the frame is not updated */
+    Wire_Clear();
+    l_response[0] = 0x09U;
+    l_response[1] = 0x09U;
+    l_response[2] = (uint8)(Reference_Checksum(0U, l_response, 2U) ^ 0x80U);
+    TEST_CHECK(E_OK == LIN_Master_Tick());
+    Bus(l_response, 3U, 0x3CU);
+    TEST_CHECK(0x3CU == wire[2]);
+    TEST_CHECK(E_NOT_OK == LIN_Read_Frame(0x3CU, l_data));
+    TEST_CHECK(1U == Statistics().checksum_errors);
+
+    /* 0x21 gets one byte of two, counted as missing when the next header breaks in */
+    Wire_Clear();
+    TEST_CHECK(E_OK == LIN_Master_Tick());
+    Bus(l_response, 1U, Reference_Pid(0x21U));
+    TEST_CHECK(0U == Statistics().no_responses);
+    /* Next slot 0x10 : a published byte read back different from the bus is a collision */
+    Wire_Clear();
+    corrupt_index = 4U;
+    TEST_CHECK(E_OK == LIN_Master_Tick());
+    Bus(NULL, 0U, 0U);
+    corrupt_index = NO_CORRUPTION;
+    l_statistics = Statistics();
+    TEST_CHECK(1U == l_statistics.no_responses);
+    TEST_CHECK(1U == l_statistics.bit_errors);
+    TEST_CHECK(2U == l_statistics.responses);
+    TEST_CHECK(5U == l_statistics.headers);
+    TEST_CHECK(E_NOT_OK == LIN_Read_Frame(0x21U, l_data));
+
+    /* A header with bad parity bits selects no frame */
+    TEST_CHECK(E_OK == LIN_Break_Event());
+    TEST_CHECK(E_OK == LIN_Rx_Byte(LIN_SYNC_BYTE));
+    TEST_CHECK(E_OK == LIN_Rx_Byte(0x20U | 0x40U));
+    TEST_CHECK(E_OK == LIN_Rx_Byte(0x01U));
+    TEST_CHECK(1U == Statistics().parity_errors);
+
+    /* Slave node replaying the bus : it answers 0x21 with the enhanced checksum */
+    memset(&l_slave, 0, sizeof(l_slave));
+    l_frames[3].direction = LIN_FRAME_PUBLISH;
+    l_frames[3].data[0] = 0xA5U;
+    l_slave.node = LIN_NODE_SLAVE;
+    l_slave.frames = &l_frames[3];
+    l_slave.frame_count = 1U;
+    TEST_CHECK(E_OK == LIN_Select(&l_slave));
+    TEST_CHECK(E_NOT_OK == LIN_Master_Tick());
+    Wire_Clear();
+    /* The sync field is measured by the auto-baud detect, the identifier comes next */
+    TEST_CHECK(E_OK == LIN_Break_Event());
+    TEST_CHECK(E_OK == LIN_Rx_Byte(Reference_Pid(0x21U)));
+    Bus(NULL, 0U, 0U);
+    TEST_CHECK(2U == wire_length);
+    TEST_CHECK(0xA5U == wire[0]);
+    TEST_CHECK(Reference_Checksum(Reference_Pid(0x21U), &l_frames[3].data[0], 1U) == wire[1]);
+    l_statistics = Statistics();
+    TEST_CHECK((1U == l_statistics.headers) && (1U == l_statistics.responses));
+
+    /* Protected identifiers : known values, then the 64 identifiers sent by the master */
+    TEST_CHECK((0x80U == Reference_Pid(0x00U)) && (0xC1U == Reference_Pid(0x01U)) &&
+               (0x3CU == Reference_Pid(0x3CU)) && (0x7DU == Reference_Pid(0x3DU)));
+    for(l_id = 0U; l_id <= LIN_MAX_FRAME_ID; l_id++)
+    {
+        l_id_schedule[l_id].frame_id = l_id;
+        l_id_schedule[l_id].slot_ticks = 1U;
+    }
+    l_lin.schedule = l_id_schedule;
+    l_lin.schedule_count = LIN_MAX_FRAME_ID + 1U;
+    TEST_CHECK(E_OK == LIN_Select(&l_lin));
+    for(l_id = 0U; l_id <= LIN_MAX_FRAME_ID; l_id++)
+    {
+        Wire_Clear();
+        (void)LIN_Master_Tick();
+        PIR1bits.TXIF = 1;
+        while(PIE1bits.TXIE)
+        {
+            EUSART_TX_ISR();
+        }
+        if((3U > wire_length) || (Reference_Pid(l_id) != wire[2]))
+        {
+            printf("identifier 0x%02X : 0x%02X sent, 0x%02X expected\n", l_id, wire[2], Reference_Pid(l_id));
+            l_pid_ok = 0U;
+        }
+        else { /* Nothing */ }
+    }
+    TEST_CHECK(1U == l_pid_ok);
+
+    /* Every other byte received as an identifier is a parity error */
+    for(l_value = 0U; l_value <= 0xFFU; l_value++)
+    {
+        (void)LIN_Break_Event();
+        (void)LIN_Rx_Byte(LIN_SYNC_BYTE);
+        (void)LIN_Rx_Byte((uint8)l_value);
+    }
+    l_statistics = Statistics();
+    TEST_CHECK(64U == l_statistics.headers);
+    TEST_CHECK(192U == l_statistics.parity_errors);
+
+    return TEST_RESULT("test_usart_lin");
+}
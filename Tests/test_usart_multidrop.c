@@ -0,0 +1,168 @@
+/*
+ * File:   test_usart_multidrop.c
+ * Author: Abdelrahman Aref
+ *
+ * 9-bit multi-drop addressing : the bus model drops the data bytes while ADDEN is set, like
+ * the EUSART, and only the bytes it lets through interrupt. Checks the node selection on its
+ * address and on the broadcast, the interrupts taken by the node, the buffered data, and the
+ * 9th bit of each byte sent by the address writes.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define NODE_ADDRESS                      0x22U
+#define WIRE_CAPACITY                     128U
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint8 wire_ninth_bit[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static unsigned char rx_byte = 0U;
+static uint16 interrupts = 0U;
+
+/* The 9th bit is sent with the byte, TX9D is loaded before TXREG */
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        wire_ninth_bit[wire_length] = (uint8)TXSTAbits.TX9D;
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    return l_slot;
+}
+
+unsigned char Test_Rcreg_Read(void)
+{
+    PIR1bits.RCIF = 0;
+    return rx_byte;
+}
+
+/* One 9-bit character on the bus, with ADDEN the data bytes don't reach the FIFO */
+static void Bus(uint8 data, uint8 ninth_bit)
+{
+    if((0U == RCSTAbits.ADDEN) || (1U == ninth_bit))
+    {
+        rx_byte = data;
+        RCSTAbits.RX9D = ninth_bit;
+        PIR1bits.RCIF = 1;
+        EUSART_RX_ISR();
+        interrupts++;
+    }
+    else { /* Nothing */ }
+}
+
+static void Transmit(void)
+{
+    PIR1bits.TXIF = 1;
+    while(PIE1bits.TXIE)
+    {
+        EUSART_TX_ISR();
+    }
+}
+
+int main(void)
+{
+    usart_t l_usart = {0};
+    /* Frames for 0x33, this node, 0x44 and the broadcast, the address first */
+    const uint8 l_bus[13] = {0x33U, 0x01U, 0x02U, 0x03U, NODE_ADDRESS, 0x10U, 0x11U,
+                             0x44U, 0x09U, 0x09U, EUSART_MULTIDROP_BROADCAST_ADDRESS, 0x20U, 0x21U};
+    const uint8 l_addresses[13] = {1U, 0U, 0U, 0U, 1U, 0U, 0U, 1U, 0U, 0U, 1U, 0U, 0U};
+    const uint8 l_payload[EUSART_TX_BUFFER_SIZE] = {0};
+    uint8 l_data[16];
+    uint8 l_address = 0U;
+    uint16 l_count = 0U;
+    uint16 l_index = 0U;
+    uint8 l_ninth_ok = 1U;
+
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+    l_usart.usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_TX_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_node_address = NODE_ADDRESS;
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK((1U == RCSTAbits.RX9) && (1U == RCSTAbits.ADDEN));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_MultiDrop_Selected(&l_address));
+
+    /* 13 bytes on the bus : the 4 addresses and the 4 data bytes for this node interrupt */
+    for(l_index = 0U; l_index < 4U; l_index++)
+    {
+        Bus(l_bus[l_index], l_addresses[l_index]);
+    }
+    TEST_CHECK((1U == interrupts) && (1U == RCSTAbits.ADDEN));
+    Bus(l_bus[4], l_addresses[4]);
+    TEST_CHECK(0U == RCSTAbits.ADDEN);
+    TEST_CHECK((E_OK == EUSART_ASYNC_MultiDrop_Selected(&l_address)) && (NODE_ADDRESS == l_address));
+    for(l_index = 5U; l_index < 8U; l_index++)
+    {
+        Bus(l_bus[l_index], l_addresses[l_index]);
+    }
+    /* Another node is addressed, back to ADDEN */
+    TEST_CHECK(1U == RCSTAbits.ADDEN);
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_MultiDrop_Selected(&l_address));
+    for(l_index = 8U; l_index < 13U; l_index++)
+    {
+        Bus(l_bus[l_index], l_addresses[l_index]);
+    }
+    TEST_CHECK((E_OK == EUSART_ASYNC_MultiDrop_Selected(&l_address)) && (EUSART_MULTIDROP_BROADCAST_ADDRESS == l_address));
+    TEST_CHECK(8U == interrupts);
+    /* Only the data for this node and the broadcast is buffered, without the addresses */
+    TEST_CHECK(E_OK == EUSART_ASYNC_Read(l_data, 16U, &l_count));
+    TEST_CHECK((4U == l_count) && (0x10U == l_data[0]) && (0x11U == l_data[1]) &&
+               (0x20U == l_data[2]) && (0x21U == l_data[3]));
+
+    /* Frame sent : the 9th bit is set on the address byte only */
+    l_data[0] = 0xC0U;
+    l_data[1] = 0xC1U;
+    l_data[2] = 0xC2U;
+    TEST_CHECK(E_OK == EUSART_ASYNC_MultiDrop_Write(0x33U, l_data, 3U));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking(0xC3U));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteAddressNonBlocking(0x44U));
+    Transmit();
+    TEST_CHECK((6U == wire_length) && (0x33U == wire[0]) && (0xC2U == wire[3]) && (0x44U == wire[5]));
+    TEST_CHECK((1U == wire_ninth_bit[0]) && (0U == wire_ninth_bit[1]) && (0U == wire_ninth_bit[2]) &&
+               (0U == wire_ninth_bit[3]) && (0U == wire_ninth_bit[4]) && (1U == wire_ninth_bit[5]));
+
+    /* All or nothing : an address and 31 bytes don't fit, nothing is queued */
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_MultiDrop_Write(0x33U, l_payload, EUSART_TX_BUFFER_SIZE - 1U));
+    TEST_CHECK(0U == PIE1bits.TXIE);
+
+    /* The 9th bits follow their bytes across the buffer wrap-around */
+    wire_length = 0U;
+    for(l_index = 0U; l_index < 20U; l_index++)
+    {
+        TEST_CHECK(E_OK == EUSART_ASYNC_MultiDrop_Write((uint8)l_index, l_payload, l_index % 4U));
+        Transmit();
+    }
+    l_count = 0U;
+    for(l_index = 0U; l_index < 20U; l_index++)
+    {
+        l_ninth_ok &= (uint8)((1U == wire_ninth_bit[l_count]) && ((uint8)l_index == wire[l_count]));
+        l_count++;
+        for(l_address = 0U; l_address < (l_index % 4U); l_address++)
+        {
+            l_ninth_ok &= (uint8)(0U == wire_ninth_bit[l_count]);
+            l_count++;
+        }
+    }
+    TEST_CHECK((l_count == wire_length) && (1U == l_ninth_ok));
+
+    /* Address detect needs the buffered receiver */
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(0U == RCSTAbits.ADDEN);
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_MultiDrop_Selected(&l_address));
+
+    return TEST_RESULT("test_usart_multidrop");
+}
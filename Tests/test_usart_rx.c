@@ -0,0 +1,174 @@
+/*
+ * File:   test_usart_rx.c
+ * Author: Abdelrahman Aref
+ *
+ * Receive ring buffer of the EUSART driver fed through a 2-byte FIFO model : RCREG pops the top
+ * byte and FERR / RX9D follow the next one. Checks a 43-byte burst with no reader (a framing
+ * error and the overflows counted, the data read back in order), the overrun restart, the error
+ * handlers, the statistics and the reads without the receive interrupt.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define FIFO_DEPTH                        2U
+
+static uint8 fifo_data[FIFO_DEPTH];
+static uint8 fifo_framing[FIFO_DEPTH];
+static uint8 fifo_count = 0U;
+static uint16 rx_handler_calls = 0U;
+static uint16 framing_handler_calls = 0U;
+static uint16 overrun_handler_calls = 0U;
+
+/* The status bits always describe the byte on top of the FIFO */
+static void Fifo_Top(void)
+{
+    PIR1bits.RCIF = (uint8)(0U != fifo_count);
+    RCSTAbits.FERR = (0U != fifo_count) ? fifo_framing[0] : 0U;
+}
+
+unsigned char Test_Rcreg_Read(void)
+{
+    uint8 l_data = fifo_data[0];
+
+    if(0U != fifo_count)
+    {
+        fifo_data[0] = fifo_data[1];
+        fifo_framing[0] = fifo_framing[1];
+        fifo_count--;
+    }
+    else { /* Nothing */ }
+    Fifo_Top();
+    return l_data;
+}
+
+static void Fifo_Push(uint8 data, uint8 framing_error)
+{
+    if(fifo_count < FIFO_DEPTH)
+    {
+        fifo_data[fifo_count] = data;
+        fifo_framing[fifo_count] = framing_error;
+        fifo_count++;
+    }
+    else { /* Nothing */ }
+    Fifo_Top();
+}
+
+static void Rx_Handler(void)
+{
+    rx_handler_calls++;
+}
+
+static void Framing_Handler(void)
+{
+    framing_handler_calls++;
+}
+
+static void Overrun_Handler(void)
+{
+    overrun_handler_calls++;
+}
+
+static uint16 Available(void)
+{
+    uint16 l_count = 0U;
+
+    (void)EUSART_ASYNC_RX_Available(&l_count);
+    return l_count;
+}
+
+int main(void)
+{
+    usart_t l_usart = {0};
+    usart_rx_statistics_t l_statistics;
+    uint8 l_data[64];
+    uint8 l_expected = 0U;
+    uint8 l_in_order = 1U;
+    uint16 l_count = 0U;
+    uint16 l_index = 0U;
+
+    l_usart.baudrate = 19200UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_usart.usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE;
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
+    l_usart.EUSART_RxDefaultInterruptHandler = Rx_Handler;
+    l_usart.EUSART_FramingErrorHandler = Framing_Handler;
+    l_usart.EUSART_OverrunErrorHandler = Overrun_Handler;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK((1U == PIE1bits.RCIE) && (1U == RCSTAbits.CREN));
+    TEST_CHECK(0U == Available());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_ReadByteNonBlocking(l_data));
+
+    /* 43 bytes, two per interrupt, byte 10 with a framing error : 31 kept, 11 dropped */
+    for(l_index = 0U; l_index < 43U; l_index += 2U)
+    {
+        Fifo_Push((uint8)l_index, (uint8)(10U == l_index));
+        if((l_index + 1U) < 43U)
+        {
+            Fifo_Push((uint8)(l_index + 1U), 0U);
+        }
+        else { /* Nothing */ }
+        EUSART_RX_ISR();
+        TEST_CHECK(0U == PIR1bits.RCIF);
+    }
+    TEST_CHECK((EUSART_RX_BUFFER_SIZE - 1U) == Available());
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Get_Statistics(&l_statistics));
+    TEST_CHECK(1U == l_statistics.framing_errors);
+    TEST_CHECK(11U == l_statistics.buffer_overflows);
+    TEST_CHECK(0U == l_statistics.overrun_errors);
+    TEST_CHECK(1U == framing_handler_calls);
+    TEST_CHECK(0U == overrun_handler_calls);
+    /* The data handler only runs when a byte was buffered */
+    TEST_CHECK(16U == rx_handler_calls);
+
+    /* Read back in order, without the byte with the framing error */
+    TEST_CHECK(E_OK == EUSART_ASYNC_Read(l_data, 64U, &l_count));
+    TEST_CHECK((EUSART_RX_BUFFER_SIZE - 1U) == l_count);
+    for(l_index = 0U; l_index < l_count; l_index++)
+    {
+        l_expected = (uint8)((l_index < 10U) ? l_index : (l_index + 1U));
+        l_in_order &= (uint8)(l_expected == l_data[l_index]);
+    }
+    TEST_CHECK(1U == l_in_order);
+    TEST_CHECK(0U == Available());
+    TEST_CHECK(E_OK == EUSART_ASYNC_Read(l_data, 64U, &l_count));
+    TEST_CHECK(0U == l_count);
+
+    /* Overrun : counted once the FIFO is drained, the receiver is restarted */
+    Fifo_Push(0xA1U, 0U);
+    Fifo_Push(0xA2U, 0U);
+    RCSTAbits.OERR = 1;
+    RCSTAbits.CREN = 0;
+    EUSART_RX_ISR();
+    RCSTAbits.OERR = 0;
+    TEST_CHECK(1U == RCSTAbits.CREN);
+    TEST_CHECK(1U == overrun_handler_calls);
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Get_Statistics(&l_statistics));
+    TEST_CHECK(1U == l_statistics.overrun_errors);
+    TEST_CHECK(2U == Available());
+    TEST_CHECK((E_OK == EUSART_ASYNC_ReadByteBlocking(l_data)) && (0xA1U == l_data[0]));
+    TEST_CHECK((E_OK == EUSART_ASYNC_ReadByteNonBlocking(l_data)) && (0xA2U == l_data[0]));
+
+    /* Cleared counters */
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Clear_Statistics());
+    TEST_CHECK(1U == PIE1bits.RCIE);
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Get_Statistics(&l_statistics));
+    TEST_CHECK((0U == l_statistics.framing_errors) && (0U == l_statistics.buffer_overflows) &&
+               (0U == l_statistics.overrun_errors));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_RX_Get_Statistics(NULL));
+
+    /* Without the receive interrupt, straight from RCREG */
+    l_usart.usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(0U == PIE1bits.RCIE);
+    TEST_CHECK(0U == Available());
+    Fifo_Push(0x5AU, 0U);
+    TEST_CHECK(1U == Available());
+    TEST_CHECK((E_OK == EUSART_ASYNC_ReadByteNonBlocking(l_data)) && (0x5AU == l_data[0]));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_ReadByteNonBlocking(l_data));
+
+    return TEST_RESULT("test_usart_rx");
+}
@@ -0,0 +1,153 @@
+/*
+ * File:   test_usart_stream.c
+ * Author: Abdelrahman Aref
+ *
+ * Strings and segment lists sent in place by EUSART_TX_ISR() : a constant banner longer than the
+ * transmit buffer after buffered bytes, the writes held back while it streams, a second stream
+ * refused, a segment list with NULL and empty parts, and the empty messages.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define WIRE_CAPACITY                     256U
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static uint8 tx_handler_calls = 0U;
+
+static const uint8 banner[] = "PIC18F4620 EUSART stream test, a constant string longer than the buffer\r\n";
+
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    PIR1bits.TXIF = 0;
+    return l_slot;
+}
+
+static void Tx_Handler(void)
+{
+    tx_handler_calls++;
+}
+
+/* Byte times, one interrupt each */
+static void Transmit(uint16 bytes)
+{
+    while((bytes > 0U) && (PIE1bits.TXIE))
+    {
+        PIR1bits.TXIF = 1;
+        EUSART_TX_ISR();
+        bytes--;
+    }
+}
+
+static uint16 Free(void)
+{
+    uint16 l_free = 0U;
+
+    (void)EUSART_ASYNC_TX_Free(&l_free);
+    return l_free;
+}
+
+static uint8 Idle(void)
+{
+    uint8 l_idle = 0U;
+
+    (void)EUSART_ASYNC_TX_Idle(&l_idle);
+    return l_idle;
+}
+
+int main(void)
+{
+    usart_t l_usart = {0};
+    const uint8 l_header[3] = {0x02U, 'I', 'D'};
+    const uint8 l_crc[2] = {0xBEU, 0xEFU};
+    uint8 l_body[40];
+    usart_tx_segment_t l_segments[5];
+    usart_tx_segment_t l_empty[2] = {{NULL, 4U}, {l_crc, 0U}};
+    uint16 l_banner_length = (uint16)strlen((const char *)banner);
+    uint16 l_index = 0U;
+
+    for(l_index = 0U; l_index < sizeof(l_body); l_index++)
+    {
+        l_body[l_index] = (uint8)(0x80U + l_index);
+    }
+    l_segments[0].data = l_header;
+    l_segments[0].length = 3U;
+    l_segments[1].data = NULL;
+    l_segments[1].length = 5U;
+    l_segments[2].data = l_body;
+    l_segments[2].length = 0U;
+    l_segments[3].data = l_body;
+    l_segments[3].length = (uint16)sizeof(l_body);
+    l_segments[4].data = l_crc;
+    l_segments[4].length = 2U;
+
+    /* Streams need the transmit interrupt */
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE;
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamStringNonBlocking(banner));
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+    l_usart.EUSART_TxDefaultInterruptHandler = Tx_Handler;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+
+    /* The banner follows the buffered bytes, the writes wait until it is sent */
+    TEST_CHECK(sizeof(banner) > EUSART_TX_BUFFER_SIZE);
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteStringNonBlocking((const uint8 *)">> "));
+    TEST_CHECK(E_OK == EUSART_ASYNC_StreamStringNonBlocking(banner));
+    TEST_CHECK(0U == Free());
+    TEST_CHECK(0U == Idle());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_WriteByteNonBlocking('!'));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamStringNonBlocking(banner));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamSegmentsNonBlocking(l_segments, 5U));
+    Transmit(20U);
+    TEST_CHECK(0U == Free());
+    TEST_CHECK(0U == tx_handler_calls);
+    Transmit(WIRE_CAPACITY);
+    TEST_CHECK((3U + l_banner_length) == wire_length);
+    TEST_CHECK(0 == memcmp((const void *)wire, ">> ", 3U));
+    TEST_CHECK(0 == memcmp((const void *)&wire[3], banner, l_banner_length));
+    TEST_CHECK(1U == tx_handler_calls);
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == Free());
+    TEST_CHECK(1U == Idle());
+
+    /* Header, body and CRC as one message, the NULL and empty segments are skipped */
+    wire_length = 0U;
+    TEST_CHECK(E_OK == EUSART_ASYNC_StreamSegmentsNonBlocking(l_segments, 5U));
+    Transmit(WIRE_CAPACITY);
+    TEST_CHECK((3U + sizeof(l_body) + 2U) == wire_length);
+    TEST_CHECK(0 == memcmp((const void *)wire, l_header, 3U));
+    TEST_CHECK(0 == memcmp((const void *)&wire[3], l_body, sizeof(l_body)));
+    TEST_CHECK((0xBEU == wire[3U + sizeof(l_body)]) && (0xEFU == wire[4U + sizeof(l_body)]));
+    TEST_CHECK(2U == tx_handler_calls);
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking('!'));
+    Transmit(WIRE_CAPACITY);
+    TEST_CHECK('!' == wire[wire_length - 1U]);
+
+    /* Empty messages : accepted, nothing to send */
+    wire_length = 0U;
+    TEST_CHECK(E_OK == EUSART_ASYNC_StreamStringNonBlocking((const uint8 *)""));
+    TEST_CHECK(E_OK == EUSART_ASYNC_StreamSegmentsNonBlocking(l_empty, 2U));
+    TEST_CHECK((0U == PIE1bits.TXIE) && (1U == Idle()) && (0U == wire_length));
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == Free());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamSegmentsNonBlocking(NULL, 2U));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamSegmentsNonBlocking(l_segments, 0U));
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_StreamStringNonBlocking(NULL));
+
+    return TEST_RESULT("test_usart_stream");
+}
@@ -0,0 +1,188 @@
+/*
+ * File:   test_usart_sync.c
+ * Author: Abdelrahman Aref
+ *
+ * Synchronous mode against a simulated clock : a master clocks one byte in each time
+ * EUSART_RX_ISR() or a reader sets SREN, a slave receives while CREN is set. Checks the
+ * bus turnaround rules, a 40-byte master read through the 32-byte receive ring without a
+ * dropped byte, a slave read, and the master overrun recovery.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define WIRE_CAPACITY                     64U
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static unsigned char rx_byte = 0U;
+static uint16 clocked = 0U;
+static uint8 rx_done = 0U;
+static uint8 tx_done = 0U;
+
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    return l_slot;
+}
+
+unsigned char Test_Rcreg_Read(void)
+{
+    PIR1bits.RCIF = 0;
+    return rx_byte;
+}
+
+static void Rx_Done(void)
+{
+    rx_done++;
+}
+
+static void Tx_Done(void)
+{
+    tx_done++;
+}
+
+/* The master clock shifts one byte in per SREN, the EUSART clears SREN at the end of the byte */
+static void Clock(void)
+{
+    while(1U == RCSTAbits.SREN)
+    {
+        RCSTAbits.SREN = 0;
+        rx_byte = (uint8)(100U + clocked);
+        clocked++;
+        PIR1bits.RCIF = 1;
+        EUSART_RX_ISR();
+        /* Cleared with CREN by the driver */
+        RCSTAbits.OERR = 0;
+    }
+}
+
+static void Transmit(void)
+{
+    PIR1bits.TXIF = 1;
+    while(PIE1bits.TXIE)
+    {
+        EUSART_TX_ISR();
+    }
+}
+
+static uint8 Busy(void)
+{
+    uint8 l_busy = 0U;
+
+    (void)EUSART_SYNC_Busy(&l_busy);
+    return l_busy;
+}
+
+int main(void)
+{
+    usart_sync_t l_sync = {0};
+    usart_rx_statistics_t l_statistics;
+    const uint8 l_command[3] = {0x9FU, 0x01U, 0x02U};
+    uint8 l_data[64];
+    uint16 l_received = 0U;
+    uint16 l_count = 0U;
+    uint16 l_index = 0U;
+    uint8 l_in_order = 1U;
+
+    /* Master at 500 kHz : Fosc / (4 * 500000) = 4, BRG 3 */
+    l_sync.clock_rate = 500000UL;
+    l_sync.baudrate_gen_gonfig = BAUDRATE_SYN_8BIT;
+    l_sync.usart_sync_cfg.usart_sync_master = EUSART_SYNCHRONOUS_MASTER;
+    l_sync.EUSART_SyncRxDoneHandler = Rx_Done;
+    l_sync.EUSART_SyncTxDoneHandler = Tx_Done;
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(E_OK == EUSART_SYNC_Init(&l_sync));
+    TEST_CHECK((1U == TXSTAbits.SYNC) && (1U == TXSTAbits.CSRC) && (3U == SPBRG));
+    TEST_CHECK((0U == RCSTAbits.CREN) && (0U == RCSTAbits.SREN) && (1U == RCSTAbits.SPEN));
+    TEST_CHECK(0U == Busy());
+    l_sync.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Init(&l_sync));
+    l_sync.baudrate_gen_gonfig = BAUDRATE_SYN_8BIT;
+    TEST_CHECK(E_OK == EUSART_SYNC_Init(&l_sync));
+
+    /* The read waits for the command to leave the shift register */
+    TEST_CHECK(E_OK == EUSART_SYNC_Write(l_command, 3U));
+    TEST_CHECK(1U == Busy());
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Read_Start(40U));
+    Transmit();
+    TXSTAbits.TRMT = 0;
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Read_Start(40U));
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK((3U == wire_length) && (0x9FU == wire[0]) && (1U == tx_done));
+    TEST_CHECK(0U == RCSTAbits.SREN);
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Read_Start(0U));
+
+    /* 40 bytes through the 32-byte ring : SREN is armed only while a slot is free */
+    TEST_CHECK(E_OK == EUSART_SYNC_Read_Start(40U));
+    TEST_CHECK(1U == RCSTAbits.SREN);
+    Clock();
+    TEST_CHECK((EUSART_RX_BUFFER_SIZE - 1U) == clocked);
+    TEST_CHECK(0U == RCSTAbits.SREN);
+    TEST_CHECK(1U == Busy());
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Write(l_command, 1U));
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Read_Start(1U));
+    /* Each byte read makes room for one more */
+    while((l_received < 40U) && (l_index < 40U))
+    {
+        (void)EUSART_ASYNC_Read(&l_data[l_received], 5U, &l_count);
+        l_received += l_count;
+        Clock();
+        l_index++;
+    }
+    TEST_CHECK(40U == l_received);
+    TEST_CHECK(40U == clocked);
+    for(l_index = 0U; l_index < 40U; l_index++)
+    {
+        l_in_order &= (uint8)((100U + l_index) == l_data[l_index]);
+    }
+    TEST_CHECK(1U == l_in_order);
+    TEST_CHECK((1U == rx_done) && (0U == RCSTAbits.SREN) && (0U == Busy()));
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Get_Statistics(&l_statistics));
+    TEST_CHECK(0U == l_statistics.buffer_overflows);
+
+    /* Master overrun : CREN cleared to clear OERR, not set again */
+    TEST_CHECK(E_OK == EUSART_SYNC_Read_Start(2U));
+    RCSTAbits.CREN = 1;
+    RCSTAbits.OERR = 1;
+    Clock();
+    TEST_CHECK(0U == RCSTAbits.CREN);
+    TEST_CHECK(E_OK == EUSART_ASYNC_RX_Get_Statistics(&l_statistics));
+    TEST_CHECK(1U == l_statistics.overrun_errors);
+    (void)EUSART_ASYNC_Read(l_data, 5U, &l_count);
+    TEST_CHECK((2U == l_count) && (2U == rx_done));
+
+    /* Slave : receives on the master clock with CREN, stops after the last byte */
+    l_sync.usart_sync_cfg.usart_sync_master = EUSART_SYNCHRONOUS_SLAVE;
+    l_sync.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    TEST_CHECK(E_OK == EUSART_SYNC_Init(&l_sync));
+    TEST_CHECK((1U == TXSTAbits.SYNC) && (0U == TXSTAbits.CSRC));
+    TEST_CHECK(E_OK == EUSART_SYNC_Read_Start(2U));
+    TEST_CHECK((1U == RCSTAbits.CREN) && (0U == RCSTAbits.SREN));
+    rx_byte = 7U;
+    PIR1bits.RCIF = 1;
+    EUSART_RX_ISR();
+    TEST_CHECK((1U == RCSTAbits.CREN) && (1U == Busy()));
+    rx_byte = 8U;
+    PIR1bits.RCIF = 1;
+    EUSART_RX_ISR();
+    TEST_CHECK((0U == RCSTAbits.CREN) && (3U == rx_done) && (0U == Busy()));
+    (void)EUSART_ASYNC_Read(l_data, 5U, &l_count);
+    TEST_CHECK((2U == l_count) && (7U == l_data[0]) && (8U == l_data[1]));
+
+    TEST_CHECK(E_OK == EUSART_SYNC_DeInit(&l_sync));
+    TEST_CHECK((0U == TXSTAbits.SYNC) && (0U == RCSTAbits.SPEN));
+    TEST_CHECK(E_NOT_OK == EUSART_SYNC_Read_Start(1U));
+
+    return TEST_RESULT("test_usart_sync");
+}
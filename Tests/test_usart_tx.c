@@ -0,0 +1,202 @@
+/*
+ * File:   test_usart_tx.c
+ * Author: Abdelrahman Aref
+ *
+ * Transmit ring buffer of the EUSART driver : a TXREG write clears TXIF until the test lets the
+ * next interrupt in, one byte per interrupt like the hardware. Checks the free space, the all or
+ * nothing writes, the byte order across the buffer wrap-around, the drained buffer handler, the
+ * idle report and the path without the transmit interrupt.
+ *
+ * Created on October 20, 2026, 9:00 AM
+ */
+
+#include <string.h>
+#include "test_common.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+#include "../MCAL_Layer/USART/hal_usart.h"
+
+#define WIRE_CAPACITY                     128U
+
+static volatile unsigned char wire[WIRE_CAPACITY];
+static uint16 wire_length = 0U;
+static uint8 tx_handler_calls = 0U;
+static uint32 random_seed = 11UL;
+
+/* TXREG is full until the byte moves to the shift register */
+volatile unsigned char *Test_Txreg_Slot(void)
+{
+    volatile unsigned char *l_slot = &wire[WIRE_CAPACITY - 1U];
+
+    if(wire_length < (WIRE_CAPACITY - 1U))
+    {
+        l_slot = &wire[wire_length];
+        wire_length++;
+    }
+    else { /* Nothing */ }
+    PIR1bits.TXIF = 0;
+    return l_slot;
+}
+
+static void Tx_Handler(void)
+{
+    tx_handler_calls++;
+}
+
+static uint8 Random(void)
+{
+    random_seed = (random_seed * 1103515245UL) + 12345UL;
+    return (uint8)(random_seed >> 16);
+}
+
+/* One interrupt per byte time until the driver turns TXIE off, returns the interrupt count */
+static uint16 Transmit(void)
+{
+    uint16 l_interrupts = 0U;
+
+    while(PIE1bits.TXIE)
+    {
+        PIR1bits.TXIF = 1;
+        EUSART_TX_ISR();
+        l_interrupts++;
+    }
+    return l_interrupts;
+}
+
+static uint16 Free(void)
+{
+    uint16 l_free = 0U;
+
+    (void)EUSART_ASYNC_TX_Free(&l_free);
+    return l_free;
+}
+
+static uint8 Idle(void)
+{
+    uint8 l_idle = 0U;
+
+    (void)EUSART_ASYNC_TX_Idle(&l_idle);
+    return l_idle;
+}
+
+int main(void)
+{
+    usart_t l_usart = {0};
+    uint8 l_message[EUSART_TX_BUFFER_SIZE];
+    uint8 l_sent[WIRE_CAPACITY];
+    uint16 l_sent_length = 0U;
+    uint16 l_index = 0U;
+    uint16 l_round = 0U;
+    uint8 l_length = 0U;
+    uint8 l_in_order = 1U;
+
+    for(l_index = 0U; l_index < EUSART_TX_BUFFER_SIZE; l_index++)
+    {
+        l_message[l_index] = (uint8)('a' + l_index);
+    }
+
+    l_usart.baudrate = 9600UL;
+    l_usart.baudrate_gen_gonfig = BAUDRATE_ASYN_AUTO;
+    l_usart.usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE;
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+    l_usart.EUSART_TxDefaultInterruptHandler = Tx_Handler;
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    /* TXIF is set while TXREG is empty, no interrupt until something is queued */
+    TEST_CHECK(0U == PIE1bits.TXIE);
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == Free());
+    TEST_CHECK(1U == Idle());
+
+    /* Queued bytes wait for the interrupt */
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking('0'));
+    TEST_CHECK(1U == PIE1bits.TXIE);
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 2U) == Free());
+    TEST_CHECK(0U == Idle());
+    TEST_CHECK(0U == wire_length);
+
+    /* All or nothing : 31 bytes don't fit in the 30 free, nothing is queued */
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_WriteNonBlocking(l_message, EUSART_TX_BUFFER_SIZE - 1U));
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 2U) == Free());
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteNonBlocking(l_message, EUSART_TX_BUFFER_SIZE - 3U));
+    TEST_CHECK(1U == Free());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_WriteStringNonBlocking((const uint8 *)"xy"));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteStringNonBlocking((const uint8 *)"z"));
+    TEST_CHECK(0U == Free());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_WriteByteNonBlocking('!'));
+
+    /* Drained one byte per interrupt, the handler runs once on the empty buffer */
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == Transmit());
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == wire_length);
+    TEST_CHECK('0' == wire[0]);
+    TEST_CHECK(0 == memcmp((const void *)&wire[1], l_message, EUSART_TX_BUFFER_SIZE - 3U));
+    TEST_CHECK('z' == wire[EUSART_TX_BUFFER_SIZE - 2U]);
+    TEST_CHECK(1U == tx_handler_calls);
+    TEST_CHECK(0U == PIE1bits.TXIE);
+    TEST_CHECK((EUSART_TX_BUFFER_SIZE - 1U) == Free());
+    /* The last stop bit is still shifting out */
+    TXSTAbits.TRMT = 0;
+    TEST_CHECK(0U == Idle());
+    TXSTAbits.TRMT = 1;
+    TEST_CHECK(1U == Idle());
+
+    /* Random messages across the wrap-around, partly drained between the writes */
+    for(l_round = 0U; l_round < 500U; l_round++)
+    {
+        wire_length = 0U;
+        l_sent_length = 0U;
+        while(l_sent_length < 64U)
+        {
+            l_length = (uint8)(Random() % 12U);
+            for(l_index = 0U; l_index < l_length; l_index++)
+            {
+                l_message[l_index] = Random();
+            }
+            if(E_OK == EUSART_ASYNC_WriteNonBlocking(l_message, l_length))
+            {
+                memcpy(&l_sent[l_sent_length], l_message, l_length);
+                l_sent_length += l_length;
+            }
+            else { /* Full, sent later */ }
+            /* A few byte times */
+            for(l_index = Random() % 8U; (l_index > 0U) && (PIE1bits.TXIE); l_index--)
+            {
+                PIR1bits.TXIF = 1;
+                EUSART_TX_ISR();
+            }
+        }
+        (void)Transmit();
+        l_in_order &= (uint8)((l_sent_length == wire_length) &&
+                              (0 == memcmp((const void *)wire, l_sent, l_sent_length)));
+    }
+    TEST_CHECK(1U == l_in_order);
+
+    /* The blocking write keeps the order with the queued bytes */
+    wire_length = 0U;
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking('1'));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteBlocking('2'));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteStringBlocking((const uint8 *)"34"));
+    TEST_CHECK(0U == wire_length);
+    (void)Transmit();
+    TEST_CHECK((4U == wire_length) && (0 == memcmp((const void *)wire, "1234", 4U)));
+
+    /* Without the transmit interrupt, straight to TXREG when the transmitter is idle */
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    wire_length = 0U;
+    TEST_CHECK(1U == Free());
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking('A'));
+    TEST_CHECK((1U == wire_length) && ('A' == wire[0]));
+    TXSTAbits.TRMT = 0;
+    TEST_CHECK(0U == Free());
+    TEST_CHECK(E_NOT_OK == EUSART_ASYNC_WriteByteNonBlocking('B'));
+    TEST_CHECK(1U == wire_length);
+    TXSTAbits.TRMT = 1;
+
+    /* DeInit turns the transmit interrupt off */
+    l_usart.usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
+    TEST_CHECK(E_OK == EUSART_ASYNC_Init(&l_usart));
+    TEST_CHECK(E_OK == EUSART_ASYNC_WriteByteNonBlocking('C'));
+    TEST_CHECK(E_OK == EUSART_ASYNC_DeInit(&l_usart));
+    TEST_CHECK((0U == PIE1bits.TXIE) && (0U == RCSTAbits.SPEN));
+
+    return TEST_RESULT("test_usart_tx");
+}
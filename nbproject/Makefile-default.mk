@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=ECU_Layer/7_Segment/ecu_seven_segment.c ECU_Layer/BUTTON/ecu_button.c ECU_Layer/Chr_LCD/ecu_chr_lcd.c ECU_Layer/DC_Motor/ecu_dc_motor.c ECU_Layer/KeyPad/ecu_keypad.c ECU_Layer/LED/ecu_led.c ECU_Layer/LM35/ecu_lm35_sensor.c ECU_Layer/Relay/ecu_relay.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EEPROM/hal_eeprom.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/SPI/hal_spi.c MCAL_Layer/Timer0/hal_timer0.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/Timer3/hal_timer3.c MCAL_Layer/USART/hal_usart.c MCAL_Layer/device_config.c application.c MCAL_Layer/I2C/hal_i2c.c
+SOURCEFILES_QUOTED_IF_SPACED=ECU_Layer/7_Segment/ecu_seven_segment.c ECU_Layer/BUTTON/ecu_button.c ECU_Layer/Chr_LCD/ecu_chr_lcd.c ECU_Layer/DC_Motor/ecu_dc_motor.c ECU_Layer/KeyPad/ecu_keypad.c ECU_Layer/LED/ecu_led.c ECU_Layer/LM35/ecu_lm35_sensor.c ECU_Layer/Relay/ecu_relay.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EEPROM/hal_eeprom.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/SPI/hal_spi.c MCAL_Layer/Timer0/hal_timer0.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/Timer3/hal_timer3.c MCAL_Layer/USART/hal_usart.c MCAL_Layer/device_config.c application.c MCAL_Layer/I2C/hal_i2c.c ECU_Layer/Servo/ecu_servo.c ECU_Layer/IR_Receiver/ecu_ir_receiver.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c MCAL_Layer/ADC/hal_adc_filter.c MCAL_Layer/ADC/hal_adc_window.c MCAL_Layer/ADC/hal_adc_convert.c ECU_Layer/Power_Meter/ecu_power_meter.c ECU_Layer/DTMF/ecu_dtmf.c ECU_Layer/Serial_Link/ecu_serial_link.c ECU_Layer/Modbus_Slave/ecu_modbus_slave.c MCAL_Layer/USART/hal_usart_lin.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1 ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1 ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1 ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1.d ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1.d ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1.d ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1.d ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1.d ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1.d ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/application.p1.d ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1 ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1 ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1 ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1 ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1.d ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1.d ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1.d ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1.d ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1.d ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1.d ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/application.p1.d ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1 ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1 ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1 ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1
+OBJECTFILES=${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1 ${OBJECTDIR}/ECU_Layer/BUTTON/ecu_button.p1 ${OBJECTDIR}/ECU_Layer/Chr_LCD/ecu_chr_lcd.p1 ${OBJECTDIR}/ECU_Layer/DC_Motor/ecu_dc_motor.p1 ${OBJECTDIR}/ECU_Layer/KeyPad/ecu_keypad.p1 ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/LM35/ecu_lm35_sensor.p1 ${OBJECTDIR}/ECU_Layer/Relay/ecu_relay.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EEPROM/hal_eeprom.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/SPI/hal_spi.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1 ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1
 
 # Source Files
-SOURCEFILES=ECU_Layer/7_Segment/ecu_seven_segment.c ECU_Layer/BUTTON/ecu_button.c ECU_Layer/Chr_LCD/ecu_chr_lcd.c ECU_Layer/DC_Motor/ecu_dc_motor.c ECU_Layer/KeyPad/ecu_keypad.c ECU_Layer/LED/ecu_led.c ECU_Layer/LM35/ecu_lm35_sensor.c ECU_Layer/Relay/ecu_relay.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EEPROM/hal_eeprom.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/SPI/hal_spi.c MCAL_Layer/Timer0/hal_timer0.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/Timer3/hal_timer3.c MCAL_Layer/USART/hal_usart.c MCAL_Layer/device_config.c application.c MCAL_Layer/I2C/hal_i2c.c
+SOURCEFILES=ECU_Layer/7_Segment/ecu_seven_segment.c ECU_Layer/BUTTON/ecu_button.c ECU_Layer/Chr_LCD/ecu_chr_lcd.c ECU_Layer/DC_Motor/ecu_dc_motor.c ECU_Layer/KeyPad/ecu_keypad.c ECU_Layer/LED/ecu_led.c ECU_Layer/LM35/ecu_lm35_sensor.c ECU_Layer/Relay/ecu_relay.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EEPROM/hal_eeprom.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/SPI/hal_spi.c MCAL_Layer/Timer0/hal_timer0.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/Timer3/hal_timer3.c MCAL_Layer/USART/hal_usart.c MCAL_Layer/device_config.c application.c MCAL_Layer/I2C/hal_i2c.c ECU_Layer/Servo/ecu_servo.c ECU_Layer/IR_Receiver/ecu_ir_receiver.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c MCAL_Layer/ADC/hal_adc_filter.c MCAL_Layer/ADC/hal_adc_window.c MCAL_Layer/ADC/hal_adc_convert.c ECU_Layer/Power_Meter/ecu_power_meter.c ECU_Layer/DTMF/ecu_dtmf.c ECU_Layer/Serial_Link/ecu_serial_link.c ECU_Layer/Modbus_Slave/ecu_modbus_slave.c MCAL_Layer/USART/hal_usart_lin.c
 
 
 
@@ -280,6 +280,94 @@ ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1: MCAL_Layer/I2C/hal_i2c.c  nbproject/Make
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.d ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1: MCAL_Layer/USART/hal_usart_lin.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/USART" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1 MCAL_Layer/USART/hal_usart_lin.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.d ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1: ECU_Layer/Modbus_Slave/ecu_modbus_slave.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Modbus_Slave" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 ECU_Layer/Modbus_Slave/ecu_modbus_slave.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.d ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1: ECU_Layer/Serial_Link/ecu_serial_link.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Serial_Link" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 ECU_Layer/Serial_Link/ecu_serial_link.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.d ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1: ECU_Layer/DTMF/ecu_dtmf.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/DTMF" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 ECU_Layer/DTMF/ecu_dtmf.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.d ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1: ECU_Layer/Power_Meter/ecu_power_meter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Power_Meter" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 ECU_Layer/Power_Meter/ecu_power_meter.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.d ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1: MCAL_Layer/ADC/hal_adc_convert.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 MCAL_Layer/ADC/hal_adc_convert.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1: MCAL_Layer/ADC/hal_adc_window.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 MCAL_Layer/ADC/hal_adc_window.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1: MCAL_Layer/ADC/hal_adc_filter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 MCAL_Layer/ADC/hal_adc_filter.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1: ECU_Layer/IR_Receiver/ecu_ir_receiver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/IR_Receiver" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 ECU_Layer/IR_Receiver/ecu_ir_receiver.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.d ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1: ECU_Layer/Servo/ecu_servo.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Servo" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 ECU_Layer/Servo/ecu_servo.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.d ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 else
 ${OBJECTDIR}/ECU_Layer/7_Segment/ecu_seven_segment.p1: ECU_Layer/7_Segment/ecu_seven_segment.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/ECU_Layer/7_Segment" 
@@ -473,6 +561,94 @@ ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1: MCAL_Layer/I2C/hal_i2c.c  nbproject/Make
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.d ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/I2C/hal_i2c.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1: MCAL_Layer/USART/hal_usart_lin.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/USART" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1 MCAL_Layer/USART/hal_usart_lin.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.d ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/USART/hal_usart_lin.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1: ECU_Layer/Modbus_Slave/ecu_modbus_slave.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Modbus_Slave" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1 ECU_Layer/Modbus_Slave/ecu_modbus_slave.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.d ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Modbus_Slave/ecu_modbus_slave.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1: ECU_Layer/Serial_Link/ecu_serial_link.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Serial_Link" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1 ECU_Layer/Serial_Link/ecu_serial_link.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.d ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Serial_Link/ecu_serial_link.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1: ECU_Layer/DTMF/ecu_dtmf.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/DTMF" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1 ECU_Layer/DTMF/ecu_dtmf.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.d ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/DTMF/ecu_dtmf.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1: ECU_Layer/Power_Meter/ecu_power_meter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Power_Meter" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1 ECU_Layer/Power_Meter/ecu_power_meter.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.d ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Power_Meter/ecu_power_meter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1: MCAL_Layer/ADC/hal_adc_convert.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1 MCAL_Layer/ADC/hal_adc_convert.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_convert.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1: MCAL_Layer/ADC/hal_adc_window.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1 MCAL_Layer/ADC/hal_adc_window.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_window.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1: MCAL_Layer/ADC/hal_adc_filter.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1 MCAL_Layer/ADC/hal_adc_filter.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc_filter.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1: ECU_Layer/IR_Receiver/ecu_ir_receiver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/IR_Receiver" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1 ECU_Layer/IR_Receiver/ecu_ir_receiver.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.d ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/IR_Receiver/ecu_ir_receiver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1: ECU_Layer/Servo/ecu_servo.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Servo" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1 ECU_Layer/Servo/ecu_servo.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.d ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Servo/ecu_servo.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 endif
 
 # ------------------------------------------------------------------------------------